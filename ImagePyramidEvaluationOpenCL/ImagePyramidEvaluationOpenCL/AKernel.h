@@ -4,6 +4,9 @@
 #include <string>
 #include "opencl_common.h"
 #include "AOpenCLInterface.h"
+#include "ProgramCache.h"
+#include "Roofline.h"
+#include "Tracer.h"
 #include <memory>
 
 using SPImage2D = std::shared_ptr<cl::Image2D>;
@@ -13,9 +16,9 @@ template<class Derived>
 class AKernel
 {
 public:
-    AKernel(AOpenCLInterface* const opencl, cl::Program* const program)
+    AKernel(AOpenCLInterface* const opencl, ProgramCache* const programs)
         : opencl(opencl),
-          program(program),
+          programs(programs),
           device(&opencl->getDevice()),
           context(&opencl->getContext()),
           queue(&opencl->getQueue()),
@@ -40,14 +43,26 @@ public:
         this->queue2 = queue2;
     }
 
-    static std::string kernelSource()
+protected:
+    /**
+     * @brief Passes the launch together with its modelled costs to the roofline instrumentation and the tracer (if enabled)
+     * @param cols width of the input image
+     */
+    void recordLaunch(const char* kernelName, const size_t cols, const KernelCost& cost, const cl::Event& event) const
     {
-        return Derived::kernelSource();
+        if (Roofline* roofline = opencl->getRoofline())
+        {
+            roofline->record(kernelName, cost, event);
+        }
+        if (Tracer* tracer = opencl->getTracer())
+        {
+            tracer->record(kernelName, cols, event);
+        }
     }
 
 protected:
     AOpenCLInterface* opencl;
-    cl::Program* program;
+    ProgramCache* programs;
     cl::Device* device;
     cl::Context* context;
     cl::CommandQueue* queue;
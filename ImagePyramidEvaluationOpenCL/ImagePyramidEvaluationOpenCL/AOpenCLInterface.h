@@ -3,6 +3,9 @@
 #include "opencl_common.h"
 #include <opencv2/core.hpp>
 
+class Roofline;
+class Tracer;
+
 struct Lookup
 {
     int previousPixels;
@@ -25,4 +28,14 @@ public:
     virtual cl::Context& getContext() = 0;
     virtual cl::CommandQueue& getQueue() = 0;
     virtual cl::CommandQueue& getQueue2() = 0;
+
+    /**
+     * @return roofline instrumentation which records the kernel launches or nullptr if disabled
+     */
+    virtual Roofline* getRoofline() = 0;
+
+    /**
+     * @return tracer which records the timeline of the kernel launches or nullptr if disabled
+     */
+    virtual Tracer* getTracer() = 0;
 };
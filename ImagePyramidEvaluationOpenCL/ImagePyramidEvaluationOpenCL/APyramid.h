@@ -1,6 +1,7 @@
 #pragma once
 
 #include "OpenCLInterface.h"
+#include "FilterBank.h"
 #include <string>
 #include "settings.h"
 
@@ -19,7 +20,13 @@ public:
         SINGLE_PREDEFINED = 11,
         DOUBLE_PREDEFINED = 12,
         SINGLE_PREDEFINED_LOCAL = 13,
-        DOUBLE_PREDEFINED_LOCAL = 14
+        DOUBLE_PREDEFINED_LOCAL = 14,
+        MULTI_SIGMA_LOCAL = 15,            // Gx/Gy for all sigma sizes at once (only for the image pyramid)
+        SINGLE_LOCAL_PERSISTENT = 16,      // Persistent work-groups with asynchronous prefetching (only for the buffer and image1D pyramid)
+        SINGLE_SLIDING = 17,               // Sliding line buffer down vertical strips (only for the image and buffer pyramid)
+        SINGLE_SEPARATION_TRANSPOSED = 18, // Both separation passes along the rows with transposed output (only for the buffer pyramid)
+        DOUBLE_WINOGRAD = 19,              // Winograd F(2x2, 3x3) and F(2x2, 5x5) for both filters (only for the image pyramid)
+        SINGLE_DECOMPOSED = 20             // Full filters executed with the strategy selected by FilterDecomposition (only for the image pyramid)
     };
 
     static std::string methodToString(Method m)
@@ -37,10 +44,44 @@ public:
             case DOUBLE_PREDEFINED: return "doublePredefined";
             case SINGLE_PREDEFINED_LOCAL: return "singlePredefinedLocal";
             case DOUBLE_PREDEFINED_LOCAL: return "doublePredefinedLocal";
+            case MULTI_SIGMA_LOCAL: return "multiSigmaLocal";
+            case SINGLE_LOCAL_PERSISTENT: return "singleLocalPersistent";
+            case SINGLE_SLIDING: return "singleSliding";
+            case SINGLE_SEPARATION_TRANSPOSED: return "singleSeparationTransposed";
+            case DOUBLE_WINOGRAD: return "doubleWinograd";
+            case SINGLE_DECOMPOSED: return "singleDecomposed";
             default: return "";
         }
     }
 
+    static std::vector<Method> allMethods()
+    {
+        return { SINGLE_SEPARATION, SINGLE, DOUBLE, DOUBLE_SEPARATION, SINGLE_LOCAL, SINGLE_SEPARATION_LOCAL, DOUBLE_LOCAL, SINGLE_PREDEFINED, DOUBLE_PREDEFINED,
+                 SINGLE_PREDEFINED_LOCAL, DOUBLE_PREDEFINED_LOCAL, MULTI_SIGMA_LOCAL, SINGLE_LOCAL_PERSISTENT, SINGLE_SLIDING, SINGLE_SEPARATION_TRANSPOSED,
+                 DOUBLE_WINOGRAD, SINGLE_DECOMPOSED };
+    }
+
+    /**
+     * @brief Images and derivatives of all levels of the pyramid (level 0 is the input image)
+     */
+    struct Levels
+    {
+        std::vector<cv::Mat> images;
+        std::vector<cv::Mat> Gx;
+        std::vector<cv::Mat> Gy;
+    };
+
+    /**
+     * @brief Input memory object of the first octave as allocated by createPyramid()
+     */
+    struct OctaveMemory
+    {
+        cl::Memory memory;
+        size_t cols = 0;
+        size_t rows = 0;
+        size_t depth = 1;       //!< Levels stored in the memory object (one level per image for the image pyramid)
+    };
+
     struct Settings
     {
         Method method = SINGLE_SEPARATION;
@@ -51,16 +92,91 @@ public:
     explicit APyramid(const cv::Mat& img);
     virtual ~APyramid();
 
-    virtual void init() = 0;
+    /**
+     * @return false if the pyramid could not be created, e.g. there is no device or a program failed to build (the error is printed)
+     */
+    virtual bool init() = 0;
     virtual long long startFilterTest() = 0;
     virtual void readImages() = 0;
+
+    /**
+     * @brief Copies the images and the derivatives of the last filter test from the device
+     */
+    virtual Levels readLevels() = 0;
+
+    /**
+     * @brief Used by the bandwidth probes so that they access exactly the memory the filters read (valid after init())
+     */
+    virtual OctaveMemory firstOctave() = 0;
     virtual std::string name() = 0;
+    virtual ProgramCache& getProgramCache() = 0;
+
+    /**
+     * @return true if startFilterTest() implements the method for this storage type (other methods do nothing)
+     */
+    virtual bool supports(const Method method) const = 0;
+
+    /**
+     * @return false if the pyramid is computed without OpenCL (no device, programs or device memory)
+     */
+    virtual bool usesOpenCL() const
+    {
+        return true;
+    }
+
+    /**
+     * @brief Blocks until the kernels built in the background are available (call before every time measurement, no-op without OpenCL)
+     */
+    void waitForKernels();
 
     void setSettings(const Settings& settings);
 
+    cl::Device& getDevice()
+    {
+        return opencl.getDevice();
+    }
+
+    OpenCLInterface& getOpenCL()
+    {
+        return opencl;
+    }
+
+    int getNumberOctaves() const
+    {
+        return numberOctaves;
+    }
+
+    int getLevelsPerOctave() const
+    {
+        return levelsPerOctave;
+    }
+
+    /**
+     * @brief Records the kernel launches for the roofline report (must be called before init())
+     */
+    void setRoofline(Roofline* roofline)
+    {
+        opencl.setRoofline(roofline);
+    }
+
+    /**
+     * @brief Records the timeline of the kernel launches (must be called before init())
+     */
+    void setTracer(Tracer* tracer)
+    {
+        opencl.setTracer(tracer);
+    }
+
+protected:
+    const FilterBank::DerivativeFilters& derivativeFilters() const
+    {
+        return filterBank.get(settings.sigmaSize);
+    }
+
 protected:
     cv::Mat img;
     OpenCLInterface opencl;
+    FilterBank filterBank;
     Settings settings;
     int pyramidSize = 16;
     int numberOctaves = 4;
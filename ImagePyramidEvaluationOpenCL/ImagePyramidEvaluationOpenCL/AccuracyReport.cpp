@@ -0,0 +1,222 @@
+#include "AccuracyReport.h"
+#include "FilterBank.h"
+#include "JsonWriter.h"
+#include "general.h"
+#include "HostPyramid.h"
+#include <opencv2/imgproc.hpp>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace
+{
+    void filterLevels(const std::vector<cv::Mat>& levels, const int depth, const int sigmaSize, std::vector<cv::Mat>& levelsGx, std::vector<cv::Mat>& levelsGy)
+    {
+        cv::Mat Gx1, Gx2, Gy1, Gy2, Gx, Gy;
+        FilterBank::computeDerivativeKernels(sigmaSize, Gx1, Gx2, Gy1, Gy2, Gx, Gy);
+
+        // The float kernels define the filter, only the arithmetic is done in the precision of the depth
+        Gx.convertTo(Gx, depth);
+        Gy.convertTo(Gy, depth);
+
+        levelsGx.resize(levels.size());
+        levelsGy.resize(levels.size());
+        for (size_t i = 0; i < levels.size(); ++i)
+        {
+            cv::filter2D(levels[i], levelsGx[i], depth, Gx);
+            cv::filter2D(levels[i], levelsGy[i], depth, Gy);
+        }
+    }
+}
+
+AccuracyReport::AccuracyReport(const cv::Mat& img, const int numberOctaves, const int levelsPerOctave, const double errorBudget)
+    : img(img),
+      numberOctaves(numberOctaves),
+      levelsPerOctave(levelsPerOctave),
+      errorBudget(errorBudget)
+{}
+
+std::vector<AccuracyReport::Profile> AccuracyReport::defaultProfiles()
+{
+    return {
+        { "default", "" },
+        { "madEnable", "-cl-mad-enable" },
+        { "denormsAreZero", "-cl-denorms-are-zero" },
+        { "unsafeMath", "-cl-unsafe-math-optimizations" },
+        { "fastRelaxedMath", "-cl-fast-relaxed-math" }
+    };
+}
+
+void AccuracyReport::add(const std::string& profile, const std::string& pyramidName, const std::string& method, const int sigmaSize, const double milliseconds,
+                         const APyramid::Levels& levels)
+{
+    const Reference& ref = reference(sigmaSize);
+    ASSERT(levels.Gx.size() == ref.Gx.size(), "The pyramid has " << levels.Gx.size() << " levels but the reference has " << ref.Gx.size());
+
+    Entry entry;
+    entry.profile = profile;
+    entry.pyramid = pyramidName;
+    entry.method = method;
+    entry.sigmaSize = sigmaSize;
+    entry.milliseconds = milliseconds;
+    entry.worst.psnr = std::numeric_limits<double>::infinity();
+
+    for (size_t i = 0; i < levels.Gx.size(); ++i)
+    {
+        entry.errorsGx.push_back(levelError(ref.Gx[i], levels.Gx[i], sigmaSize));
+        entry.errorsGy.push_back(levelError(ref.Gy[i], levels.Gy[i], sigmaSize));
+
+        for (const LevelError& e : { entry.errorsGx.back(), entry.errorsGy.back() })
+        {
+            entry.worst.maxAbs = std::max(entry.worst.maxAbs, e.maxAbs);
+            entry.worst.relative = std::max(entry.worst.relative, e.relative);
+            entry.worst.psnr = std::min(entry.worst.psnr, e.psnr);
+        }
+    }
+
+    entries.push_back(entry);
+}
+
+void AccuracyReport::addHostFloat(const int sigmaSize)
+{
+    cv::Mat imgFloat;
+    img.convertTo(imgFloat, CV_32F);
+
+    APyramid::Levels levels;
+    HostPyramid::buildLevels(imgFloat, levels.images, numberOctaves, levelsPerOctave);
+    filterLevels(levels.images, CV_32F, sigmaSize, levels.Gx, levels.Gy);
+
+    add("host", "OpenCV", "float", sigmaSize, std::numeric_limits<double>::quiet_NaN(), levels);
+}
+
+void AccuracyReport::print(std::ostream& stream) const
+{
+    stream << "--- Accuracy against the double precision reference (worst level, without the filter border) ---" << std::endl;
+    stream << std::left << std::setw(18) << "profile" << std::setw(16) << "pyramid" << std::setw(28) << "method" << std::right << std::setw(6) << "sigma"
+           << std::setw(10) << "ms" << std::setw(12) << "max abs" << std::setw(12) << "relative" << std::setw(10) << "PSNR" << std::endl;
+
+    for (const Entry& e : entries)
+    {
+        stream << std::left << std::setw(18) << e.profile << std::setw(16) << e.pyramid << std::setw(28) << e.method << std::right << std::setw(6) << e.sigmaSize
+               << std::fixed << std::setprecision(2) << std::setw(10) << e.milliseconds << std::scientific << std::setprecision(2) << std::setw(12) << e.worst.maxAbs
+               << std::setw(12) << e.worst.relative << std::fixed << std::setprecision(1) << std::setw(10) << e.worst.psnr << std::defaultfloat
+               << (e.worst.relative > errorBudget ? "  over budget" : "") << std::endl;
+    }
+
+    // Fastest device configuration within the error budget per sigma size
+    std::map<int, const Entry*> fastest;
+    for (const Entry& e : entries)
+    {
+        if (std::isnan(e.milliseconds) || e.worst.relative > errorBudget)
+        {
+            continue;
+        }
+
+        const Entry*& f = fastest[e.sigmaSize];
+        if (!f || e.milliseconds < f->milliseconds)
+        {
+            f = &e;
+        }
+    }
+
+    for (const auto& pair : fastest)
+    {
+        stream << "Fastest within the budget of " << std::scientific << std::setprecision(1) << errorBudget << std::defaultfloat << " for sigma " << pair.first << ": "
+               << pair.second->profile << " " << pair.second->pyramid << " " << pair.second->method << " (" << pair.second->milliseconds << " ms)" << std::endl;
+    }
+}
+
+void AccuracyReport::writeJson(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    ASSERT(file.is_open(), "Could not open " << filename);
+
+    JsonWriter json(file);
+    json.beginObject();
+    json.key("errorBudget").value(errorBudget);
+
+    auto writeError = [&json](const LevelError& e)
+    {
+        json.beginObject();
+        json.key("maxAbs").value(e.maxAbs);
+        json.key("relative").value(e.relative);
+        json.key("psnr").value(std::isinf(e.psnr) ? std::numeric_limits<double>::quiet_NaN() : e.psnr);   // Exact results have no finite PSNR
+        json.endObject();
+    };
+
+    json.key("entries").beginArray();
+    for (const Entry& e : entries)
+    {
+        json.beginObject();
+        json.key("profile").value(e.profile);
+        json.key("pyramid").value(e.pyramid);
+        json.key("method").value(e.method);
+        json.key("sigmaSize").value(e.sigmaSize);
+        json.key("ms").value(e.milliseconds);
+        json.key("withinBudget").value(e.worst.relative <= errorBudget);
+        json.key("worst");
+        writeError(e.worst);
+
+        json.key("levelsGx").beginArray();
+        for (const LevelError& level : e.errorsGx)
+        {
+            writeError(level);
+        }
+        json.endArray();
+
+        json.key("levelsGy").beginArray();
+        for (const LevelError& level : e.errorsGy)
+        {
+            writeError(level);
+        }
+        json.endArray();
+
+        json.endObject();
+    }
+    json.endArray();
+
+    json.endObject();
+}
+
+const AccuracyReport::Reference& AccuracyReport::reference(const int sigmaSize)
+{
+    auto it = references.find(sigmaSize);
+    if (it != references.end())
+    {
+        return it->second;
+    }
+
+    cv::Mat imgDouble;
+    img.convertTo(imgDouble, CV_64F);
+
+    Reference& ref = references[sigmaSize];
+    std::vector<cv::Mat> levels;
+    HostPyramid::buildLevels(imgDouble, levels, numberOctaves, levelsPerOctave);
+    filterLevels(levels, CV_64F, sigmaSize, ref.Gx, ref.Gy);
+
+    return ref;
+}
+
+AccuracyReport::LevelError AccuracyReport::levelError(const cv::Mat& reference, const cv::Mat& result, const int border)
+{
+    LevelError error;
+    cv::Mat diff;
+    if (!HostPyramid::interiorDifference(reference, result, border, diff))
+    {
+        return error;
+    }
+    cv::minMaxLoc(diff, nullptr, &error.maxAbs);
+
+    const cv::Mat ref = reference(HostPyramid::interior(reference, result, border));
+    double minRef = 0.0, maxRef = 0.0;
+    cv::minMaxLoc(ref, &minRef, &maxRef);
+    const double peak = std::max(std::abs(minRef), std::abs(maxRef));
+
+    const double rmse = cv::norm(diff, cv::NORM_L2) / std::sqrt(static_cast<double>(diff.total()));
+    error.relative = peak > 0.0 ? error.maxAbs / peak : 0.0;
+    error.psnr = rmse > 0.0 ? 20.0 * std::log10(peak / rmse) : std::numeric_limits<double>::infinity();
+
+    return error;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+#include <opencv2/core.hpp>
+#include "APyramid.h"
+
+/**
+ * @brief Error of the Gx/Gy pyramids of every method against a double precision host reference, for several build option profiles
+ *
+ * The reference pyramid is computed from the input image in double precision (INTER_AREA downsampling like fed_resize and the same filter kernels). The
+ * errors are computed per level without the border pixels of the filter since some methods use a different border handling. Besides the device methods,
+ * the same pyramid computed in float precision on the host is reported as the error floor of single precision arithmetic.
+ *
+ * Together with the measured times, the report shows the fastest configuration whose relative error stays within the error budget.
+ */
+class AccuracyReport
+{
+public:
+    struct Profile
+    {
+        std::string name;
+        std::string buildOptions;   //!< Appended to the default build options
+    };
+
+    struct LevelError
+    {
+        double maxAbs = 0.0;
+        double relative = 0.0;      //!< Maximum absolute error relative to the maximum absolute value of the reference
+        double psnr = 0.0;          //!< In dB with the maximum absolute value of the reference as peak
+    };
+
+public:
+    /**
+     * @param errorBudget maximum relative error of an acceptable configuration
+     */
+    explicit AccuracyReport(const cv::Mat& img, const int numberOctaves = 4, const int levelsPerOctave = 4, const double errorBudget = 1e-5);
+
+    /**
+     * @brief Default options, -cl-mad-enable, -cl-denorms-are-zero, -cl-unsafe-math-optimizations (implies -cl-mad-enable) and -cl-fast-relaxed-math
+     * (additionally assumes finite values)
+     */
+    static std::vector<Profile> defaultProfiles();
+
+    /**
+     * @param milliseconds median time of the method
+     */
+    void add(const std::string& profile, const std::string& pyramidName, const std::string& method, const int sigmaSize, const double milliseconds,
+             const APyramid::Levels& levels);
+
+    /**
+     * @brief Adds the float host implementation (OpenCV) as error floor
+     */
+    void addHostFloat(const int sigmaSize);
+
+    void print(std::ostream& stream) const;
+    void writeJson(const std::string& filename) const;
+
+private:
+    struct Entry
+    {
+        std::string profile;
+        std::string pyramid;
+        std::string method;
+        int sigmaSize;
+        double milliseconds;
+        std::vector<LevelError> errorsGx;
+        std::vector<LevelError> errorsGy;
+        LevelError worst;           //!< Worst value of every metric over all levels and both derivatives
+    };
+
+    struct Reference
+    {
+        std::vector<cv::Mat> Gx;    //!< CV_64F
+        std::vector<cv::Mat> Gy;
+    };
+
+    const Reference& reference(const int sigmaSize);
+
+    static LevelError levelError(const cv::Mat& reference, const cv::Mat& result, const int border);
+
+private:
+    const cv::Mat img;
+    const int numberOctaves;
+    const int levelsPerOctave;
+    const double errorBudget;
+
+    std::map<int, Reference> references;
+    std::vector<Entry> entries;
+};
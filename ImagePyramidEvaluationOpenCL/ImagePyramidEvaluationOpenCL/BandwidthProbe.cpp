@@ -0,0 +1,198 @@
+#include "BandwidthProbe.h"
+#include "JsonWriter.h"
+#include "general.h"
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+static const char* kernelNames[BandwidthProbe::NUMBER_PATTERNS] = { "probe_copy", "probe_strided", "probe_neighbourhood", "probe_write" };
+
+static double kernelSeconds(const cl::Event& event)
+{
+    event.wait();
+    const cl_ulong start = event.getProfilingInfo<CL_PROFILING_COMMAND_START>();
+    const cl_ulong end = event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+
+    return (end - start) * 1e-9;
+}
+
+std::string BandwidthProbe::patternToString(const Pattern pattern)
+{
+    switch (pattern)
+    {
+        case COPY: return "copy";
+        case STRIDED: return "strided";
+        case NEIGHBOURHOOD: return "neighbourhood";
+        case WRITE: return "write";
+        default: return "";
+    }
+}
+
+BandwidthProbe::BandwidthProbe(const int radius, const int repetitions)
+    : radius(radius),
+      repetitions(repetitions)
+{}
+
+void BandwidthProbe::add(APyramid& pyramid)
+{
+    OpenCLInterface& opencl = pyramid.getOpenCL();
+    cl::Context& context = opencl.getContext();
+    const KernelRegistry::Storage storage = pyramid.getProgramCache().getStorage();
+    const APyramid::OctaveMemory octave = pyramid.firstOctave();
+    ASSERT(octave.memory(), "The pyramid has no memory objects, init() must be called first");
+
+    // Every storage type transfers the same volume: memory objects with fewer levels than the octave (one image per level) are probed once per level
+    ASSERT(pyramid.getLevelsPerOctave() % octave.depth == 0, "The memory object must contain a whole number of the levels of the octave");
+    const size_t launches = pyramid.getLevelsPerOctave() / octave.depth;
+
+    // Own queue since the queues of the interface only support profiling when a roofline or tracer is attached
+    cl::CommandQueue queue(context, opencl.getDevice(), CL_QUEUE_PROFILING_ENABLE);
+
+    // Output of the same type and size like the outputs of the filters
+    const size_t pixels = octave.cols * octave.rows * octave.depth;
+    const cl::ImageFormat format(CL_R, CL_FLOAT);
+    cl::Memory dst;
+    cl::Buffer dstBuffer;
+    switch (storage)
+    {
+        case KernelRegistry::IMAGES:
+            dst = cl::Image2D(context, CL_MEM_READ_WRITE, format, octave.cols, octave.rows);
+            break;
+        case KernelRegistry::CUBES:
+            dst = cl::Image2DArray(context, CL_MEM_READ_WRITE, format, octave.depth, octave.cols, octave.rows, 0, 0);
+            break;
+        case KernelRegistry::BUFFER:
+            dst = cl::Buffer(context, CL_MEM_READ_WRITE, sizeof(float) * pixels);
+            break;
+        case KernelRegistry::IMAGE1D:
+            dstBuffer = cl::Buffer(context, CL_MEM_READ_WRITE, sizeof(float) * pixels);
+            dst = cl::Image1DBuffer(context, CL_MEM_READ_WRITE, format, pixels, dstBuffer);
+            break;
+        default:
+            ASSERT(false, "Unknown storage type " << storage);
+    }
+
+    const double bytesImage = static_cast<double>(pixels * launches) * sizeof(float);
+    const double bytes[NUMBER_PATTERNS] = { 2.0 * bytesImage, bytesImage, bytesImage, bytesImage };
+
+    Pyramid p;
+    p.name = pyramid.name();
+    p.cols = octave.cols;
+    p.rows = octave.rows;
+    p.depth = octave.depth * launches;
+
+    for (int pattern = 0; pattern < NUMBER_PATTERNS; ++pattern)
+    {
+        cl::Kernel kernel = pyramid.getProgramCache().kernel(kernelNames[pattern]);
+        kernel.setArg(0, octave.memory);
+        kernel.setArg(1, dst);
+        kernel.setArg(2, static_cast<int>(octave.cols));
+        kernel.setArg(3, static_cast<int>(octave.rows));
+        kernel.setArg(4, radius);
+
+        const cl::NDRange global = pattern == STRIDED ? cl::NDRange(octave.rows, octave.cols, octave.depth) : cl::NDRange(octave.cols, octave.rows, octave.depth);
+
+        // Warm-up (first touch of the output and kernel upload)
+        queue.enqueueNDRangeKernel(kernel, cl::NullRange, global, cl::NullRange);
+        queue.finish();
+
+        std::vector<double> bandwidths;
+        for (int i = 0; i < repetitions; ++i)
+        {
+            double seconds = 0.0;
+            for (size_t l = 0; l < launches; ++l)
+            {
+                cl::Event event;
+                queue.enqueueNDRangeKernel(kernel, cl::NullRange, global, cl::NullRange, nullptr, &event);
+                seconds += kernelSeconds(event);
+            }
+            bandwidths.push_back(bytes[pattern] / seconds);
+        }
+        std::sort(bandwidths.begin(), bandwidths.end());
+
+        Measurement& m = p.measurements[pattern];
+        m.bytes = bytes[pattern];
+        m.best = bandwidths.back();
+        m.median = bandwidths[bandwidths.size() / 2];
+    }
+
+    pyramids.push_back(p);
+}
+
+void BandwidthProbe::print(std::ostream& stream) const
+{
+    stream << "--- Bandwidth probes (first octave, best of " << repetitions << " runs in GB/s, neighbourhood " << 2 * radius + 1 << "x" << 2 * radius + 1 << ") ---" << std::endl;
+    stream << std::left << std::setw(16) << "pyramid" << std::setw(20) << "size" << std::right;
+    for (int pattern = 0; pattern < NUMBER_PATTERNS; ++pattern)
+    {
+        stream << std::setw(15) << patternToString(static_cast<Pattern>(pattern));
+    }
+    stream << std::endl;
+
+    // The buffer is the reference of the storage types since it is the plain memory access
+    auto reference = std::find_if(pyramids.begin(), pyramids.end(), [](const Pyramid& p) { return p.name == "Buffer"; });
+
+    for (const Pyramid& p : pyramids)
+    {
+        stream << std::left << std::setw(16) << p.name << std::setw(20) << std::to_string(p.cols) + "x" + std::to_string(p.rows) + "x" + std::to_string(p.depth) << std::right;
+        for (int pattern = 0; pattern < NUMBER_PATTERNS; ++pattern)
+        {
+            std::stringstream cell;
+            cell << std::fixed << std::setprecision(1) << p.measurements[pattern].best * 1e-9;
+            if (reference != pyramids.end() && &*reference != &p)
+            {
+                cell << " (" << std::setprecision(2) << p.measurements[pattern].best / reference->measurements[pattern].best << ")";
+            }
+
+            stream << std::setw(15) << cell.str();
+        }
+        stream << std::endl;
+    }
+
+    if (reference != pyramids.end())
+    {
+        stream << "Values in parentheses are relative to the buffer pyramid" << std::endl;
+    }
+}
+
+void BandwidthProbe::writeJson(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    ASSERT(file.is_open(), "Could not open " << filename);
+
+    JsonWriter json(file);
+    json.beginObject();
+
+    json.key("radius").value(radius);
+    json.key("repetitions").value(repetitions);
+
+    json.key("pyramids").beginArray();
+    for (const Pyramid& p : pyramids)
+    {
+        json.beginObject();
+        json.key("name").value(p.name);
+        json.key("cols").value(p.cols);
+        json.key("rows").value(p.rows);
+        json.key("depth").value(p.depth);
+
+        json.key("patterns").beginArray();
+        for (int pattern = 0; pattern < NUMBER_PATTERNS; ++pattern)
+        {
+            const Measurement& m = p.measurements[pattern];
+
+            json.beginObject();
+            json.key("name").value(patternToString(static_cast<Pattern>(pattern)));
+            json.key("bytes").value(m.bytes);
+            json.key("bestGBs").value(m.best * 1e-9);
+            json.key("medianGBs").value(m.median * 1e-9);
+            json.endObject();
+        }
+        json.endArray();
+
+        json.endObject();
+    }
+    json.endArray();
+
+    json.endObject();
+}
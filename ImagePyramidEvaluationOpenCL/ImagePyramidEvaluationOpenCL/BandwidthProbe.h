@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include "opencl_common.h"
+#include "APyramid.h"
+
+/**
+ * @brief Achievable memory bandwidth of every storage type for the access patterns of the filters, independent of the filter kernels
+ *
+ * The probes read the input memory object of the first octave as allocated by createPyramid() (see APyramid::firstOctave()) and write to a memory object
+ * of the same type and size (allocated like the filter outputs). Memory objects which store only one level (image pyramid) are probed once per level of
+ * the octave so that every storage type transfers the same number of bytes. All storage types run the same kernels (kernels/filter_probes.cl), only the
+ * read and write functions differ:
+ *  - copy: every work-item reads and writes one pixel
+ *  - strided: every work-item reads one pixel but the global range is transposed so that neighbouring work-items read vertically adjacent pixels
+ *  - neighbourhood: every work-item reads the (2 * radius + 1)^2 pixels around its position (clamped at the border) like the filters without local memory
+ *  - write: every work-item writes one pixel without reading
+ *
+ * The bandwidth is computed from the unique bytes of the pattern (e.g. one read per pixel for the neighbourhood), which makes it comparable with the
+ * input and output bytes of the filters.
+ */
+class BandwidthProbe
+{
+public:
+    enum Pattern
+    {
+        COPY,
+        STRIDED,
+        NEIGHBOURHOOD,
+        WRITE,
+        NUMBER_PATTERNS
+    };
+
+    static std::string patternToString(const Pattern pattern);
+
+    struct Measurement
+    {
+        double bytes = 0.0;     //!< Unique bytes per measurement (all launches over the levels of the octave)
+        double best = 0.0;      //!< Bytes per second
+        double median = 0.0;
+    };
+
+public:
+    /**
+     * @param radius radius of the neighbourhood pattern (2 corresponds to the 5x5 filters)
+     */
+    explicit BandwidthProbe(const int radius = 2, const int repetitions = 10);
+
+    /**
+     * @brief Measures all patterns on the first octave of the pyramid (init() must have been called)
+     */
+    void add(APyramid& pyramid);
+
+    void print(std::ostream& stream) const;
+    void writeJson(const std::string& filename) const;
+
+private:
+    struct Pyramid
+    {
+        std::string name;
+        size_t cols = 0;
+        size_t rows = 0;
+        size_t depth = 0;       //!< Probed levels
+        Measurement measurements[NUMBER_PATTERNS];
+    };
+
+private:
+    const int radius;
+    const int repetitions;
+    std::vector<Pyramid> pyramids;
+};
@@ -0,0 +1,291 @@
+#include "BenchmarkStore.h"
+#include "general.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <random>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+
+namespace
+{
+    double median(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        const size_t n = values.size();
+
+        return n % 2 == 1 ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+    }
+
+    /**
+     * @brief FNV-1a (stable across compilers unlike std::hash)
+     */
+    uint64_t hash(const std::string& str)
+    {
+        uint64_t h = 14695981039346656037ull;
+        for (const char c : str)
+        {
+            h ^= static_cast<unsigned char>(c);
+            h *= 1099511628211ull;
+        }
+
+        return h;
+    }
+}
+
+void BenchmarkRun::setConfiguration(const cl::Device& device, const std::string& buildOptions)
+{
+    device.getInfo(CL_DEVICE_NAME, &this->device);
+    device.getInfo(CL_DRIVER_VERSION, &this->driver);
+    this->buildOptions = buildOptions;
+}
+
+void BenchmarkRun::add(const std::string& pyramidName, const APyramid::Method method, const int sigmaSize, const std::vector<double>& samples)
+{
+    std::vector<double>& s = this->samples[pyramidName + "/" + APyramid::methodToString(method) + "/" + std::to_string(sigmaSize)];
+    s.insert(s.end(), samples.begin(), samples.end());
+}
+
+std::string BenchmarkRun::filename() const
+{
+    std::stringstream stream;
+    stream << "baseline_" << std::hex << std::setw(16) << std::setfill('0') << hash(getConfiguration()) << ".txt";
+
+    return stream.str();
+}
+
+void BenchmarkRun::save(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    ASSERT(file.is_open(), "Could not open " << filename);
+
+    file << "device " << device << std::endl;
+    file << "driver " << driver << std::endl;
+    file << "options " << buildOptions << std::endl;
+
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& pair : samples)
+    {
+        file << "samples " << pair.first << " " << pair.second.size();
+        for (const double sample : pair.second)
+        {
+            file << " " << sample;
+        }
+        file << std::endl;
+    }
+}
+
+bool BenchmarkRun::load(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    samples.clear();
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::stringstream stream(line);
+        std::string type;
+        stream >> type;
+
+        // The configuration values may contain spaces
+        auto rest = [&stream]()
+        {
+            std::string value;
+            std::getline(stream >> std::ws, value);
+            return value;
+        };
+
+        if (type == "device")
+        {
+            device = rest();
+        }
+        else if (type == "driver")
+        {
+            driver = rest();
+        }
+        else if (type == "options")
+        {
+            buildOptions = rest();
+        }
+        else if (type == "samples")
+        {
+            std::string key;
+            size_t n = 0;
+            stream >> key >> n;
+
+            std::vector<double>& s = samples[key];
+            s.resize(n);
+            for (size_t i = 0; i < n; ++i)
+            {
+                stream >> s[i];
+            }
+            ASSERT(!stream.fail(), "The samples of " << key << " in " << filename << " are incomplete");
+        }
+    }
+
+    return true;
+}
+
+std::string BenchmarkRun::getConfiguration() const
+{
+    return device + " | " + driver + " | " + buildOptions;
+}
+
+RegressionCheck::RegressionCheck(const double alpha, const double minSlowdown, const double confidence, const int bootstrapResamples)
+    : alpha(alpha),
+      minSlowdown(minSlowdown),
+      confidence(confidence),
+      bootstrapResamples(bootstrapResamples)
+{}
+
+size_t RegressionCheck::compare(const BenchmarkRun& baseline, const BenchmarkRun& current)
+{
+    comparisons.clear();
+    missing.clear();
+
+    size_t regressions = 0;
+    for (const auto& pair : current.getSamples())
+    {
+        auto it = baseline.getSamples().find(pair.first);
+        if (it == baseline.getSamples().end() || it->second.empty() || pair.second.empty())
+        {
+            missing.push_back(pair.first);
+            continue;
+        }
+
+        Comparison c;
+        c.key = pair.first;
+        c.medianBaseline = median(it->second);
+        c.medianCurrent = median(pair.second);
+        c.ratio = c.medianCurrent / c.medianBaseline;
+        c.pValue = mannWhitneyGreater(it->second, pair.second);
+        bootstrapRatio(it->second, pair.second, c.ratioLower, c.ratioUpper);
+        c.regression = c.pValue < alpha && c.ratio > 1.0 + minSlowdown;
+
+        if (c.regression)
+        {
+            regressions++;
+        }
+
+        comparisons.push_back(c);
+    }
+
+    return regressions;
+}
+
+void RegressionCheck::print(std::ostream& stream) const
+{
+    stream << "--- Comparison with the baseline (alpha " << alpha << ", minimal slowdown " << 100.0 * minSlowdown << "%) ---" << std::endl;
+    stream << std::left << std::setw(48) << "test" << std::right << std::setw(12) << "base [us]" << std::setw(12) << "now [us]" << std::setw(9) << "ratio"
+           << std::setw(20) << "CI" << std::setw(11) << "p" << std::endl;
+
+    for (const Comparison& c : comparisons)
+    {
+        std::stringstream ci;
+        ci << std::fixed << std::setprecision(3) << "[" << c.ratioLower << ", " << c.ratioUpper << "]";
+
+        stream << std::left << std::setw(48) << c.key << std::right << std::fixed << std::setprecision(0) << std::setw(12) << c.medianBaseline << std::setw(12) << c.medianCurrent
+               << std::setprecision(3) << std::setw(9) << c.ratio << std::setw(20) << ci.str() << std::scientific << std::setprecision(1) << std::setw(11) << c.pValue
+               << std::defaultfloat << (c.regression ? "  SLOWER" : "") << std::endl;
+    }
+
+    for (const std::string& key : missing)
+    {
+        stream << key << ": not in the baseline" << std::endl;
+    }
+}
+
+double RegressionCheck::mannWhitneyGreater(const std::vector<double>& baseline, const std::vector<double>& current)
+{
+    const double n1 = static_cast<double>(current.size());
+    const double n2 = static_cast<double>(baseline.size());
+    const double n = n1 + n2;
+
+    // Ranks of the pooled samples (ties get the average rank)
+    std::vector<std::pair<double, bool>> pooled;
+    for (const double v : current)
+    {
+        pooled.push_back({ v, true });
+    }
+    for (const double v : baseline)
+    {
+        pooled.push_back({ v, false });
+    }
+    std::sort(pooled.begin(), pooled.end(), [](const std::pair<double, bool>& a, const std::pair<double, bool>& b) { return a.first < b.first; });
+
+    double rankSumCurrent = 0.0;
+    double tieCorrection = 0.0;
+    for (size_t i = 0; i < pooled.size();)
+    {
+        size_t j = i;
+        while (j + 1 < pooled.size() && pooled[j + 1].first == pooled[i].first)
+        {
+            j++;
+        }
+
+        const double rank = 0.5 * (i + j) + 1.0;
+        const double t = static_cast<double>(j - i + 1);
+        tieCorrection += t * t * t - t;
+
+        for (size_t k = i; k <= j; ++k)
+        {
+            if (pooled[k].second)
+            {
+                rankSumCurrent += rank;
+            }
+        }
+
+        i = j + 1;
+    }
+
+    const double u = rankSumCurrent - n1 * (n1 + 1.0) / 2.0;
+    const double mean = n1 * n2 / 2.0;
+    const double variance = n1 * n2 / 12.0 * ((n + 1.0) - tieCorrection / (n * (n - 1.0)));
+
+    if (variance <= 0.0)
+    {
+        return 1.0;     // All samples are equal
+    }
+
+    // Continuity correction, one-sided upper tail
+    const double z = (u - mean - 0.5) / std::sqrt(variance);
+
+    return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+
+void RegressionCheck::bootstrapRatio(const std::vector<double>& baseline, const std::vector<double>& current, double& lower, double& upper) const
+{
+    std::mt19937 generator(42);     // Fixed seed so that the report is reproducible
+    std::uniform_int_distribution<size_t> pickBaseline(0, baseline.size() - 1);
+    std::uniform_int_distribution<size_t> pickCurrent(0, current.size() - 1);
+
+    std::vector<double> ratios(bootstrapResamples);
+    std::vector<double> resampleBaseline(baseline.size());
+    std::vector<double> resampleCurrent(current.size());
+
+    for (int r = 0; r < bootstrapResamples; ++r)
+    {
+        for (double& v : resampleBaseline)
+        {
+            v = baseline[pickBaseline(generator)];
+        }
+        for (double& v : resampleCurrent)
+        {
+            v = current[pickCurrent(generator)];
+        }
+
+        ratios[r] = median(resampleCurrent) / median(resampleBaseline);
+    }
+
+    std::sort(ratios.begin(), ratios.end());
+    const double tail = (1.0 - confidence) / 2.0;
+    lower = ratios[static_cast<size_t>(tail * (bootstrapResamples - 1))];
+    upper = ratios[static_cast<size_t>((1.0 - tail) * (bootstrapResamples - 1))];
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+#include "opencl_common.h"
+#include "APyramid.h"
+
+/**
+ * @brief Per-iteration times of one benchmark run, stored per configuration (device, driver and build options) so that later runs can be compared with it
+ *
+ * The run is saved as plain text (one line per pyramid type, method and sigma size with all samples) in baseline_<hash>.txt where the hash is computed
+ * from the configuration. Runs on other devices, drivers or with other build options therefore never overwrite or gate each other.
+ */
+class BenchmarkRun
+{
+public:
+    void setConfiguration(const cl::Device& device, const std::string& buildOptions);
+
+    /**
+     * @param samples time of every iteration in microseconds
+     */
+    void add(const std::string& pyramidName, const APyramid::Method method, const int sigmaSize, const std::vector<double>& samples);
+
+    /**
+     * @return name of the baseline file of the configuration
+     */
+    std::string filename() const;
+
+    void save(const std::string& filename) const;
+
+    /**
+     * @return false if the file does not exist
+     */
+    bool load(const std::string& filename);
+
+    const std::map<std::string, std::vector<double>>& getSamples() const
+    {
+        return samples;
+    }
+
+    std::string getConfiguration() const;
+
+private:
+    std::string device;
+    std::string driver;
+    std::string buildOptions;
+    std::map<std::string, std::vector<double>> samples;    //!< Key is pyramid/method/sigma
+};
+
+/**
+ * @brief Flags statistically significant slowdowns of a run compared with a baseline run
+ *
+ * A slowdown is flagged if the one-sided Mann-Whitney U test (normal approximation with tie correction) rejects that the current times are not larger
+ * than the baseline times at the significance level and if the ratio of the medians exceeds the minimal slowdown (so that significant but irrelevant changes
+ * don't fail the gate). A bootstrap confidence interval of the ratio of the medians is reported as well.
+ */
+class RegressionCheck
+{
+public:
+    struct Comparison
+    {
+        std::string key;
+        double medianBaseline = 0.0;
+        double medianCurrent = 0.0;
+        double ratio = 0.0;             //!< Median current / median baseline
+        double ratioLower = 0.0;        //!< Bootstrap confidence interval of the ratio
+        double ratioUpper = 0.0;
+        double pValue = 1.0;            //!< One-sided: current slower than baseline
+        bool regression = false;
+    };
+
+public:
+    explicit RegressionCheck(const double alpha = 0.01, const double minSlowdown = 0.03, const double confidence = 0.95, const int bootstrapResamples = 2000);
+
+    /**
+     * @return number of regressions
+     */
+    size_t compare(const BenchmarkRun& baseline, const BenchmarkRun& current);
+
+    void print(std::ostream& stream) const;
+
+    static double mannWhitneyGreater(const std::vector<double>& baseline, const std::vector<double>& current);
+
+private:
+    void bootstrapRatio(const std::vector<double>& baseline, const std::vector<double>& current, double& lower, double& upper) const;
+
+private:
+    const double alpha;
+    const double minSlowdown;
+    const double confidence;
+    const int bootstrapResamples;
+
+    std::vector<Comparison> comparisons;
+    std::vector<std::string> missing;   //!< Keys of the current run without baseline samples
+};
@@ -0,0 +1,126 @@
+#include "FilterBank.h"
+#include "general.h"
+#include "utils.h"
+
+FilterBank::FilterBank(const int maxSigmaSize)
+    : maxSigmaSize(maxSigmaSize)
+{}
+
+void FilterBank::computeDerivativeKernels(const int sigmaSize, cv::Mat& Gx1, cv::Mat& Gx2, cv::Mat& Gy1, cv::Mat& Gy2, cv::Mat& Gx, cv::Mat& Gy)
+{
+    if (sigmaSize == 1)
+    {
+        Gx1 = (cv::Mat_<float>(3, 1) << 3, 10, 3);
+        Gx2 = (cv::Mat_<float>(1, 3) << -1, 0, 1);
+        Gy1 = (cv::Mat_<float>(3, 1) << -1, 0, 1);
+        Gy2 = (cv::Mat_<float>(1, 3) << 3, 10, 3);
+    }
+    else
+    {
+        compute_derivative_kernels(Gx1, Gx2, 0, 1, sigmaSize);  // x and y are swapped in this function; therefore, (0, 1) is the x-direction (left to right)
+        compute_derivative_kernels(Gy1, Gy2, 1, 0, sigmaSize);
+
+        Gx2 = Gx2.t();
+        Gy2 = Gy2.t();
+    }
+
+    Gx = Gx1 * Gx2;
+    Gy = Gy1 * Gy2;
+}
+
+void FilterBank::init(AOpenCLInterface* const opencl)
+{
+    filters.resize(maxSigmaSize);
+
+    // Sub-buffers must start at an address which is aligned to the base address alignment of the device (given in bits)
+    const cl_uint alignBits = opencl->getDevice().getInfo<CL_DEVICE_MEM_BASE_ADDR_ALIGN>();
+    const size_t alignFloats = std::max<size_t>(1, alignBits / (8 * sizeof(float)));
+
+    std::vector<float> packed;
+    const auto pack = [&](Filter& filter, const cv::Mat& kernel)
+    {
+        ASSERT(kernel.isContinuous(), "The kernel must be stored continuously in memory");
+
+        filter.kernel = kernel;
+        filter.offset = packed.size();
+
+        const float* kernelPtr = kernel.ptr<float>(0);
+        packed.insert(packed.end(), kernelPtr, kernelPtr + kernel.rows * kernel.cols);
+
+        // Start the next filter at an aligned position
+        packed.resize((packed.size() + alignFloats - 1) / alignFloats * alignFloats, 0.0f);
+    };
+
+    cv::Mat smoothing(maxSigmaSize, 2, CV_32FC1);
+    for (int sigmaSize = 1; sigmaSize <= maxSigmaSize; ++sigmaSize)
+    {
+        cv::Mat Gx1, Gx2, Gy1, Gy2, Gx, Gy;
+        computeDerivativeKernels(sigmaSize, Gx1, Gx2, Gy1, Gy2, Gx, Gy);
+
+        // The smoothing vector has only non-zero values at the border and in the centre
+        smoothing.at<float>(sigmaSize - 1, 0) = Gx1.at<float>(0, 0);
+        smoothing.at<float>(sigmaSize - 1, 1) = Gx1.at<float>(sigmaSize, 0);
+
+        DerivativeFilters& derivativeFilters = filters[sigmaSize - 1];
+        pack(derivativeFilters.Gx1, Gx1);
+        pack(derivativeFilters.Gx2, Gx2);
+        pack(derivativeFilters.Gy1, Gy1);
+        pack(derivativeFilters.Gy2, Gy2);
+        pack(derivativeFilters.Gx, Gx);
+        pack(derivativeFilters.Gy, Gy);
+    }
+    pack(smoothingCoefficients, smoothing);
+
+    // One allocation and one transfer for all filters
+    buffer = cl::Buffer(opencl->getContext(), CL_MEM_READ_ONLY, sizeof(float) * packed.size());
+    opencl->getQueue().enqueueWriteBuffer(buffer, CL_BLOCKING, 0, sizeof(float) * packed.size(), packed.data());
+
+    const auto createSubBuffer = [&](Filter& filter)
+    {
+        cl_buffer_region region = { sizeof(float) * filter.offset, sizeof(float) * filter.kernel.rows * filter.kernel.cols };
+        filter.buffer = buffer.createSubBuffer(CL_MEM_READ_ONLY, CL_BUFFER_CREATE_TYPE_REGION, &region);
+    };
+
+    for (DerivativeFilters& derivativeFilters : filters)
+    {
+        createSubBuffer(derivativeFilters.Gx1);
+        createSubBuffer(derivativeFilters.Gx2);
+        createSubBuffer(derivativeFilters.Gy1);
+        createSubBuffer(derivativeFilters.Gy2);
+        createSubBuffer(derivativeFilters.Gx);
+        createSubBuffer(derivativeFilters.Gy);
+    }
+    createSubBuffer(smoothingCoefficients);
+
+    initialized = true;
+}
+
+bool FilterBank::isInitialized() const
+{
+    return initialized;
+}
+
+const FilterBank::DerivativeFilters& FilterBank::get(const int sigmaSize) const
+{
+    ASSERT(initialized, "The filter bank must be initialized before it can be used");
+    ASSERT(sigmaSize >= 1 && sigmaSize <= maxSigmaSize, "No filters available for the sigma size " << sigmaSize);
+
+    return filters[sigmaSize - 1];
+}
+
+const FilterBank::Filter& FilterBank::getSmoothingCoefficients() const
+{
+    ASSERT(initialized, "The filter bank must be initialized before it can be used");
+
+    return smoothingCoefficients;
+}
+
+int FilterBank::getMaxSigmaSize() const
+{
+    return maxSigmaSize;
+}
+
+const cl::Buffer& FilterBank::getBuffer() const
+{
+    return buffer;
+}
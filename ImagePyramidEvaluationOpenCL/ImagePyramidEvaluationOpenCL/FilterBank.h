@@ -0,0 +1,63 @@
+#pragma once
+
+#include "opencl_common.h"
+#include "AOpenCLInterface.h"
+#include <opencv2/core.hpp>
+#include <vector>
+
+/**
+ * @brief Stores the derivative filters (Gx/Gy, full and separable) for all sigma sizes in one constant buffer on the device
+ *
+ * All coefficients are packed and uploaded once in init(). Afterwards, every filter is referenced by its offset inside the packed buffer
+ * (exposed as sub-buffer) so that setting a filter for a run does neither allocate device memory nor enqueue a host --> device transfer.
+ */
+class FilterBank
+{
+public:
+    struct Filter
+    {
+        cv::Mat kernel;     //!< Host copy of the filter values (e.g. to know the filter size)
+        size_t offset = 0;  //!< Position of the first filter value in the packed buffer (number of floats)
+        cl::Buffer buffer;  //!< Sub-buffer of the packed buffer which starts at the offset
+    };
+
+    struct DerivativeFilters
+    {
+        Filter Gx1;
+        Filter Gx2;
+        Filter Gy1;
+        Filter Gy2;
+        Filter Gx;
+        Filter Gy;
+    };
+
+public:
+    explicit FilterBank(const int maxSigmaSize = 4);
+
+    /**
+    * @brief Computes the derivative kernels in x- and y-direction for the given sigma size
+    * @param sigmaSize derivative size (1 = 3x3 Scharr filter, 2 = 5x5 filter etc.)
+    * @param Gx1 column vector of the separable Gx filter
+    * @param Gx2 row vector of the separable Gx filter
+    * @param Gy1 column vector of the separable Gy filter
+    * @param Gy2 row vector of the separable Gy filter
+    * @param Gx full Gx filter (Gx1 * Gx2)
+    * @param Gy full Gy filter (Gy1 * Gy2)
+    */
+    static void computeDerivativeKernels(const int sigmaSize, cv::Mat& Gx1, cv::Mat& Gx2, cv::Mat& Gy1, cv::Mat& Gy2, cv::Mat& Gx, cv::Mat& Gy);
+
+    void init(AOpenCLInterface* const opencl);
+    bool isInitialized() const;
+
+    const DerivativeFilters& get(const int sigmaSize) const;
+    const Filter& getSmoothingCoefficients() const;
+    int getMaxSigmaSize() const;
+    const cl::Buffer& getBuffer() const;
+
+private:
+    int maxSigmaSize;
+    std::vector<DerivativeFilters> filters;     // Index is sigmaSize - 1
+    Filter smoothingCoefficients;               // Border and centre value of the smoothing vector (one row per sigma size)
+    cl::Buffer buffer;
+    bool initialized = false;
+};
@@ -0,0 +1,160 @@
+#include "FilterCpu.h"
+#include "FilterCpuImpl.h"
+#include "general.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+namespace
+{
+    void cpuid(int info[4], const int leaf, const int subleaf)
+    {
+#ifdef _MSC_VER
+        __cpuidex(info, leaf, subleaf);
+#else
+        __cpuid_count(leaf, subleaf, info[0], info[1], info[2], info[3]);
+#endif
+    }
+
+    /**
+     * @brief Register states which are saved by the OS (XCR0)
+     */
+    unsigned long long xgetbv()
+    {
+#ifdef _MSC_VER
+        return _xgetbv(0);
+#else
+        unsigned int eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+    }
+
+    FilterCpu::Isa detectIsa()
+    {
+        int info1[4];
+        cpuid(info1, 1, 0);
+        const bool fma = (info1[2] & (1 << 12)) != 0;
+        const bool osxsave = (info1[2] & (1 << 27)) != 0;
+        const bool avx = (info1[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx)
+        {
+            return FilterCpu::SSE;
+        }
+
+        int info7[4];
+        cpuid(info7, 7, 0);
+        const bool avx2 = (info7[1] & (1 << 5)) != 0;
+        const bool avx512f = (info7[1] & (1 << 16)) != 0;
+
+        const unsigned long long xcr0 = xgetbv();
+        const bool osYmm = (xcr0 & 0x6) == 0x6;     // SSE and AVX state
+        const bool osZmm = (xcr0 & 0xE6) == 0xE6;   // Additionally the opmask and the upper ZMM registers
+
+        if (FilterCpuAvx512::compiled && avx512f && osZmm)
+        {
+            return FilterCpu::AVX512;
+        }
+        if (FilterCpuAvx2::compiled && avx2 && fma && osYmm)
+        {
+            return FilterCpu::AVX2;
+        }
+
+        return FilterCpu::SSE;
+    }
+
+    size_t detectCacheSizeL2()
+    {
+        int info[4];
+        cpuid(info, 0x80000000, 0);
+        if (static_cast<unsigned int>(info[0]) >= 0x80000006)
+        {
+            // ECX[31:16] is the L2 size in KiB (Intel and AMD)
+            cpuid(info, 0x80000006, 0);
+            const size_t size = (static_cast<unsigned int>(info[2]) >> 16) * 1024;
+            if (size > 0)
+            {
+                return size;
+            }
+        }
+
+        return 256 * 1024;
+    }
+
+    void checkFilter(const cv::Mat& kernel)
+    {
+        ASSERT(kernel.type() == CV_32FC1, "Only float filters are supported");
+        ASSERT(kernel.rows % 2 == 1 && kernel.cols % 2 == 1, "The filter size must be odd");
+        ASSERT(kernel.rows <= FilterCpuImpl::maxFilterSize && kernel.cols <= FilterCpuImpl::maxFilterSize, "The filter is larger than "
+               << FilterCpuImpl::maxFilterSize << "x" << FilterCpuImpl::maxFilterSize);
+    }
+}
+
+std::string FilterCpu::isaToString(const Isa isa)
+{
+    switch (isa)
+    {
+        case SSE: return "SSE";
+        case AVX2: return "AVX2";
+        case AVX512: return "AVX-512";
+        default: return "";
+    }
+}
+
+FilterCpu::Isa FilterCpu::bestIsa()
+{
+    static const Isa isa = detectIsa();
+    return isa;
+}
+
+size_t FilterCpu::cacheSizeL2()
+{
+    static const size_t size = detectCacheSizeL2();
+    return size;
+}
+
+void FilterCpu::halfsample(const Isa isa, const cv::Mat& src, cv::Mat& dst, const cv::Rect& tile)
+{
+    ASSERT(src.type() == CV_32FC1 && dst.type() == CV_32FC1, "Only float images are supported");
+    ASSERT(dst.cols == src.cols / 2 && dst.rows == src.rows / 2, "The destination must have half the size of the source");
+
+    switch (isa)
+    {
+        case AVX512:
+            FilterCpuAvx512::halfsample(src, dst, tile);
+            break;
+        case AVX2:
+            FilterCpuAvx2::halfsample(src, dst, tile);
+            break;
+        default:
+            FilterCpuSse::halfsample(src, dst, tile);
+            break;
+    }
+}
+
+void FilterCpu::filter(const Isa isa, const cv::Mat& src, const cv::Mat& kernel1, const cv::Mat* kernel2, cv::Mat& dst1, cv::Mat* dst2, const cv::Rect& tile)
+{
+    checkFilter(kernel1);
+    if (kernel2)
+    {
+        ASSERT(kernel2->size() == kernel1.size() && dst2, "The second filter must be of the same size and needs an output");
+        checkFilter(*kernel2);
+    }
+    ASSERT(src.type() == CV_32FC1 && dst1.type() == CV_32FC1 && dst1.size() == src.size(), "The output must be a float image of the size of the input");
+
+    switch (isa)
+    {
+        case AVX512:
+            FilterCpuAvx512::filter(src, kernel1, kernel2, dst1, dst2, tile);
+            break;
+        case AVX2:
+            FilterCpuAvx2::filter(src, kernel1, kernel2, dst1, dst2, tile);
+            break;
+        default:
+            FilterCpuSse::filter(src, kernel1, kernel2, dst1, dst2, tile);
+            break;
+    }
+}
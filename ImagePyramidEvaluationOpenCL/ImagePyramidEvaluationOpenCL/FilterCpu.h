@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <opencv2/core.hpp>
+
+/**
+ * @brief SIMD implementations of the halfsample and filter kernels for the CPU pyramid, each function processes one tile of the output
+ *
+ * The functions compute exactly the same operations in the same order as the OpenCL kernels (fed_resize and the filter kernels with BORDER_REFLECT_101):
+ * the filter taps are accumulated row by row starting with 0 and each tap is a fused multiply-add, i.e. the results are bit-identical to a device which
+ * contracts the filter sums to FMAs (the default of OpenCL C). Taps which are zero in all filters are skipped like in the dilated kernels (this does not
+ * change the sums). The SSE fallback has no FMA and rounds the products separately.
+ *
+ * There is one translation unit per instruction set which is compiled with the corresponding architecture flag. An instruction set is only used if the
+ * CPU and the OS support it and if the compiler supports the flag (e.g. AVX-512 needs at least Visual Studio 2017).
+ */
+namespace FilterCpu
+{
+    enum Isa
+    {
+        SSE,
+        AVX2,       //!< AVX2 with FMA
+        AVX512      //!< AVX-512F
+    };
+
+    std::string isaToString(const Isa isa);
+
+    /**
+     * @return best instruction set supported by the CPU, the OS and the build
+     */
+    Isa bestIsa();
+
+    /**
+     * @return size of the L2 cache of one core in bytes (256 KiB if the CPU does not report it)
+     */
+    size_t cacheSizeL2();
+
+    /**
+     * @brief Halfsamples the tile of dst (2x2 mean of src)
+     */
+    void halfsample(const Isa isa, const cv::Mat& src, cv::Mat& dst, const cv::Rect& tile);
+
+    /**
+     * @brief Filters the tile of dst1 (and dst2 if kernel2 is given) with BORDER_REFLECT_101
+     * @param kernel2 second filter of the same size (double methods) or nullptr
+     */
+    void filter(const Isa isa, const cv::Mat& src, const cv::Mat& kernel1, const cv::Mat* kernel2, cv::Mat& dst1, cv::Mat* dst2, const cv::Rect& tile);
+}
@@ -0,0 +1,62 @@
+#include "FilterCpuImpl.h"
+
+// Compiled with /arch:AVX2 (see the project settings of this file)
+#ifdef __AVX2__
+#include <immintrin.h>
+
+namespace
+{
+    struct VecAvx2
+    {
+        typedef __m256 Type;
+        static const int width = 8;
+
+        static Type zero() { return _mm256_setzero_ps(); }
+        static Type set1(const float v) { return _mm256_set1_ps(v); }
+        static Type load(const float* p) { return _mm256_loadu_ps(p); }
+        static void store(float* p, const Type v) { _mm256_storeu_ps(p, v); }
+        static Type add(const Type a, const Type b) { return _mm256_add_ps(a, b); }
+        static Type mul(const Type a, const Type b) { return _mm256_mul_ps(a, b); }
+        static Type madd(const Type a, const Type b, const Type c) { return _mm256_fmadd_ps(a, b, c); }
+        static float madd(const float a, const float b, const float c) { return _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(a), _mm_set_ss(b), _mm_set_ss(c))); }
+
+        static void deinterleave(const float* p, Type& even, Type& odd)
+        {
+            const Type a = _mm256_loadu_ps(p);
+            const Type b = _mm256_loadu_ps(p + 8);
+
+            // The shuffles work per 128 bit lane (a0 a2 b0 b2 | a4 a6 b4 b6), the permutation restores the order of the 64 bit pairs
+            const Type evenLanes = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            const Type oddLanes = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            even = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(evenLanes), _MM_SHUFFLE(3, 1, 2, 0)));
+            odd = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(oddLanes), _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+    };
+}
+
+namespace FilterCpuAvx2
+{
+    extern const bool compiled = true;
+
+    void halfsample(const cv::Mat& src, cv::Mat& dst, const cv::Rect& tile)
+    {
+        FilterCpuImpl::halfsample<VecAvx2>(src, dst, tile);
+    }
+
+    void filter(const cv::Mat& src, const cv::Mat& kernel1, const cv::Mat* kernel2, cv::Mat& dst1, cv::Mat* dst2, const cv::Rect& tile)
+    {
+        FilterCpuImpl::filter<VecAvx2>(src, kernel1, kernel2, dst1, dst2, tile);
+    }
+}
+#else
+namespace FilterCpuAvx2
+{
+    extern const bool compiled = false;
+
+    void halfsample(const cv::Mat&, cv::Mat&, const cv::Rect&)
+    {}
+
+    void filter(const cv::Mat&, const cv::Mat&, const cv::Mat*, cv::Mat&, cv::Mat*, const cv::Rect&)
+    {}
+}
+#endif
@@ -0,0 +1,58 @@
+#include "FilterCpuImpl.h"
+
+// Compiled with /arch:AVX512 if the toolset supports it (v141 or newer, see the project settings of this file), otherwise only the stubs are compiled
+#ifdef __AVX512F__
+#include <immintrin.h>
+
+namespace
+{
+    struct VecAvx512
+    {
+        typedef __m512 Type;
+        static const int width = 16;
+
+        static Type zero() { return _mm512_setzero_ps(); }
+        static Type set1(const float v) { return _mm512_set1_ps(v); }
+        static Type load(const float* p) { return _mm512_loadu_ps(p); }
+        static void store(float* p, const Type v) { _mm512_storeu_ps(p, v); }
+        static Type add(const Type a, const Type b) { return _mm512_add_ps(a, b); }
+        static Type mul(const Type a, const Type b) { return _mm512_mul_ps(a, b); }
+        static Type madd(const Type a, const Type b, const Type c) { return _mm512_fmadd_ps(a, b, c); }
+        static float madd(const float a, const float b, const float c) { return _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(a), _mm_set_ss(b), _mm_set_ss(c))); }
+
+        static void deinterleave(const float* p, Type& even, Type& odd)
+        {
+            const Type a = _mm512_loadu_ps(p);
+            const Type b = _mm512_loadu_ps(p + 16);
+            even = _mm512_permutex2var_ps(a, _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30), b);
+            odd = _mm512_permutex2var_ps(a, _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31), b);
+        }
+    };
+}
+
+namespace FilterCpuAvx512
+{
+    extern const bool compiled = true;
+
+    void halfsample(const cv::Mat& src, cv::Mat& dst, const cv::Rect& tile)
+    {
+        FilterCpuImpl::halfsample<VecAvx512>(src, dst, tile);
+    }
+
+    void filter(const cv::Mat& src, const cv::Mat& kernel1, const cv::Mat* kernel2, cv::Mat& dst1, cv::Mat* dst2, const cv::Rect& tile)
+    {
+        FilterCpuImpl::filter<VecAvx512>(src, kernel1, kernel2, dst1, dst2, tile);
+    }
+}
+#else
+namespace FilterCpuAvx512
+{
+    extern const bool compiled = false;
+
+    void halfsample(const cv::Mat&, cv::Mat&, const cv::Rect&)
+    {}
+
+    void filter(const cv::Mat&, const cv::Mat&, const cv::Mat*, cv::Mat&, cv::Mat*, const cv::Rect&)
+    {}
+}
+#endif
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+
+/*
+ * Instruction set independent implementation of the CPU kernels, included by the translation units of the instruction sets (FilterCpuSse.cpp etc.).
+ * V provides the vector type and its operations:
+ *  - Type, width
+ *  - zero(), set1(v), load(p), store(p, v), add(a, b), mul(a, b)
+ *  - madd(a, b, c) = a * b + c for vectors and scalars (rounded like the vector version)
+ *  - deinterleave(p, even, odd): loads 2 * width floats and splits them into the even and odd elements
+ *
+ * Everything is in an unnamed namespace and no standard library templates are used since the translation units are compiled with different architecture
+ * flags: the linker could otherwise pick e.g. the AVX2 instantiation of a shared inline function for the SSE translation unit.
+ */
+namespace FilterCpuImpl
+{
+namespace
+{
+    const int maxFilterSize = 15;
+
+    struct Tap
+    {
+        int row;
+        int col;
+        float value1;
+        float value2;
+    };
+
+    /**
+     * @brief Same as borderCoordinate() of the kernels for BORDER_REFLECT_101
+     */
+    inline int reflect101(const int coord, const int size)
+    {
+        if (coord < 0)
+        {
+            return -coord;
+        }
+        if (coord >= size)
+        {
+            return size - (coord - size + 1) - 1;
+        }
+
+        return coord;
+    }
+
+    inline int minimum(const int a, const int b)
+    {
+        return a < b ? a : b;
+    }
+
+    inline int maximum(const int a, const int b)
+    {
+        return a > b ? a : b;
+    }
+
+    inline const float* row(const cv::Mat& img, const int y)
+    {
+        return reinterpret_cast<const float*>(img.data + y * img.step.p[0]);
+    }
+
+    inline float* row(cv::Mat& img, const int y)
+    {
+        return reinterpret_cast<float*>(img.data + y * img.step.p[0]);
+    }
+
+    template <class V>
+    void halfsample(const cv::Mat& src, cv::Mat& dst, const cv::Rect& tile)
+    {
+        const typename V::Type scale = V::set1(0.25f);
+        const int colsEnd = tile.x + tile.width;
+
+        for (int y = tile.y; y < tile.y + tile.height; ++y)
+        {
+            const float* src0 = row(src, minimum(2 * y, src.rows - 1));
+            const float* src1 = row(src, minimum(2 * y + 1, src.rows - 1));
+            float* out = row(dst, y);
+
+            // Since dst.cols = src.cols / 2, the loads of the full vectors stay inside the row
+            int x = tile.x;
+            for (; x + V::width <= colsEnd; x += V::width)
+            {
+                typename V::Type a, b, c, d;
+                V::deinterleave(src0 + 2 * x, a, b);
+                V::deinterleave(src1 + 2 * x, c, d);
+
+                V::store(out + x, V::mul(V::add(V::add(V::add(a, b), c), d), scale));
+            }
+
+            for (; x < colsEnd; ++x)
+            {
+                const int x0 = minimum(2 * x, src.cols - 1);
+                const int x1 = minimum(2 * x + 1, src.cols - 1);
+
+                out[x] = (((src0[x0] + src0[x1]) + src1[x0]) + src1[x1]) * 0.25f;
+            }
+        }
+    }
+
+    template <class V, bool Double>
+    void filter(const cv::Mat& src, const cv::Mat& kernel1, const cv::Mat* kernel2, cv::Mat& dst1, cv::Mat* dst2, const cv::Rect& tile)
+    {
+        const int rowsHalf = kernel1.rows / 2;
+        const int colsHalf = kernel1.cols / 2;
+
+        // Taps in the order of the kernels (row-wise), relative to the centre
+        Tap taps[maxFilterSize * maxFilterSize];
+        int numberTaps = 0;
+        for (int ky = 0; ky < kernel1.rows; ++ky)
+        {
+            for (int kx = 0; kx < kernel1.cols; ++kx)
+            {
+                const float value1 = row(kernel1, ky)[kx];
+                const float value2 = Double ? row(*kernel2, ky)[kx] : 0.0f;
+                if (value1 != 0.0f || value2 != 0.0f)
+                {
+                    taps[numberTaps++] = { ky - rowsHalf, kx - colsHalf, value1, value2 };
+                }
+            }
+        }
+
+        // Columns where all taps are inside the image
+        const int colsEnd = tile.x + tile.width;
+        const int colsInnerBegin = minimum(maximum(tile.x, colsHalf), colsEnd);
+        const int colsInnerEnd = maximum(minimum(colsEnd, src.cols - colsHalf), colsInnerBegin);
+
+        const float* rowsSrc[maxFilterSize];
+        for (int y = tile.y; y < tile.y + tile.height; ++y)
+        {
+            for (int ky = 0; ky < kernel1.rows; ++ky)
+            {
+                rowsSrc[ky] = row(src, reflect101(y + ky - rowsHalf, src.rows));
+            }
+
+            float* out1 = row(dst1, y);
+            float* out2 = Double ? row(*dst2, y) : nullptr;
+
+            auto pixel = [&](const int x)
+            {
+                float sum1 = 0.0f;
+                float sum2 = 0.0f;
+                for (int t = 0; t < numberTaps; ++t)
+                {
+                    const Tap& tap = taps[t];
+                    const float color = rowsSrc[tap.row + rowsHalf][reflect101(x + tap.col, src.cols)];
+                    sum1 = V::madd(color, tap.value1, sum1);
+                    if (Double)
+                    {
+                        sum2 = V::madd(color, tap.value2, sum2);
+                    }
+                }
+
+                out1[x] = sum1;
+                if (Double)
+                {
+                    out2[x] = sum2;
+                }
+            };
+
+            int x = tile.x;
+            for (; x < colsInnerBegin; ++x)
+            {
+                pixel(x);
+            }
+
+            for (; x + V::width <= colsInnerEnd; x += V::width)
+            {
+                typename V::Type sum1 = V::zero();
+                typename V::Type sum2 = V::zero();
+                for (int t = 0; t < numberTaps; ++t)
+                {
+                    const Tap& tap = taps[t];
+                    const typename V::Type color = V::load(rowsSrc[tap.row + rowsHalf] + x + tap.col);
+                    sum1 = V::madd(color, V::set1(tap.value1), sum1);
+                    if (Double)
+                    {
+                        sum2 = V::madd(color, V::set1(tap.value2), sum2);
+                    }
+                }
+
+                V::store(out1 + x, sum1);
+                if (Double)
+                {
+                    V::store(out2 + x, sum2);
+                }
+            }
+
+            for (; x < colsEnd; ++x)
+            {
+                pixel(x);
+            }
+        }
+    }
+
+    template <class V>
+    void filter(const cv::Mat& src, const cv::Mat& kernel1, const cv::Mat* kernel2, cv::Mat& dst1, cv::Mat* dst2, const cv::Rect& tile)
+    {
+        if (kernel2)
+        {
+            filter<V, true>(src, kernel1, kernel2, dst1, dst2, tile);
+        }
+        else
+        {
+            filter<V, false>(src, kernel1, kernel2, dst1, dst2, tile);
+        }
+    }
+}
+}
+
+/*
+ * Entry points of the translation units of the instruction sets. compiled is false if the compiler did not generate the instruction set (the functions
+ * must not be called in this case).
+ */
+#define FILTER_CPU_DECLARE_ISA(ns) \
+    namespace ns \
+    { \
+        extern const bool compiled; \
+        void halfsample(const cv::Mat& src, cv::Mat& dst, const cv::Rect& tile); \
+        void filter(const cv::Mat& src, const cv::Mat& kernel1, const cv::Mat* kernel2, cv::Mat& dst1, cv::Mat* dst2, const cv::Rect& tile); \
+    }
+
+FILTER_CPU_DECLARE_ISA(FilterCpuSse)
+FILTER_CPU_DECLARE_ISA(FilterCpuAvx2)
+FILTER_CPU_DECLARE_ISA(FilterCpuAvx512)
@@ -0,0 +1,45 @@
+#include "FilterCpuImpl.h"
+#include <emmintrin.h>
+
+namespace
+{
+    struct VecSse
+    {
+        typedef __m128 Type;
+        static const int width = 4;
+
+        static Type zero() { return _mm_setzero_ps(); }
+        static Type set1(const float v) { return _mm_set1_ps(v); }
+        static Type load(const float* p) { return _mm_loadu_ps(p); }
+        static void store(float* p, const Type v) { _mm_storeu_ps(p, v); }
+        static Type add(const Type a, const Type b) { return _mm_add_ps(a, b); }
+        static Type mul(const Type a, const Type b) { return _mm_mul_ps(a, b); }
+
+        // No FMA, the product is rounded
+        static Type madd(const Type a, const Type b, const Type c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+        static float madd(const float a, const float b, const float c) { return a * b + c; }
+
+        static void deinterleave(const float* p, Type& even, Type& odd)
+        {
+            const Type a = _mm_loadu_ps(p);
+            const Type b = _mm_loadu_ps(p + 4);
+            even = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            odd = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        }
+    };
+}
+
+namespace FilterCpuSse
+{
+    extern const bool compiled = true;     // SSE2 is part of x64
+
+    void halfsample(const cv::Mat& src, cv::Mat& dst, const cv::Rect& tile)
+    {
+        FilterCpuImpl::halfsample<VecSse>(src, dst, tile);
+    }
+
+    void filter(const cv::Mat& src, const cv::Mat& kernel1, const cv::Mat* kernel2, cv::Mat& dst1, cv::Mat* dst2, const cv::Rect& tile)
+    {
+        FilterCpuImpl::filter<VecSse>(src, kernel1, kernel2, dst1, dst2, tile);
+    }
+}
@@ -0,0 +1,155 @@
+#include "FilterDecomposition.h"
+#include "general.h"
+#include <limits>
+#include <cmath>
+#include <algorithm>
+
+// Rough costs per pixel in units of one global read (from the cache)
+static const double costGlobalTap = 1.0;
+static const double costLocalTap = 0.25;        // Cheaper than a global read but the image patch must be loaded to local memory first
+static const double costIntermediate = 2.0;     // Writing and reading an intermediate image
+static const double costAccumulate = 3.0;       // Reading two images and writing the sum
+static const int maxLocalSize = 21;             // Largest filter supported by the local kernels (LOCAL_SIZE_*_21x21)
+static const int localSize = 16;                // Work-group size in each dimension
+
+FilterDecomposition::FilterDecomposition(const cv::Mat& filter, const double tolerance)
+    : filter(filter)
+{
+    ASSERT(!filter.empty(), "Kernel must be non-empty");
+    ASSERT(filter.type() == CV_32FC1, "Only single-chanel float type filters are supported");
+    ASSERT(filter.rows % 2 == 1 && filter.cols % 2 == 1, "The filter size must be odd");
+
+    // Vectors are already separable and need no decomposition (the second pass would be a 1x1 filter). For non-square filters, the column and row vectors
+    // have different sizes which the separable passes support since every pass uses its own filter size
+    if (filter.rows > 1 && filter.cols > 1)
+    {
+        cv::Mat filter64;
+        filter.convertTo(filter64, CV_64FC1);
+
+        cv::Mat w, u, vt;
+        cv::SVD::compute(filter64, w, u, vt);
+
+        const double maxSingularValue = w.at<double>(0);
+        for (int i = 0; i < w.rows; ++i)
+        {
+            const double singularValue = w.at<double>(i);
+            if (singularValue <= tolerance * maxSingularValue || singularValue == 0.0)
+            {
+                break;
+            }
+
+            // Distribute the singular value equally to both vectors
+            Term term;
+            cv::Mat column = u.col(i) * std::sqrt(singularValue);
+            cv::Mat row = vt.row(i) * std::sqrt(singularValue);
+            column.convertTo(term.column, CV_32FC1);
+            row.convertTo(term.row, CV_32FC1);
+
+            terms.push_back(term);
+        }
+    }
+
+    // A rank 1 filter is always executed separably since it needs the fewest taps (rows + cols instead of rows * cols). The cost model can't resolve the
+    // difference for small filters where the tile load of the local kernel dominates
+    if (getRank() == 1)
+    {
+        strategy = SEPARABLE;
+        return;
+    }
+
+    // Select the cheapest strategy for all other filters
+    double minCost = std::numeric_limits<double>::infinity();
+    for (Strategy s : { SEPARABLE_SUM, SPARSE, DENSE_LOCAL, DENSE })
+    {
+        const double c = cost(s);
+        if (c < minCost)
+        {
+            minCost = c;
+            strategy = s;
+        }
+    }
+}
+
+cv::Size FilterDecomposition::dilation(const cv::Mat& filter)
+{
+    if (std::max(filter.rows, filter.cols) <= 3 || filter.rows % 2 == 0 || filter.cols % 2 == 0)
+    {
+        return cv::Size();
+    }
+
+    // Vectors are only dilated in the direction of their size
+    const cv::Size dilation(filter.cols / 2, filter.rows / 2);
+    for (int y = 0; y < filter.rows; ++y)
+    {
+        for (int x = 0; x < filter.cols; ++x)
+        {
+            const bool onGridY = dilation.height == 0 || y % dilation.height == 0;
+            const bool onGridX = dilation.width == 0 || x % dilation.width == 0;
+            if (filter.at<float>(y, x) != 0.0f && (!onGridY || !onGridX))
+            {
+                return cv::Size();
+            }
+        }
+    }
+
+    return dilation;
+}
+
+const cv::Mat& FilterDecomposition::getFilter() const
+{
+    return filter;
+}
+
+FilterDecomposition::Strategy FilterDecomposition::getStrategy() const
+{
+    return strategy;
+}
+
+void FilterDecomposition::setStrategy(const Strategy strategy)
+{
+    ASSERT(cost(strategy) < std::numeric_limits<double>::infinity(), "The strategy " << strategyToString(strategy) << " can't be applied to the filter");
+
+    this->strategy = strategy;
+}
+
+int FilterDecomposition::getRank() const
+{
+    return static_cast<int>(terms.size());
+}
+
+const std::vector<FilterDecomposition::Term>& FilterDecomposition::getTerms() const
+{
+    return terms;
+}
+
+double FilterDecomposition::cost(Strategy strategy) const
+{
+    const double infinity = std::numeric_limits<double>::infinity();
+    const int rank = getRank();
+    const double costTerm = (filter.rows + filter.cols) * costGlobalTap + costIntermediate;
+
+    switch (strategy)
+    {
+        case SEPARABLE:
+            return rank == 1 ? costTerm : infinity;
+        case SEPARABLE_SUM:
+            return rank > 1 ? rank * costTerm + (rank - 1) * costAccumulate : infinity;
+        case SPARSE:
+            return dilation(filter) != cv::Size() ? cv::countNonZero(filter) * costGlobalTap : infinity;
+        case DENSE_LOCAL:
+        {
+            if (filter.rows > maxLocalSize || filter.cols > maxLocalSize)
+            {
+                return infinity;
+            }
+
+            // Every pixel of the image patch (including the padding) is loaded once per work-group
+            const double costLoad = static_cast<double>((localSize + filter.rows - 1) * (localSize + filter.cols - 1)) / (localSize * localSize) * costGlobalTap;
+            return costLoad + filter.rows * filter.cols * costLocalTap;
+        }
+        case DENSE:
+            return filter.rows * filter.cols * costGlobalTap;
+        default:
+            return infinity;
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Decomposes an arbitrary 2D filter and selects the cheapest way to execute it with the existing filter kernels
+ *
+ * The filter is decomposed via SVD into a sum of separable filters (column * row, also for non-square filters). Rank 1 filters are always executed as one
+ * separable filter. For all other filters, one of the following strategies is chosen based on a simple cost model (global reads per pixel): a sum of separable
+ * filters (rank k), the dilated 3x3 filter (sparse filters) or the full filter with local memory.
+ */
+class FilterDecomposition
+{
+public:
+    enum Strategy
+    {
+        SEPARABLE,          //!< Rank 1 filter, one separable pass
+        SEPARABLE_SUM,      //!< Rank k filter, sum of k separable passes
+        SPARSE,             //!< Non-zero values only on the dilated 3x3 grid
+        DENSE_LOCAL,        //!< Full filter using local memory (up to 21x21)
+        DENSE               //!< Full filter without local memory (larger filters)
+    };
+
+    static std::string strategyToString(Strategy strategy)
+    {
+        switch (strategy)
+        {
+            case SEPARABLE: return "separable";
+            case SEPARABLE_SUM: return "separableSum";
+            case SPARSE: return "sparse";
+            case DENSE_LOCAL: return "denseLocal";
+            case DENSE: return "dense";
+            default: return "";
+        }
+    }
+
+    struct Term
+    {
+        cv::Mat column;     //!< Column vector (applied first)
+        cv::Mat row;        //!< Row vector (applied second)
+    };
+
+public:
+    /**
+    * @brief Decomposes the filter and selects the execution strategy
+    * @param filter single-channel float filter with odd size (rows and cols may differ)
+    * @param tolerance singular values smaller than tolerance * (largest singular value) are considered to be zero
+    */
+    explicit FilterDecomposition(const cv::Mat& filter, const double tolerance = 1e-6);
+
+    /**
+    * @brief Checks whether the filter has only non-zero values at the rows 0, rows / 2 and rows - 1 and the cols 0, cols / 2 and cols - 1 (dilated 3x3
+    * filter, row and column vectors are dilated 1x3 and 3x1 filters)
+    * @return distance between the non-zero taps in each direction (0 for a direction of size 1) or an empty size if the filter has not this structure
+    */
+    static cv::Size dilation(const cv::Mat& filter);
+
+    const cv::Mat& getFilter() const;
+    Strategy getStrategy() const;
+
+    /**
+    * @brief Overrides the selected strategy (e.g. to validate every strategy which can be applied to the filter)
+    */
+    void setStrategy(const Strategy strategy);
+    int getRank() const;
+    const std::vector<Term>& getTerms() const;
+
+    /**
+    * @brief Estimated costs for the given strategy (global reads per pixel) or infinity if the strategy can't be applied to the filter
+    */
+    double cost(Strategy strategy) const;
+
+private:
+    cv::Mat filter;
+    std::vector<Term> terms;
+    Strategy strategy = DENSE;
+};
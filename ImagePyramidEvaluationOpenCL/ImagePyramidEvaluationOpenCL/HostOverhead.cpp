@@ -0,0 +1,186 @@
+#include "HostOverhead.h"
+#include "JsonWriter.h"
+#include "general.h"
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+static const int argumentsPerLaunch = 4;    // Typical number of setArg calls of the filter kernels
+
+HostOverhead::HostOverhead(const size_t batches, const size_t callsPerBatch, const size_t imageSize)
+    : batches(batches),
+      callsPerBatch(callsPerBatch),
+      imageSize(imageSize)
+{}
+
+void HostOverhead::add(OpenCLInterface& opencl, ProgramCache& programs, const std::string& pyramidName)
+{
+    const KernelRegistry::Storage storage = programs.getStorage();
+    cl::Context& context = opencl.getContext();
+    cl::CommandQueue& queue = opencl.getQueue();
+
+    cl::Kernel kernelEmpty = programs.kernel("overhead_empty");
+
+    // One memory object of the storage type (the buffers are as large as the image)
+    const cl::ImageFormat format(CL_R, CL_FLOAT);
+    const size_t bytes = imageSize * imageSize * sizeof(float);
+    cl::Buffer buffer(context, CL_MEM_READ_WRITE, bytes);
+    cl::Image2D image2D(context, CL_MEM_READ_WRITE, format, imageSize, imageSize);
+    cl::Image2DArray image2DArray(context, CL_MEM_READ_WRITE, format, 4, imageSize, imageSize, 0, 0);
+    cl::Image1DBuffer image1D(context, CL_MEM_READ_WRITE, format, imageSize * imageSize, buffer);
+
+    std::function<void()> setArg;
+    std::function<void()> getInfo;
+    std::function<void()> allocate;
+    switch (storage)
+    {
+        case KernelRegistry::IMAGES:
+            setArg = [&]() { kernelEmpty.setArg(0, image2D); };
+            getInfo = [&]() { image2D.getImageInfo<CL_IMAGE_WIDTH>(); };
+            allocate = [&]() { std::make_shared<cl::Image2D>(context, CL_MEM_READ_WRITE, format, imageSize, imageSize); };
+            break;
+        case KernelRegistry::CUBES:
+            setArg = [&]() { kernelEmpty.setArg(0, image2DArray); };
+            getInfo = [&]() { image2DArray.getImageInfo<CL_IMAGE_WIDTH>(); };
+            allocate = [&]() { std::make_shared<cl::Image2DArray>(context, CL_MEM_READ_WRITE, format, 4, imageSize, imageSize, 0, 0); };
+            break;
+        case KernelRegistry::BUFFER:
+            setArg = [&]() { kernelEmpty.setArg(0, buffer); };
+            getInfo = [&]() { buffer.getInfo<CL_MEM_SIZE>(); };
+            allocate = [&]() { std::make_shared<cl::Buffer>(context, CL_MEM_READ_WRITE, bytes); };
+            break;
+        case KernelRegistry::IMAGE1D:
+            setArg = [&]() { kernelEmpty.setArg(0, image1D); };
+            getInfo = [&]() { image1D.getImageInfo<CL_IMAGE_WIDTH>(); };
+            allocate = [&]() { std::make_shared<cl::Image1DBuffer>(context, CL_MEM_READ_WRITE, format, imageSize * imageSize, buffer); };
+            break;
+        default:
+            ASSERT(false, "Unknown storage type " << storage);
+    }
+    setArg();
+
+    const cl::NDRange global(imageSize, imageSize);
+    auto drain = [&]() { queue.finish(); };
+
+    Pyramid pyramid;
+    pyramid.name = pyramidName;
+
+    // The kernel is created from an already built program (like in the filter functions)
+    programs.kernel("fed_resize");
+    pyramid.measurements.push_back(measure("kernelCreate", [&]() { programs.kernel("fed_resize"); }));
+    pyramid.measurements.push_back(measure("setArg", setArg));
+    pyramid.measurements.push_back(measure("getInfo", getInfo));
+    pyramid.measurements.push_back(measure("allocate", allocate));
+    pyramid.measurements.push_back(measure("enqueueNDRangeKernel", [&]() { queue.enqueueNDRangeKernel(kernelEmpty, cl::NullRange, global, cl::NullRange); }, drain));
+    pyramid.measurements.push_back(measure("enqueueNDRangeKernelEvent", [&]()
+    {
+        cl::Event event;
+        queue.enqueueNDRangeKernel(kernelEmpty, cl::NullRange, global, cl::NullRange, nullptr, &event);
+    }, drain));
+    pyramid.measurements.push_back(measure("finishEmpty", drain));
+    pyramid.measurements.push_back(measure("launchRoundTrip", [&]()
+    {
+        queue.enqueueNDRangeKernel(kernelEmpty, cl::NullRange, global, cl::NullRange);
+        queue.finish();
+    }));
+
+    auto median = [&pyramid](const char* name)
+    {
+        return std::find_if(pyramid.measurements.begin(), pyramid.measurements.end(), [name](const Measurement& m) { return m.name == name; })->median;
+    };
+
+    Measurement event;
+    event.name = "eventCreate";
+    event.median = std::max(0.0, median("enqueueNDRangeKernelEvent") - median("enqueueNDRangeKernel"));
+    pyramid.measurements.push_back(event);
+
+    pyramid.perLaunch = median("kernelCreate") + argumentsPerLaunch * median("setArg") + median("enqueueNDRangeKernelEvent");
+
+    pyramids.push_back(pyramid);
+}
+
+void HostOverhead::print(std::ostream& stream) const
+{
+    for (const Pyramid& pyramid : pyramids)
+    {
+        stream << "--- Host overhead of the " << pyramid.name << " pyramid (" << imageSize << "x" << imageSize << ", ns per call) ---" << std::endl;
+        stream << std::left << std::setw(28) << "operation" << std::right << std::setw(12) << "median" << std::setw(12) << "min" << std::endl;
+
+        for (const Measurement& m : pyramid.measurements)
+        {
+            stream << std::left << std::setw(28) << m.name << std::right << std::fixed << std::setprecision(0)
+                   << std::setw(12) << m.median << std::setw(12) << m.min << std::defaultfloat << std::endl;
+        }
+
+        stream << "Estimated host cost per launch: " << std::fixed << std::setprecision(0) << pyramid.perLaunch << " ns" << std::defaultfloat << std::endl;
+    }
+}
+
+void HostOverhead::writeJson(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    ASSERT(file.is_open(), "Could not open " << filename);
+
+    JsonWriter json(file);
+    json.beginObject();
+
+    json.key("imageSize").value(imageSize);
+    json.key("batches").value(batches);
+    json.key("callsPerBatch").value(callsPerBatch);
+
+    json.key("pyramids").beginArray();
+    for (const Pyramid& pyramid : pyramids)
+    {
+        json.beginObject();
+        json.key("name").value(pyramid.name);
+        json.key("perLaunchNs").value(pyramid.perLaunch);
+
+        json.key("operations").beginArray();
+        for (const Measurement& m : pyramid.measurements)
+        {
+            json.beginObject();
+            json.key("name").value(m.name);
+            json.key("medianNs").value(m.median);
+            json.key("minNs").value(m.min);
+            json.endObject();
+        }
+        json.endArray();
+
+        json.endObject();
+    }
+    json.endArray();
+
+    json.endObject();
+}
+
+HostOverhead::Measurement HostOverhead::measure(const std::string& name, const std::function<void()>& call, const std::function<void()>& after) const
+{
+    std::vector<double> times;
+    for (size_t b = 0; b < batches; ++b)
+    {
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < callsPerBatch; ++i)
+        {
+            call();
+        }
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        if (after)
+        {
+            after();
+        }
+
+        times.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() / static_cast<double>(callsPerBatch));
+    }
+
+    std::sort(times.begin(), times.end());
+
+    Measurement m;
+    m.name = name;
+    m.median = times[times.size() / 2];
+    m.min = times.front();
+
+    return m;
+}
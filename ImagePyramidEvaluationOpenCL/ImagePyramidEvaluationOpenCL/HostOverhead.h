@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <functional>
+#include "opencl_common.h"
+#include "OpenCLInterface.h"
+#include "ProgramCache.h"
+
+/**
+ * @brief Microbenchmarks of the host API calls in the hot path of the filter tests, measured per storage type
+ *
+ * Every operation is executed in batches and the time per call is the median over all batches (the minimum is stored as well). The enqueue and setArg
+ * measurements use an empty kernel with a memory argument of the storage type so that only the host and driver costs are measured. The estimated host
+ * cost of one launch (kernel creation, four arguments and the enqueue with an event) can be compared with the wall time of startFilterTest() on small
+ * images to see how much of it is host overhead.
+ */
+class HostOverhead
+{
+public:
+    struct Measurement
+    {
+        std::string name;
+        double median = 0.0;    //!< Nanoseconds per call
+        double min = 0.0;
+    };
+
+public:
+    /**
+     * @param imageSize width and height of the allocated memory objects (small images are where the host overhead matters)
+     */
+    explicit HostOverhead(const size_t batches = 50, const size_t callsPerBatch = 100, const size_t imageSize = 64);
+
+    /**
+     * @brief Measures all operations with the context and queue of the interface and the kernels of the program cache
+     */
+    void add(OpenCLInterface& opencl, ProgramCache& programs, const std::string& pyramidName);
+
+    void print(std::ostream& stream) const;
+    void writeJson(const std::string& filename) const;
+
+private:
+    struct Pyramid
+    {
+        std::string name;
+        std::vector<Measurement> measurements;
+        double perLaunch = 0.0;     //!< Estimated host cost of one launch in nanoseconds
+    };
+
+    /**
+     * @param after called after every batch without being measured (e.g. to drain the queue)
+     */
+    Measurement measure(const std::string& name, const std::function<void()>& call, const std::function<void()>& after = nullptr) const;
+
+private:
+    const size_t batches;
+    const size_t callsPerBatch;
+    const size_t imageSize;
+    std::vector<Pyramid> pyramids;
+};
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include "general.h"
+
+/**
+ * @brief Host versions of the device pyramid and the comparison of its levels (shared by the OpenCV baseline and the accuracy report)
+ */
+namespace HostPyramid
+{
+    /**
+     * @brief Same structure as the device pyramid: the first level of every octave is downsampled from the last level of the previous octave, the other
+     * levels are copies (works for cv::Mat and cv::UMat)
+     * @param pyrDown cv::pyrDown instead of cv::resize with INTER_AREA (the 2x2 average of fed_resize)
+     */
+    template<typename MatType>
+    void buildLevels(const MatType& img, std::vector<MatType>& levels, const int numberOctaves, const int levelsPerOctave, const bool pyrDown = false)
+    {
+        levels.resize(numberOctaves * levelsPerOctave);
+        levels[0] = img;
+
+        for (size_t i = 1; i < levels.size(); ++i)
+        {
+            if (i % levelsPerOctave == 0)
+            {
+                // Same size as on the device (the last row and column of odd images are dropped)
+                const cv::Size sizeHalf(levels[i - 1].cols / 2, levels[i - 1].rows / 2);
+                if (pyrDown)
+                {
+                    cv::pyrDown(levels[i - 1], levels[i], sizeHalf);
+                }
+                else
+                {
+                    cv::resize(levels[i - 1], levels[i], sizeHalf, 0, 0, cv::INTER_AREA);
+                }
+            }
+            else
+            {
+                levels[i - 1].copyTo(levels[i]);
+            }
+        }
+    }
+
+    /**
+     * @return the level without the border pixels of the filter (empty if nothing is left)
+     */
+    inline cv::Rect interior(const cv::Mat& reference, const cv::Mat& result, const int border)
+    {
+        ASSERT(reference.rows == result.rows && reference.cols == result.cols, "The result (" << result.cols << "x" << result.rows << ") has not the size of the reference ("
+               << reference.cols << "x" << reference.rows << ")");
+
+        if (reference.rows <= 2 * border || reference.cols <= 2 * border)
+        {
+            return cv::Rect();
+        }
+
+        return cv::Rect(border, border, reference.cols - 2 * border, reference.rows - 2 * border);
+    }
+
+    /**
+     * @brief Absolute difference of the interior of both levels (the result is converted to the depth of the reference)
+     * @return false if the levels have no interior
+     */
+    inline bool interiorDifference(const cv::Mat& reference, const cv::Mat& result, const int border, cv::Mat& diff)
+    {
+        const cv::Rect rect = interior(reference, result, border);
+        if (rect.area() == 0)
+        {
+            return false;
+        }
+
+        cv::Mat res;
+        result(rect).convertTo(res, reference.depth());
+        cv::absdiff(reference(rect), res, diff);
+
+        return true;
+    }
+
+    inline double maxAbsError(const cv::Mat& reference, const cv::Mat& result, const int border)
+    {
+        cv::Mat diff;
+        if (!interiorDifference(reference, result, border, diff))
+        {
+            return 0.0;
+        }
+
+        double maxError = 0.0;
+        cv::minMaxLoc(diff, nullptr, &maxError);
+
+        return maxError;
+    }
+
+    /**
+     * @brief Maps the bits of a float to an integer which is monotonic in the value so that the difference of two floats is their distance in ULP
+     */
+    inline int64_t orderedBits(const float value)
+    {
+        int32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        return bits < 0 ? static_cast<int64_t>(INT32_MIN) - bits : bits;
+    }
+
+    /**
+     * @return maximum distance in ULP over the interior of both float levels (0 if they are bit-identical)
+     */
+    inline int64_t maxUlpDifference(const cv::Mat& reference, const cv::Mat& result, const int border)
+    {
+        ASSERT(reference.type() == CV_32FC1 && result.type() == CV_32FC1, "The ULP difference is only defined for float levels");
+
+        const cv::Rect rect = interior(reference, result, border);
+        int64_t maxDifference = 0;
+        for (int y = rect.y; y < rect.y + rect.height; ++y)
+        {
+            const float* rowReference = reference.ptr<float>(y);
+            const float* rowResult = result.ptr<float>(y);
+            for (int x = rect.x; x < rect.x + rect.width; ++x)
+            {
+                maxDifference = std::max(maxDifference, std::abs(orderedBits(rowReference[x]) - orderedBits(rowResult[x])));
+            }
+        }
+
+        return maxDifference;
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include "opencl_common.h"
+#include "general.h"
+
+/**
+ * @brief Handle to the image of one pyramid level
+ *
+ * Dimensions and memory flags are stored together with the image so that the kernels don't need to query the driver before every launch. Only single-channel
+ * float images are handled: they are either allocated via the handle or wrapped with known properties which are validated once when the handle is created.
+ */
+class ImageLevel
+{
+public:
+    ImageLevel()
+    {}
+
+    /**
+     * @brief Allocates a new single-channel float image on the device
+     */
+    ImageLevel(const cl::Context& context, const cl_mem_flags flags, const size_t cols, const size_t rows)
+        : image(std::make_shared<cl::Image2D>(context, flags, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows)),
+          rows(rows),
+          cols(cols),
+          flags(flags)
+    {}
+
+    /**
+     * @brief Wraps an existing single-channel float image whose properties are already known (e.g. a copy of another level)
+     */
+    ImageLevel(const std::shared_ptr<cl::Image2D>& image, const cl_mem_flags flags, const size_t cols, const size_t rows)
+        : image(image),
+          rows(rows),
+          cols(cols),
+          flags(flags)
+    {
+        ASSERT(image, "No image to wrap");
+        ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
+        ASSERT(readable(), "Can't read the image");
+    }
+
+    /**
+     * @brief The kernels can read from the image (it is not write-only)
+     */
+    bool readable() const
+    {
+        return flags == CL_MEM_READ_ONLY || flags == CL_MEM_READ_WRITE;
+    }
+
+    cl::Image2D& operator*() const
+    {
+        return *image;
+    }
+
+    explicit operator bool() const
+    {
+        return static_cast<bool>(image);
+    }
+
+    std::shared_ptr<cl::Image2D> image;
+    size_t rows = 0;
+    size_t cols = 0;
+    cl_mem_flags flags = 0;
+};
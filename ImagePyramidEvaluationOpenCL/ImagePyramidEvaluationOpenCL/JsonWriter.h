@@ -0,0 +1,233 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <iomanip>
+#include <limits>
+#include "general.h"
+
+/**
+ * @brief Minimal streaming JSON writer for the benchmark exports
+ *
+ * Separators and indentation are inserted automatically, e.g.
+ * @code
+ * JsonWriter json(file);
+ * json.beginObject();
+ * json.key("device").value("Intel(R) HD Graphics 630");
+ * json.endObject();
+ * @endcode
+ */
+class JsonWriter
+{
+public:
+    explicit JsonWriter(std::ostream& stream)
+        : stream(stream)
+    {}
+
+    ~JsonWriter()
+    {
+        if (scopes.empty())
+        {
+            stream << std::endl;
+        }
+    }
+
+    JsonWriter& beginObject()
+    {
+        return begin('{');
+    }
+
+    JsonWriter& endObject()
+    {
+        return end('}');
+    }
+
+    JsonWriter& beginArray()
+    {
+        return begin('[');
+    }
+
+    JsonWriter& endArray()
+    {
+        return end(']');
+    }
+
+    JsonWriter& key(const std::string& name)
+    {
+        ASSERT(!scopes.empty() && scopes.back().type == '{', "Keys are only allowed inside of objects");
+
+        separator();
+        writeString(name);
+        stream << ": ";
+        afterKey = true;
+
+        return *this;
+    }
+
+    JsonWriter& value(const std::string& str)
+    {
+        separator();
+        writeString(str);
+
+        return *this;
+    }
+
+    JsonWriter& value(const char* str)
+    {
+        return value(std::string(str));
+    }
+
+    JsonWriter& value(const bool b)
+    {
+        separator();
+        stream << (b ? "true" : "false");
+
+        return *this;
+    }
+
+    JsonWriter& value(const double number)
+    {
+        separator();
+        if (number != number || number == std::numeric_limits<double>::infinity() || number == -std::numeric_limits<double>::infinity())
+        {
+            stream << "null";   // JSON does not support NaN or infinity
+        }
+        else
+        {
+            stream << std::setprecision(std::numeric_limits<double>::max_digits10) << number;
+        }
+
+        return *this;
+    }
+
+    JsonWriter& value(const long long number)
+    {
+        separator();
+        stream << number;
+
+        return *this;
+    }
+
+    JsonWriter& value(const unsigned long long number)
+    {
+        separator();
+        stream << number;
+
+        return *this;
+    }
+
+    JsonWriter& value(const int number)
+    {
+        return value(static_cast<long long>(number));
+    }
+
+    JsonWriter& value(const unsigned int number)
+    {
+        return value(static_cast<unsigned long long>(number));
+    }
+
+    JsonWriter& value(const unsigned long number)
+    {
+        return value(static_cast<unsigned long long>(number));
+    }
+
+    JsonWriter& value(const long number)
+    {
+        return value(static_cast<long long>(number));
+    }
+
+    template<typename T>
+    JsonWriter& value(const std::vector<T>& values)
+    {
+        beginArray();
+        for (const T& v : values)
+        {
+            value(v);
+        }
+
+        return endArray();
+    }
+
+private:
+    struct Scope
+    {
+        char type;
+        bool empty;
+    };
+
+    JsonWriter& begin(const char type)
+    {
+        separator();
+        stream << type;
+        scopes.push_back({ type, true });
+
+        return *this;
+    }
+
+    JsonWriter& end(const char type)
+    {
+        ASSERT(!scopes.empty() && scopes.back().type == (type == '}' ? '{' : '['), "Unbalanced JSON scopes");
+
+        const bool empty = scopes.back().empty;
+        scopes.pop_back();
+        if (!empty)
+        {
+            stream << std::endl << std::string(2 * scopes.size(), ' ');
+        }
+        stream << type;
+
+        return *this;
+    }
+
+    void separator()
+    {
+        if (afterKey)
+        {
+            // The value belongs to the previous key
+            afterKey = false;
+            return;
+        }
+
+        if (!scopes.empty())
+        {
+            if (!scopes.back().empty)
+            {
+                stream << ",";
+            }
+            scopes.back().empty = false;
+            stream << std::endl << std::string(2 * scopes.size(), ' ');
+        }
+    }
+
+    void writeString(const std::string& str)
+    {
+        stream << '"';
+        for (const char c : str)
+        {
+            switch (c)
+            {
+                case '"': stream << "\\\""; break;
+                case '\\': stream << "\\\\"; break;
+                case '\n': stream << "\\n"; break;
+                case '\r': stream << "\\r"; break;
+                case '\t': stream << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+                    }
+                    else
+                    {
+                        stream << c;
+                    }
+            }
+        }
+        stream << '"';
+    }
+
+private:
+    std::ostream& stream;
+    std::vector<Scope> scopes;
+    bool afterKey = false;
+};
@@ -3,13 +3,16 @@
 #include "AKernel.h"
 #include "general.h"
 #include "settings.h"
+#include "FilterBank.h"
+#include "FilterDecomposition.h"
+#include "KernelRegistry.h"
 
 template<class Derived>
 class KernelFilter : public AKernel<Derived>
 {
 public:
-    KernelFilter(AOpenCLInterface* const opencl, cl::Program* const program)
-        : AKernel<Derived>(opencl, program), local(16, 16)
+    KernelFilter(AOpenCLInterface* const opencl, ProgramCache* const programs)
+        : AKernel<Derived>(opencl, programs), local(16, 16)
     {}
 
     virtual ~KernelFilter()
@@ -75,6 +78,39 @@ public:
         events.push_back(eventKernelB);
     }
 
+    // The following setters use the filters already stored on the device (no allocation or transfer necessary)
+    void setKernel1(const FilterBank::Filter& filter1)
+    {
+        this->kernel1 = filter1.kernel;
+        bufferKernel1 = filter1.buffer;
+    }
+
+    void setKernel2(const FilterBank::Filter& filter2)
+    {
+        this->kernel2 = filter2.kernel;
+        bufferKernel2 = filter2.buffer;
+    }
+
+    void setKernelSeparation1(const FilterBank::Filter& filterKernelA, const FilterBank::Filter& filterKernelB)
+    {
+        checkSeparationFilter(filterKernelA.kernel, filterKernelB.kernel);
+
+        this->kernelSeparation1A = filterKernelA.kernel;
+        this->kernelSeparation1B = filterKernelB.kernel;
+        bufferKernelSeparation1A = filterKernelA.buffer;
+        bufferKernelSeparation1B = filterKernelB.buffer;
+    }
+
+    void setKernelSeparation2(const FilterBank::Filter& filterKernel2A, const FilterBank::Filter& filterKernel2B)
+    {
+        checkSeparationFilter(filterKernel2A.kernel, filterKernel2B.kernel);
+
+        this->kernelSeparation2A = filterKernel2A.kernel;
+        this->kernelSeparation2B = filterKernel2B.kernel;
+        bufferKernelSeparation2A = filterKernel2A.buffer;
+        bufferKernelSeparation2B = filterKernel2B.buffer;
+    }
+
     int getBorder() const
     {
         return border;
@@ -115,26 +151,79 @@ public:
     }
 
 protected:
+    /**
+     * @brief Checks whether the filter can be applied as dilated 3x3 filter, i.e. whether it has only non-zero values at the rows and cols 0, size / 2 and size - 1
+     * (row and column vectors of the separation are dilated 1x3 and 3x1 filters)
+     * @return distance between the non-zero taps in each direction or an empty size if the dilated filter can't be used
+     */
+    cv::Size filterDilation(const cv::Mat& filter) const
+    {
+        return dilated ? FilterDecomposition::dilation(filter) : cv::Size();
+    }
+
+    cv::Size filterDilation(const cv::Mat& filter1, const cv::Mat& filter2) const
+    {
+        const cv::Size dilation = filterDilation(filter1);
+        return dilation == filterDilation(filter2) && filter1.size() == filter2.size() ? dilation : cv::Size();
+    }
+
     bool useUnrollFilter(int rows, int cols) const
     {
-        return unroll && (
-            rows == 3 && cols == 3 ||
-            rows == 5 && cols == 5 ||
-            rows == 7 && cols == 7 ||
-            rows == 9 && cols == 9);
+        return unroll && KernelRegistry::size(rows, cols) != KernelRegistry::SIZE_GENERIC;
     }
 
     bool useUnrollFilter(int rows1, int cols1, int rows2, int cols2) const
     {
-        return unroll && (
-            (rows1 == 1 && cols1 == 3 && rows2 == 3 && cols2 == 1) ||
-            (rows1 == 3 && cols1 == 1 && rows2 == 1 && cols2 == 3) ||
-            (rows1 == 1 && cols1 == 5 && rows2 == 5 && cols2 == 1) ||
-            (rows1 == 5 && cols1 == 1 && rows2 == 1 && cols2 == 5) ||
-            (rows1 == 1 && cols1 == 7 && rows2 == 7 && cols2 == 1) ||
-            (rows1 == 7 && cols1 == 1 && rows2 == 1 && cols2 == 7) ||
-            (rows1 == 1 && cols1 == 9 && rows2 == 9 && cols2 == 1) ||
-            (rows1 == 9 && cols1 == 1 && rows2 == 1 && cols2 == 9));
+        return useUnrollFilter(rows1, cols1) && useUnrollFilter(rows2, cols2);
+    }
+
+    /**
+     * @brief Looks up the generated kernel for the storage type of the derived class in the kernel registry (no string operations needed)
+     * @return the unrolled kernel for the given filter size or the generic kernel if there is none (or unrolling is disabled or the unrolled kernel is
+     * still built in the background)
+     */
+    const KernelRegistry::Kernel& filterKernel(const KernelRegistry::Multiplicity multiplicity, const KernelRegistry::Memory memory, const int rows = 0, const int cols = 0) const
+    {
+        const KernelRegistry::Kernel& filter = KernelRegistry::get(Derived::storage, multiplicity, memory, unroll ? rows : 0, unroll ? cols : 0);
+        return !filter.unrolled() || programs->ready(filter) ? filter : KernelRegistry::get(Derived::storage, multiplicity, memory, 0, 0);
+    }
+
+    // Cost models of the launches for the roofline instrumentation (see Roofline.h), the storage type is given by the derived class
+    KernelCost costFilter(const size_t cols, const size_t rows, const size_t depth, const cv::Size& filterSize, const int outputs = 1) const
+    {
+        return CostModel::filter(Derived::storage, cols, rows, depth, filterSize.area(), outputs);
+    }
+
+    KernelCost costFilter(const size_t cols, const size_t rows, const size_t depth, const cv::Mat& filter, const int outputs = 1) const
+    {
+        return costFilter(cols, rows, depth, filter.size(), outputs);
+    }
+
+    KernelCost costFilterDilated(const size_t cols, const size_t rows, const size_t depth, const cv::Size& dilation, const int outputs = 1) const
+    {
+        // At most 3 taps in each dilated direction
+        return costFilter(cols, rows, depth, cv::Size(dilation.width > 0 ? 3 : 1, dilation.height > 0 ? 3 : 1), outputs);
+    }
+
+    KernelCost costFilterLocal(const size_t cols, const size_t rows, const size_t depth, const cv::Size& filterSize, const int outputs = 1) const
+    {
+        return CostModel::filterLocal(Derived::storage, cols, rows, depth, filterSize.height, filterSize.width, outputs, local[0], local[1]);
+    }
+
+    KernelCost costFilterLocal(const size_t cols, const size_t rows, const size_t depth, const cv::Mat& filter, const int outputs = 1) const
+    {
+        return costFilterLocal(cols, rows, depth, filter.size(), outputs);
+    }
+
+    /**
+     * @brief Both passes of a separable filter in local memory (the tile is loaded once for the combined filter size)
+     */
+    KernelCost costFilterLocalSeparable(const size_t cols, const size_t rows, const size_t depth, const cv::Mat& filterA, const cv::Mat& filterB) const
+    {
+        KernelCost cost = costFilterLocal(cols, rows, depth, cv::Size(filterA.cols * filterB.cols, filterA.rows * filterB.rows));
+        cost.flops = 2.0 * cols * rows * depth * (filterA.total() + filterB.total());
+
+        return cost;
     }
 
 private:
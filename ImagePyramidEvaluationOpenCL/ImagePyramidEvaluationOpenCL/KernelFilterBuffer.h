@@ -1,20 +1,21 @@
 #pragma once
 
 #include "KernelFilter.h"
+#include <type_traits>
 
 template<typename ImageType = cl::Buffer>
 class KernelFilterBuffer : public KernelFilter<KernelFilterBuffer<ImageType>>
 {
 public:
-    KernelFilterBuffer(AOpenCLInterface* const opencl, cl::Program* const program)
-        : KernelFilter(opencl, program)
+    static constexpr KernelRegistry::Storage storage = std::is_same<ImageType, cl::Buffer>::value ? KernelRegistry::BUFFER : KernelRegistry::IMAGE1D;
+
+    KernelFilterBuffer(AOpenCLInterface* const opencl, ProgramCache* const programs)
+        : KernelFilter(opencl, programs)
     {}
 
     virtual ~KernelFilterBuffer()
     {}
 
-    static std::string kernelSource();
-
     cl::Event runSingle(ImageType& imgSrc, ImageType& imgDst, cl::Buffer& locationLookup, int octave,
                         const std::vector<Lookup>& lookup)
     {
@@ -26,11 +27,17 @@ public:
         ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
         ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
 
-        if (useUnrollFilter(kernel1.rows, kernel1.cols))
+        const KernelRegistry::Kernel& filter = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernel1.rows, kernel1.cols);
+
+        const cv::Size dilation = filterDilation(kernel1);
+        if (dilation != cv::Size())
         {
-            std::string filterName = "filter_single_" + std::to_string(kernel1.rows) + "x" + std::to_string(kernel1.cols);
+            return runSingleDilated(imgSrc, imgDst, locationLookup, bufferKernel1, kernel1, dilation, base, cols, rows);
+        }
 
-            cl::Kernel kernel(*program, filterName.c_str());
+        if (filter.unrolled())
+        {
+            cl::Kernel kernel = programs->kernel(filter.name);
             kernel.setArg(0, imgSrc);
             kernel.setArg(1, locationLookup);
             kernel.setArg(2, imgDst);
@@ -41,6 +48,7 @@ public:
             const cl::NDRange offset(0, 0, base);
             const cl::NDRange global(cols, rows, depth);
             queue->enqueueNDRangeKernel(kernel, offset, global, local, &events, &eventFilter);
+            recordLaunch(filter.name, cols, costFilter(cols, rows, depth, kernel1), eventFilter);
 
             // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
             events.clear();
@@ -49,7 +57,7 @@ public:
         }
         else
         {
-            cl::Kernel kernel(*program, "filter_single");
+            cl::Kernel kernel = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
             kernel.setArg(0, imgSrc);
             kernel.setArg(1, locationLookup);
             kernel.setArg(2, imgDst);
@@ -63,6 +71,7 @@ public:
             const cl::NDRange offset(0, 0, base);
             const cl::NDRange global(cols, rows, depth);
             queue->enqueueNDRangeKernel(kernel, offset, global, local, &events, &eventFilter);
+            recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, depth, kernel1), eventFilter);
 
             // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
             events.clear();
@@ -82,11 +91,18 @@ public:
         ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
         ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
 
-        if (useUnrollFilter(kernel1.rows, kernel1.cols))
+        const KernelRegistry::Kernel& filter = filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL, kernel1.rows, kernel1.cols);
+
+        // The dilated filter reads only the non-zero taps which is cheaper than loading the complete tile to local memory
+        const cv::Size dilation = filterDilation(kernel1);
+        if (dilation != cv::Size())
         {
-            std::string filterName = "filter_single_local_" + std::to_string(kernel1.rows) + "x" + std::to_string(kernel1.cols);
+            return runSingleDilated(imgSrc, imgDst, locationLookup, bufferKernel1, kernel1, dilation, base, cols, rows);
+        }
 
-            cl::Kernel kernel(*program, filterName.c_str());
+        if (filter.unrolled())
+        {
+            cl::Kernel kernel = programs->kernel(filter.name);
             kernel.setArg(0, imgSrc);
             kernel.setArg(1, locationLookup);
             kernel.setArg(2, imgDst);
@@ -97,6 +113,7 @@ public:
             const cl::NDRange offset(0, 0, base);
             const cl::NDRange global(cols, rows, depth);
             queue->enqueueNDRangeKernel(kernel, offset, global, local, &events, &eventFilter);
+            recordLaunch(filter.name, cols, costFilterLocal(cols, rows, depth, kernel1), eventFilter);
 
             // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
             events.clear();
@@ -105,7 +122,7 @@ public:
         }
         else
         {
-            cl::Kernel kernel(*program, "filter_single_local");
+            cl::Kernel kernel = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL).name);
             kernel.setArg(0, imgSrc);
             kernel.setArg(1, locationLookup);
             kernel.setArg(2, imgDst);
@@ -119,6 +136,7 @@ public:
             const cl::NDRange offset(0, 0, base);
             const cl::NDRange global(cols, rows, depth);
             queue->enqueueNDRangeKernel(kernel, offset, global, local, &events, &eventFilter);
+            recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL).name, cols, costFilterLocal(cols, rows, depth, kernel1), eventFilter);
 
             // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
             events.clear();
@@ -127,6 +145,99 @@ public:
         }
     }
 
+    /**
+     * @brief Single filter with a sliding line buffer (one work-group per vertical strip and chunk of rows, only available for the buffer pyramid)
+     */
+    cl::Event runSingleSliding(cl::Buffer& imgSrc, cl::Buffer& imgDst, cl::Buffer& locationLookup, int octave,
+                               const std::vector<Lookup>& lookup)
+    {
+        const size_t depth = 4;
+        const int base = octave * depth;
+        const size_t rows = lookup[base].imgHeight;
+        const size_t cols = lookup[base].imgWidth;
+
+        ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
+        ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
+        ASSERT(kernel1.rows <= 21 && kernel1.cols <= 21, "The ring buffer of the sliding kernel supports filters up to 21x21");
+
+        const size_t stripWidth = 64;   // Must match STRIP_WIDTH_SLIDING in the kernel
+        const size_t chunkRows = 64;    // Output rows per work-group (the 2 * filterRowsHalf warm-up rows are loaded additionally)
+
+        cl::Kernel kernel = programs->kernel("filter_single_sliding");
+        kernel.setArg(0, imgSrc);
+        kernel.setArg(1, locationLookup);
+        kernel.setArg(2, imgDst);
+        kernel.setArg(3, bufferKernel1);
+        kernel.setArg(4, kernel1.rows / 2);
+        kernel.setArg(5, kernel1.cols);
+        kernel.setArg(6, kernel1.cols / 2);
+        kernel.setArg(7, static_cast<int>(chunkRows));
+        kernel.setArg(8, border);
+
+        // One work-group per strip, chunk of rows and level
+        cl::Event eventFilter;
+        const size_t strips = (cols + stripWidth - 1) / stripWidth;
+        const size_t chunks = (rows + chunkRows - 1) / chunkRows;
+        const cl::NDRange offset(0, 0, base);
+        const cl::NDRange global(strips * stripWidth, chunks, depth);
+        const cl::NDRange localSliding(stripWidth, 1, 1);
+        queue->enqueueNDRangeKernel(kernel, offset, global, localSliding, &events, &eventFilter);
+        recordLaunch("filter_single_sliding", cols, CostModel::filterSliding(storage, cols, rows, depth, kernel1.rows, kernel1.cols, stripWidth, chunkRows), eventFilter);
+
+        // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
+        events.clear();
+
+        return eventFilter;
+    }
+
+    /**
+     * @brief Single filter with local memory and persistent work-groups which prefetch the next tile asynchronously
+     *
+     * The kernel copies the image rows via async_work_group_copy which needs global memory. For the image1D pyramid, the buffers the images are created from must be passed.
+     */
+    cl::Event runSingleLocalPersistent(cl::Buffer& imgSrc, cl::Buffer& imgDst, cl::Buffer& locationLookup, int octave,
+                                       const std::vector<Lookup>& lookup)
+    {
+        const size_t depth = 4;
+        const int base = octave * depth;
+        const size_t rows = lookup[base].imgHeight;
+        const size_t cols = lookup[base].imgWidth;
+
+        ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
+        ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
+        ASSERT(kernel1.rows <= 21 && kernel1.cols <= 21, "The local buffer of the persistent kernel supports filters up to 21x21");
+
+        // Only as many work-groups as can be resident on the device at the same time
+        const size_t tileSize = local[0];
+        const size_t tilesTotal = ((cols + tileSize - 1) / tileSize) * ((rows + tileSize - 1) / tileSize) * depth;
+        const size_t groupsPerComputeUnit = 4;
+        cl_uint computeUnits = 0;
+        device->getInfo(CL_DEVICE_MAX_COMPUTE_UNITS, &computeUnits);
+        const size_t numberGroups = std::min(tilesTotal, computeUnits * groupsPerComputeUnit);
+
+        cl::Kernel kernel = programs->kernel("filter_single_local_persistent");
+        kernel.setArg(0, imgSrc);
+        kernel.setArg(1, locationLookup);
+        kernel.setArg(2, imgDst);
+        kernel.setArg(3, bufferKernel1);
+        kernel.setArg(4, kernel1.rows / 2);
+        kernel.setArg(5, kernel1.cols);
+        kernel.setArg(6, kernel1.cols / 2);
+        kernel.setArg(7, base);
+        kernel.setArg(8, static_cast<int>(depth));
+        kernel.setArg(9, border);
+
+        cl::Event eventFilter;
+        const cl::NDRange global(numberGroups * tileSize, tileSize);
+        queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch("filter_single_local_persistent", cols, costFilterLocal(cols, rows, depth, kernel1), eventFilter);
+
+        // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
+        events.clear();
+
+        return eventFilter;
+    }
+
     cl::Event runSingleSeparationLocal(ImageType& imgSrc, ImageType& imgDst, cl::Buffer& locationLookup, int octave,
                                        const std::vector<Lookup>& lookup)
     {
@@ -145,30 +256,41 @@ public:
             bufferSet = true;
         }
 
-        if (useUnrollFilter(kernelSeparation1A.rows, kernelSeparation1A.cols, kernelSeparation1B.rows, kernelSeparation1B.cols))
+        const KernelRegistry::Kernel& filterX = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernelSeparation1A.rows, kernelSeparation1A.cols);
+        const KernelRegistry::Kernel& filterY = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernelSeparation1B.rows, kernelSeparation1B.cols);
+
+        const cv::Size dilationX = filterDilation(kernelSeparation1A);
+        const cv::Size dilationY = filterDilation(kernelSeparation1B);
+        if (dilationX != cv::Size() && dilationY != cv::Size())
         {
-            std::string filterNameX = "filter_single_" + std::to_string(kernelSeparation1A.rows) + "x" + std::to_string(kernelSeparation1A.cols);
-            std::string filterNameY = "filter_single_" + std::to_string(kernelSeparation1B.rows) + "x" + std::to_string(kernelSeparation1B.cols);
+            runSingleDilated(imgSrc, imgTmp, locationLookup, bufferKernelSeparation1A, kernelSeparation1A, dilationX, base, cols, rows);
+            return runSingleDilated(imgTmp, imgDst, locationLookup, bufferKernelSeparation1B, kernelSeparation1B, dilationY, base, cols, rows);
+        }
 
-            cl::Kernel kernelX(*program, filterNameX.c_str());
+        if (filterX.unrolled() && filterY.unrolled())
+        {
+            cl::Kernel kernelX = programs->kernel(filterX.name);
             kernelX.setArg(0, imgSrc);
             kernelX.setArg(1, locationLookup);
             kernelX.setArg(2, imgTmp);
             kernelX.setArg(3, bufferKernelSeparation1A);
             kernelX.setArg(4, border);
 
-            cl::Kernel kernelY(*program, filterNameY.c_str());
+            cl::Kernel kernelY = programs->kernel(filterY.name);
             kernelY.setArg(0, imgTmp);
-            kernelX.setArg(1, locationLookup);
+            kernelY.setArg(1, locationLookup);
             kernelY.setArg(2, imgDst);
             kernelY.setArg(3, bufferKernelSeparation1B);
             kernelY.setArg(4, border);
 
             cl::Event eventFilter;
+            cl::Event eventFilterX;
             const cl::NDRange offset(0, 0, base);
             const cl::NDRange global(cols, rows, depth);
-            queue->enqueueNDRangeKernel(kernelX, offset, global, local, &events);
+            queue->enqueueNDRangeKernel(kernelX, offset, global, local, &events, &eventFilterX);
             queue->enqueueNDRangeKernel(kernelY, offset, global, local, nullptr, &eventFilter);
+            recordLaunch(filterX.name, cols, costFilter(cols, rows, depth, kernelSeparation1A), eventFilterX);
+            recordLaunch(filterY.name, cols, costFilter(cols, rows, depth, kernelSeparation1B), eventFilter);
 
             // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
             events.clear();
@@ -177,7 +299,7 @@ public:
         }
         else
         {
-            cl::Kernel kernelX(*program, "filter_single");
+            cl::Kernel kernelX = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
             kernelX.setArg(0, imgSrc);
             kernelX.setArg(1, locationLookup);
             kernelX.setArg(2, imgTmp);
@@ -187,9 +309,9 @@ public:
             kernelX.setArg(6, kernelSeparation1A.cols / 2);
             kernelX.setArg(7, border);
 
-            cl::Kernel kernelY(*program, "filter_single");
+            cl::Kernel kernelY = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
             kernelY.setArg(0, imgTmp);
-            kernelX.setArg(1, locationLookup);
+            kernelY.setArg(1, locationLookup);
             kernelY.setArg(2, imgDst);
             kernelY.setArg(3, bufferKernelSeparation1B);
             kernelY.setArg(4, kernelSeparation1B.rows / 2);
@@ -198,10 +320,13 @@ public:
             kernelY.setArg(7, border);
 
             cl::Event eventFilter;
+            cl::Event eventFilterX;
             const cl::NDRange offset(0, 0, base);
             const cl::NDRange global(cols, rows, depth);
-            queue->enqueueNDRangeKernel(kernelX, offset, global, local, &events);
+            queue->enqueueNDRangeKernel(kernelX, offset, global, local, &events, &eventFilterX);
             queue->enqueueNDRangeKernel(kernelY, offset, global, local, nullptr, &eventFilter);
+            recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, depth, kernelSeparation1A), eventFilterX);
+            recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, depth, kernelSeparation1B), eventFilter);
 
             // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
             events.clear();
@@ -210,6 +335,85 @@ public:
         }
     }
 
+    /**
+     * @brief Separation filter where both passes are row passes which write their result transposed (only available for the buffer pyramid)
+     *
+     * The first pass applies the row filter (kernelSeparation1B) and stores the transposed result in the temporary buffer. The second pass applies the column
+     * filter (kernelSeparation1A) along the rows of the transposed image and transposes the result back. All reads and writes are unit-stride.
+     */
+    cl::Event runSingleSeparationTransposed(cl::Buffer& imgSrc, cl::Buffer& imgDst, cl::Buffer& locationLookup, int octave,
+                                            const std::vector<Lookup>& lookup)
+    {
+        const size_t depth = 4;
+        const int base = octave * depth;
+        const size_t rows = lookup[base].imgHeight;
+        const size_t cols = lookup[base].imgWidth;
+
+        ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
+        ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
+
+        if (!bufferSet)
+        {
+            const int totalPixels = lookup.back().previousPixels + lookup.back().imgHeight * lookup.back().imgWidth;
+            imgTmp = cl::Buffer(*context, CL_MEM_READ_WRITE, sizeof(float) * totalPixels);
+            bufferSet = true;
+        }
+
+        if (!lookupTransposedSet)
+        {
+            // Same memory locations but width and height swapped
+            std::vector<Lookup> lookupTransposed(lookup);
+            for (auto& l : lookupTransposed)
+            {
+                std::swap(l.imgWidth, l.imgHeight);
+            }
+
+            locationLookupTransposed = cl::Buffer(*context, CL_MEM_READ_ONLY, sizeof(Lookup) * lookupTransposed.size());
+            queue->enqueueWriteBuffer(locationLookupTransposed, CL_BLOCKING, 0, sizeof(Lookup) * lookupTransposed.size(), lookupTransposed.data());
+            lookupTransposedSet = true;
+        }
+
+        const size_t tileSize = local[0];
+        const auto roundUp = [tileSize](const size_t value)
+        {
+            return (value + tileSize - 1) / tileSize * tileSize;
+        };
+
+        cl::Kernel kernelX = programs->kernel("filter_single_row_transposed");
+        kernelX.setArg(0, imgSrc);
+        kernelX.setArg(1, locationLookup);
+        kernelX.setArg(2, imgTmp);
+        kernelX.setArg(3, locationLookupTransposed);
+        kernelX.setArg(4, bufferKernelSeparation1B);
+        kernelX.setArg(5, kernelSeparation1B.cols / 2);
+        kernelX.setArg(6, border);
+
+        // The column filter is stored as a column vector but it has the same memory layout as the corresponding row vector
+        cl::Kernel kernelY = programs->kernel("filter_single_row_transposed");
+        kernelY.setArg(0, imgTmp);
+        kernelY.setArg(1, locationLookupTransposed);
+        kernelY.setArg(2, imgDst);
+        kernelY.setArg(3, locationLookup);
+        kernelY.setArg(4, bufferKernelSeparation1A);
+        kernelY.setArg(5, kernelSeparation1A.rows / 2);
+        kernelY.setArg(6, border);
+
+        cl::Event eventFilter;
+        cl::Event eventFilterX;
+        const cl::NDRange offset(0, 0, base);
+        const cl::NDRange globalX(roundUp(cols), roundUp(rows), depth);
+        const cl::NDRange globalY(roundUp(rows), roundUp(cols), depth);
+        queue->enqueueNDRangeKernel(kernelX, offset, globalX, local, &events, &eventFilterX);
+        queue->enqueueNDRangeKernel(kernelY, offset, globalY, local, nullptr, &eventFilter);
+        recordLaunch("filter_single_row_transposed", cols, costFilter(cols, rows, depth, kernelSeparation1B), eventFilterX);
+        recordLaunch("filter_single_row_transposed", cols, costFilter(cols, rows, depth, kernelSeparation1A), eventFilter);
+
+        // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
+        events.clear();
+
+        return eventFilter;
+    }
+
     cl::Event runHalfsampleImage(ImageType& img, cl::Buffer& locationLookup, int octave,
                                  const std::vector<Lookup>& lookup)
     {
@@ -220,7 +424,7 @@ public:
 
         ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
 
-        cl::Kernel kernelConductivty(*program, "fed_resize");
+        cl::Kernel kernelConductivty = programs->kernel("fed_resize");
         kernelConductivty.setArg(0, img);
         kernelConductivty.setArg(1, locationLookup);
         kernelConductivty.setArg(2, lastInOctave);
@@ -228,6 +432,7 @@ public:
         cl::Event event;
         const cl::NDRange global(cols / 2, rows / 2);
         queue->enqueueNDRangeKernel(kernelConductivty, cl::NullRange, global, cl::NullRange, &events, &event);
+        recordLaunch("fed_resize", cols, CostModel::pointwise(storage, (cols / 2) * (rows / 2), 4, 1, 4.0), event);
 
         events.clear();
 
@@ -244,7 +449,7 @@ public:
 
         ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
 
-        cl::Kernel kernelConductivty(*program, "copy_inside_cube");
+        cl::Kernel kernelConductivty = programs->kernel("copy_inside_cube");
         kernelConductivty.setArg(0, img);
         kernelConductivty.setArg(1, locationLookup);
         kernelConductivty.setArg(2, base);
@@ -253,25 +458,45 @@ public:
         const cl::NDRange offset(0, 0, base + 1);
         const cl::NDRange global(cols, rows, depth - 1);
         queue->enqueueNDRangeKernel(kernelConductivty, offset, global, cl::NullRange, &events, &event);
+        recordLaunch("copy_inside_cube", cols, CostModel::pointwise(storage, cols * rows * (depth - 1), 1, 1, 0.0), event);
 
         events.clear();
 
         return event;
     }
 
+private:
+    cl::Event runSingleDilated(const cl::Memory& imgSrc, const cl::Memory& imgDst, const cl::Buffer& locationLookup, const cl::Buffer& bufferKernel, const cv::Mat& filter, const cv::Size& dilation, const int base, const size_t cols, const size_t rows)
+    {
+        const size_t depth = 4;
+
+        const KernelRegistry::Kernel& filterDilated = KernelRegistry::getDilated(storage, KernelRegistry::SINGLE);
+
+        cl::Kernel kernel = programs->kernel(filterDilated.name);
+        kernel.setArg(0, imgSrc);
+        kernel.setArg(1, locationLookup);
+        kernel.setArg(2, imgDst);
+        kernel.setArg(3, bufferKernel);
+        kernel.setArg(4, filter.cols);
+        kernel.setArg(5, dilation.height);
+        kernel.setArg(6, dilation.width);
+        kernel.setArg(7, border);
+
+        cl::Event eventFilter;
+        const cl::NDRange offset(0, 0, base);
+        const cl::NDRange global(cols, rows, depth);
+        queue->enqueueNDRangeKernel(kernel, offset, global, local, &events, &eventFilter);
+        recordLaunch(filterDilated.name, cols, costFilterDilated(cols, rows, depth, dilation), eventFilter);
+
+        // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
+        events.clear();
+
+        return eventFilter;
+    }
+
 private:
     cl::Buffer imgTmp;
     bool bufferSet = false;
+    cl::Buffer locationLookupTransposed;
+    bool lookupTransposedSet = false;
 };
-
-template<>
-inline std::string KernelFilterBuffer<cl::Buffer>::kernelSource()
-{
-    return getKernelSource("kernels/filter_buffer.cl");
-}
-
-template<>
-inline std::string KernelFilterBuffer<cl::Image1DBuffer>::kernelSource()
-{
-    return getKernelSource("kernels/filter_image1D.cl");
-}
@@ -1,18 +1,13 @@
 #include "KernelFilterCubes.h"
 #include "general.h"
 
-KernelFilterCubes::KernelFilterCubes(AOpenCLInterface* const opencl, cl::Program* const program)
-    : KernelFilter(opencl, program)
+KernelFilterCubes::KernelFilterCubes(AOpenCLInterface* const opencl, ProgramCache* const programs)
+    : KernelFilter(opencl, programs)
 {}
 
 KernelFilterCubes::~KernelFilterCubes()
 {}
 
-std::string KernelFilterCubes::kernelSource()
-{
-    return getKernelSource("kernels/filter_cubes.cl");
-}
-
 cl::Event KernelFilterCubes::runSingle(const cl::Image2DArray& imgSrc, SPImage2DArray& imgDst)
 {
     const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
@@ -26,11 +21,17 @@ cl::Event KernelFilterCubes::runSingle(const cl::Image2DArray& imgSrc, SPImage2D
 
     imgDst = std::make_shared<cl::Image2DArray>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), depth, cols, rows, 0, 0);
 
-    if (useUnrollFilter(kernel1.rows, kernel1.cols))
+    const KernelRegistry::Kernel& filter = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernel1.rows, kernel1.cols);
+
+    const cv::Size dilation = filterDilation(kernel1);
+    if (dilation != cv::Size())
     {
-        std::string filterName = "filter_single_" + std::to_string(kernel1.rows) + "x" + std::to_string(kernel1.cols);
+        return runSingleDilated(imgSrc, *imgDst, bufferKernel1, kernel1, dilation, cols, rows, depth);
+    }
 
-        cl::Kernel kernel(*program, filterName.c_str());
+    if (filter.unrolled())
+    {
+        cl::Kernel kernel = programs->kernel(filter.name);
         kernel.setArg(0, imgSrc);
         kernel.setArg(1, *imgDst);
         kernel.setArg(2, bufferKernel1);
@@ -39,6 +40,7 @@ cl::Event KernelFilterCubes::runSingle(const cl::Image2DArray& imgSrc, SPImage2D
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows, depth);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filter.name, cols, costFilter(cols, rows, depth, kernel1), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -47,7 +49,7 @@ cl::Event KernelFilterCubes::runSingle(const cl::Image2DArray& imgSrc, SPImage2D
     }
     else
     {
-        cl::Kernel kernel(*program, "filter_single");
+        cl::Kernel kernel = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
         kernel.setArg(0, imgSrc);
         kernel.setArg(1, *imgDst);
         kernel.setArg(2, bufferKernel1);
@@ -59,6 +61,7 @@ cl::Event KernelFilterCubes::runSingle(const cl::Image2DArray& imgSrc, SPImage2D
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows, depth);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, depth, kernel1), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -80,11 +83,18 @@ cl::Event KernelFilterCubes::runSingleLocal(const cl::Image2DArray& imgSrc, SPIm
 
     imgDst = std::make_shared<cl::Image2DArray>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), depth, cols, rows, 0, 0);
 
-    if (useUnrollFilter(kernel1.rows, kernel1.cols))
+    const KernelRegistry::Kernel& filter = filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL, kernel1.rows, kernel1.cols);
+
+    // The dilated filter reads only the non-zero taps which is cheaper than loading the complete tile to local memory
+    const cv::Size dilation = filterDilation(kernel1);
+    if (dilation != cv::Size())
     {
-        std::string filterName = "filter_single_local_" + std::to_string(kernel1.rows) + "x" + std::to_string(kernel1.cols);
+        return runSingleDilated(imgSrc, *imgDst, bufferKernel1, kernel1, dilation, cols, rows, depth);
+    }
 
-        cl::Kernel kernel(*program, filterName.c_str());
+    if (filter.unrolled())
+    {
+        cl::Kernel kernel = programs->kernel(filter.name);
         kernel.setArg(0, imgSrc);
         kernel.setArg(1, *imgDst);
         kernel.setArg(2, bufferKernel1);
@@ -93,6 +103,7 @@ cl::Event KernelFilterCubes::runSingleLocal(const cl::Image2DArray& imgSrc, SPIm
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows, depth);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filter.name, cols, costFilterLocal(cols, rows, depth, kernel1), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -101,7 +112,7 @@ cl::Event KernelFilterCubes::runSingleLocal(const cl::Image2DArray& imgSrc, SPIm
     }
     else
     {
-        cl::Kernel kernel(*program, "filter_single_local");
+        cl::Kernel kernel = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL).name);
         kernel.setArg(0, imgSrc);
         kernel.setArg(1, *imgDst);
         kernel.setArg(2, bufferKernel1);
@@ -113,6 +124,7 @@ cl::Event KernelFilterCubes::runSingleLocal(const cl::Image2DArray& imgSrc, SPIm
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows, depth);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL).name, cols, costFilterLocal(cols, rows, depth, kernel1), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -135,27 +147,38 @@ cl::Event KernelFilterCubes::runSingleSeparation(const cl::Image2DArray& imgSrc,
     cl::Image2DArray imgTmp(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), depth, cols, rows, 0, 0);
     imgDst = std::make_shared<cl::Image2DArray>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), depth, cols, rows, 0, 0);
 
-    if (useUnrollFilter(kernelSeparation1A.rows, kernelSeparation1A.cols, kernelSeparation1B.rows, kernelSeparation1B.cols))
+    const KernelRegistry::Kernel& filterX = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernelSeparation1A.rows, kernelSeparation1A.cols);
+    const KernelRegistry::Kernel& filterY = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernelSeparation1B.rows, kernelSeparation1B.cols);
+
+    const cv::Size dilationX = filterDilation(kernelSeparation1A);
+    const cv::Size dilationY = filterDilation(kernelSeparation1B);
+    if (dilationX != cv::Size() && dilationY != cv::Size())
     {
-        std::string filterNameX = "filter_single_" + std::to_string(kernelSeparation1A.rows) + "x" + std::to_string(kernelSeparation1A.cols);
-        std::string filterNameY = "filter_single_" + std::to_string(kernelSeparation1B.rows) + "x" + std::to_string(kernelSeparation1B.cols);
+        runSingleDilated(imgSrc, imgTmp, bufferKernelSeparation1A, kernelSeparation1A, dilationX, cols, rows, depth);
+        return runSingleDilated(imgTmp, *imgDst, bufferKernelSeparation1B, kernelSeparation1B, dilationY, cols, rows, depth);
+    }
 
-        cl::Kernel kernelX(*program, filterNameX.c_str());
+    if (filterX.unrolled() && filterY.unrolled())
+    {
+        cl::Kernel kernelX = programs->kernel(filterX.name);
         kernelX.setArg(0, imgSrc);
         kernelX.setArg(1, imgTmp);
         kernelX.setArg(2, bufferKernelSeparation1A);
         kernelX.setArg(3, border);
 
-        cl::Kernel kernelY(*program, filterNameY.c_str());
+        cl::Kernel kernelY = programs->kernel(filterY.name);
         kernelY.setArg(0, imgTmp);
         kernelY.setArg(1, *imgDst);
         kernelY.setArg(2, bufferKernelSeparation1B);
         kernelY.setArg(3, border);
 
         cl::Event eventFilter;
+        cl::Event eventFilterX;
         const cl::NDRange global(cols, rows, depth);
-        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events);
+        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events, &eventFilterX);
         queue->enqueueNDRangeKernel(kernelY, cl::NullRange, global, local, nullptr, &eventFilter);
+        recordLaunch(filterX.name, cols, costFilter(cols, rows, depth, kernelSeparation1A), eventFilterX);
+        recordLaunch(filterY.name, cols, costFilter(cols, rows, depth, kernelSeparation1B), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -164,7 +187,7 @@ cl::Event KernelFilterCubes::runSingleSeparation(const cl::Image2DArray& imgSrc,
     }
     else
     {
-        cl::Kernel kernelX(*program, "filter_single");
+        cl::Kernel kernelX = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
         kernelX.setArg(0, imgSrc);
         kernelX.setArg(1, imgTmp);
         kernelX.setArg(2, bufferKernelSeparation1A);
@@ -173,7 +196,7 @@ cl::Event KernelFilterCubes::runSingleSeparation(const cl::Image2DArray& imgSrc,
         kernelX.setArg(5, kernelSeparation1A.cols / 2);
         kernelX.setArg(6, border);
 
-        cl::Kernel kernelY(*program, "filter_single");
+        cl::Kernel kernelY = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
         kernelY.setArg(0, imgTmp);
         kernelY.setArg(1, *imgDst);
         kernelY.setArg(2, bufferKernelSeparation1B);
@@ -183,9 +206,12 @@ cl::Event KernelFilterCubes::runSingleSeparation(const cl::Image2DArray& imgSrc,
         kernelY.setArg(6, border);
 
         cl::Event eventFilter;
+        cl::Event eventFilterX;
         const cl::NDRange global(cols, rows, depth);
-        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events);
+        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events, &eventFilterX);
         queue->enqueueNDRangeKernel(kernelY, cl::NullRange, global, local, nullptr, &eventFilter);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, depth, kernelSeparation1A), eventFilterX);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, depth, kernelSeparation1B), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -194,6 +220,30 @@ cl::Event KernelFilterCubes::runSingleSeparation(const cl::Image2DArray& imgSrc,
     }
 }
 
+cl::Event KernelFilterCubes::runSingleDilated(const cl::Image2DArray& imgSrc, const cl::Image2DArray& imgDst, const cl::Buffer& bufferKernel, const cv::Mat& filter, const cv::Size& dilation, const size_t cols, const size_t rows, const size_t depth)
+{
+    const KernelRegistry::Kernel& filterDilated = KernelRegistry::getDilated(storage, KernelRegistry::SINGLE);
+
+    cl::Kernel kernel = programs->kernel(filterDilated.name);
+    kernel.setArg(0, imgSrc);
+    kernel.setArg(1, imgDst);
+    kernel.setArg(2, bufferKernel);
+    kernel.setArg(3, filter.cols);
+    kernel.setArg(4, dilation.height);
+    kernel.setArg(5, dilation.width);
+    kernel.setArg(6, border);
+
+    cl::Event eventFilter;
+    const cl::NDRange global(cols, rows, depth);
+    queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+    recordLaunch(filterDilated.name, cols, costFilterDilated(cols, rows, depth, dilation), eventFilter);
+
+    // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
+    events.clear();
+
+    return eventFilter;
+}
+
 cl::Event KernelFilterCubes::runHalfsampleImage(const cl::Image2DArray& imgSrc, SPImage2DArray& imgDst)
 {
     const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
@@ -206,13 +256,14 @@ cl::Event KernelFilterCubes::runHalfsampleImage(const cl::Image2DArray& imgSrc,
 
     imgDst = std::make_shared<cl::Image2DArray>(*context, CL_MEM_READ_ONLY, cl::ImageFormat(CL_R, CL_FLOAT), depth, cols / 2, rows / 2, 0, 0);
 
-    cl::Kernel kernelConductivty(*program, "fed_resize");
+    cl::Kernel kernelConductivty = programs->kernel("fed_resize");
     kernelConductivty.setArg(0, imgSrc);
     kernelConductivty.setArg(1, *imgDst);
 
     cl::Event event;
     const cl::NDRange global(cols / 2, rows / 2);
     queue->enqueueNDRangeKernel(kernelConductivty, cl::NullRange, global, cl::NullRange, &events, &event);
+    recordLaunch("fed_resize", cols, CostModel::pointwise(storage, (cols / 2) * (rows / 2), 4, 1, 4.0), event);
 
     events.clear();
 
@@ -229,13 +280,14 @@ cl::Event KernelFilterCubes::runCopyInsideCube(SPImage2DArray& img)
     ASSERT(img->getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
     ASSERT(img->getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || img->getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
 
-    cl::Kernel kernelConductivty(*program, "copy_inside_cube");
+    cl::Kernel kernelConductivty = programs->kernel("copy_inside_cube");
     kernelConductivty.setArg(0, *img);
 
     cl::Event event;
     const cl::NDRange offset(0, 0, 1);
     const cl::NDRange global(cols, rows, depth - 1);
     queue->enqueueNDRangeKernel(kernelConductivty, offset, global, cl::NullRange, &events, &event);
+    recordLaunch("copy_inside_cube", cols, CostModel::pointwise(storage, cols * rows * (depth - 1), 1, 1, 0.0), event);
 
     events.clear();
 
@@ -6,10 +6,10 @@
 class KernelFilterCubes : public KernelFilter<KernelFilterCubes>
 {
 public:
-    KernelFilterCubes(AOpenCLInterface* const opencl, cl::Program* const program);
-    virtual ~KernelFilterCubes();
+    static constexpr KernelRegistry::Storage storage = KernelRegistry::CUBES;
 
-    static std::string kernelSource();
+    KernelFilterCubes(AOpenCLInterface* const opencl, ProgramCache* const programs);
+    virtual ~KernelFilterCubes();
 
     cl::Event runSingle(const cl::Image2DArray& imgSrc, SPImage2DArray& imgDst);
     cl::Event runSingleLocal(const cl::Image2DArray& imgSrc, SPImage2DArray& imgDst);
@@ -17,4 +17,7 @@ public:
 
     cl::Event runHalfsampleImage(const cl::Image2DArray& imgSrc, SPImage2DArray& imgDst);
     cl::Event runCopyInsideCube(SPImage2DArray& img);
+
+private:
+    cl::Event runSingleDilated(const cl::Image2DArray& imgSrc, const cl::Image2DArray& imgDst, const cl::Buffer& bufferKernel, const cv::Mat& filter, const cv::Size& dilation, const size_t cols, const size_t rows, const size_t depth);
 };
@@ -2,36 +2,75 @@
 #include "general.h"
 #include <numeric>
 
-KernelFilterImages::KernelFilterImages(AOpenCLInterface* const opencl, cl::Program* const program)
-    : KernelFilter(opencl, program)
+static const size_t stripWidthSliding = 64;     // Must match STRIP_WIDTH_SLIDING in the kernel
+static const size_t chunkRowsSliding = 64;      // Output rows per work-group (the 2 * filterRowsHalf warm-up rows are loaded additionally)
+
+/**
+ * @brief Transforms a 3x3 or 5x5 filter g for the Winograd kernels (U = G * g * Gt), see filter_images_winograd.cl for the input and output transforms
+ */
+static cv::Mat winogradFilterTransform(const cv::Mat& filter)
+{
+    cv::Mat G;
+    if (filter.rows == 3)
+    {
+        G = (cv::Mat_<double>(4, 3) <<
+             1.0, 0.0, 0.0,
+             0.5, 0.5, 0.5,
+             0.5, -0.5, 0.5,
+             0.0, 0.0, 1.0);
+    }
+    else
+    {
+        G = (cv::Mat_<double>(6, 5) <<
+             1.0 / 4, 0.0, 0.0, 0.0, 0.0,
+             -1.0 / 6, -1.0 / 6, -1.0 / 6, -1.0 / 6, -1.0 / 6,
+             -1.0 / 6, 1.0 / 6, -1.0 / 6, 1.0 / 6, -1.0 / 6,
+             1.0 / 24, 1.0 / 12, 1.0 / 6, 1.0 / 3, 2.0 / 3,
+             1.0 / 24, -1.0 / 12, 1.0 / 6, -1.0 / 3, 2.0 / 3,
+             0.0, 0.0, 0.0, 0.0, 1.0);
+    }
+
+    cv::Mat filter64;
+    filter.convertTo(filter64, CV_64FC1);
+
+    const cv::Mat Gt = G.t();
+    const cv::Mat transformed64 = G * filter64 * Gt;
+
+    cv::Mat transformed;
+    transformed64.convertTo(transformed, CV_32FC1);
+
+    return transformed;
+}
+
+KernelFilterImages::KernelFilterImages(AOpenCLInterface* const opencl, ProgramCache* const programs)
+    : KernelFilter(opencl, programs)
 {}
 
 KernelFilterImages::~KernelFilterImages()
 {}
 
-std::string KernelFilterImages::kernelSource()
-{
-    return getKernelSource("kernels/filter_images.cl");
-}
-
-cl::Event KernelFilterImages::runSingle(const cl::Image2D& imgSrc, SPImage2D& imgDst)
+cl::Event KernelFilterImages::runSingle(const ImageLevel& imgSrc, ImageLevel& imgDst)
 {
-    const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = imgSrc.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(imgSrc.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(imgSrc.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
 
-    imgDst = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+
+    const KernelRegistry::Kernel& filter = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernel1.rows, kernel1.cols);
 
-    if (useUnrollFilter(kernel1.rows, kernel1.cols))
+    const cv::Size dilation = filterDilation(kernel1);
+    if (dilation != cv::Size())
     {
-        std::string filterName = "filter_single_" + std::to_string(kernel1.rows) + "x" + std::to_string(kernel1.cols);
+        return runSingleDilated(*imgSrc, *imgDst, bufferKernel1, kernel1, dilation, cols, rows);
+    }
 
-        cl::Kernel kernel(*program, filterName.c_str());
-        kernel.setArg(0, imgSrc);
+    if (filter.unrolled())
+    {
+        cl::Kernel kernel = programs->kernel(filter.name);
+        kernel.setArg(0, *imgSrc);
         kernel.setArg(1, *imgDst);
         kernel.setArg(2, bufferKernel1);
         kernel.setArg(3, border);
@@ -39,6 +78,7 @@ cl::Event KernelFilterImages::runSingle(const cl::Image2D& imgSrc, SPImage2D& im
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filter.name, cols, costFilter(cols, rows, 1, kernel1), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -47,8 +87,8 @@ cl::Event KernelFilterImages::runSingle(const cl::Image2D& imgSrc, SPImage2D& im
     }
     else
     {
-        cl::Kernel kernel(*program, "filter_single");
-        kernel.setArg(0, imgSrc);
+        cl::Kernel kernel = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
+        kernel.setArg(0, *imgSrc);
         kernel.setArg(1, *imgDst);
         kernel.setArg(2, bufferKernel1);
         kernel.setArg(3, kernel1.rows / 2);
@@ -59,6 +99,7 @@ cl::Event KernelFilterImages::runSingle(const cl::Image2D& imgSrc, SPImage2D& im
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, 1, kernel1), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -67,24 +108,29 @@ cl::Event KernelFilterImages::runSingle(const cl::Image2D& imgSrc, SPImage2D& im
     }
 }
 
-cl::Event KernelFilterImages::runSingleLocal(const cl::Image2D& imgSrc, SPImage2D& imgDst)
+cl::Event KernelFilterImages::runSingleLocal(const ImageLevel& imgSrc, ImageLevel& imgDst)
 {
-    const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = imgSrc.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(imgSrc.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(imgSrc.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
 
-    imgDst = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+
+    const KernelRegistry::Kernel& filter = filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL, kernel1.rows, kernel1.cols);
 
-    if (useUnrollFilter(kernel1.rows, kernel1.cols))
+    // The dilated filter reads only the non-zero taps which is cheaper than loading the complete tile to local memory
+    const cv::Size dilation = filterDilation(kernel1);
+    if (dilation != cv::Size())
     {
-        std::string filterName = "filter_single_local_" + std::to_string(kernel1.rows) + "x" + std::to_string(kernel1.cols);
+        return runSingleDilated(*imgSrc, *imgDst, bufferKernel1, kernel1, dilation, cols, rows);
+    }
 
-        cl::Kernel kernel(*program, filterName.c_str());
-        kernel.setArg(0, imgSrc);
+    if (filter.unrolled())
+    {
+        cl::Kernel kernel = programs->kernel(filter.name);
+        kernel.setArg(0, *imgSrc);
         kernel.setArg(1, *imgDst);
         kernel.setArg(2, bufferKernel1);
         kernel.setArg(3, border);
@@ -92,6 +138,7 @@ cl::Event KernelFilterImages::runSingleLocal(const cl::Image2D& imgSrc, SPImage2
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filter.name, cols, costFilterLocal(cols, rows, 1, kernel1), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -100,8 +147,8 @@ cl::Event KernelFilterImages::runSingleLocal(const cl::Image2D& imgSrc, SPImage2
     }
     else
     {
-        cl::Kernel kernel(*program, "filter_single_local");
-        kernel.setArg(0, imgSrc);
+        cl::Kernel kernel = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL).name);
+        kernel.setArg(0, *imgSrc);
         kernel.setArg(1, *imgDst);
         kernel.setArg(2, bufferKernel1);
         kernel.setArg(3, kernel1.rows / 2);
@@ -112,6 +159,7 @@ cl::Event KernelFilterImages::runSingleLocal(const cl::Image2D& imgSrc, SPImage2
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL).name, cols, costFilterLocal(cols, rows, 1, kernel1), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -120,95 +168,85 @@ cl::Event KernelFilterImages::runSingleLocal(const cl::Image2D& imgSrc, SPImage2
     }
 }
 
-cl::Event KernelFilterImages::runSingleLocalOnePass(const cl::Image2D& imgSrc, SPImage2D& imgDst)
+cl::Event KernelFilterImages::runSingleSliding(const ImageLevel& imgSrc, ImageLevel& imgDst)
 {
-    const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = imgSrc.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(imgSrc.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(imgSrc.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
+    ASSERT(kernel1.rows <= 21 && kernel1.cols <= 21, "The ring buffer of the sliding kernel supports filters up to 21x21");
 
-    imgDst = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
 
-    if (useUnrollFilter(kernelSeparation1A.rows, kernelSeparation1A.cols, kernelSeparation1B.rows, kernelSeparation1B.cols))
-    {
-        std::string filterName = "filter_single_local_onePass_" + std::to_string(kernelSeparation1A.cols) + "x" + std::to_string(kernelSeparation1B.rows);
-
-        cl::Kernel kernel(*program, filterName.c_str());
-        kernel.setArg(0, imgSrc);
-        kernel.setArg(1, *imgDst);
-        kernel.setArg(2, bufferKernelSeparation1A);
-        kernel.setArg(3, bufferKernelSeparation1B);
-        kernel.setArg(4, border);
-
-        cl::Event eventFilter;
-        const cl::NDRange global(cols, rows);
-        queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events);
-
-        // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
-        events.clear();
-
-        return eventFilter;
-    }
-    else
-    {
-        cl::Kernel kernel(*program, "filter_single_local_onePass");
-        kernel.setArg(0, imgSrc);
-        kernel.setArg(1, *imgDst);
-        kernel.setArg(2, bufferKernelSeparation1A);
-        kernel.setArg(3, bufferKernelSeparation1B);
-        kernel.setArg(4, kernelSeparation1A.cols / 2);
-        kernel.setArg(5, kernelSeparation1A.cols);
-        kernel.setArg(6, kernelSeparation1A.cols / 2);
-        kernel.setArg(7, border);
-
-        cl::Event eventFilter;
-        const cl::NDRange global(cols, rows);
-        queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events);
+    cl::Kernel kernel = programs->kernel("filter_single_sliding");
+    kernel.setArg(0, *imgSrc);
+    kernel.setArg(1, *imgDst);
+    kernel.setArg(2, bufferKernel1);
+    kernel.setArg(3, kernel1.rows / 2);
+    kernel.setArg(4, kernel1.cols);
+    kernel.setArg(5, kernel1.cols / 2);
+    kernel.setArg(6, static_cast<int>(chunkRowsSliding));
+    kernel.setArg(7, border);
+
+    // One work-group per strip and chunk of rows
+    cl::Event eventFilter;
+    const size_t strips = (cols + stripWidthSliding - 1) / stripWidthSliding;
+    const size_t chunks = (rows + chunkRowsSliding - 1) / chunkRowsSliding;
+    const cl::NDRange global(strips * stripWidthSliding, chunks);
+    const cl::NDRange localSliding(stripWidthSliding, 1);
+    queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, localSliding, &events, &eventFilter);
+    recordLaunch("filter_single_sliding", cols, CostModel::filterSliding(storage, cols, rows, 1, kernel1.rows, kernel1.cols, stripWidthSliding, chunkRowsSliding), eventFilter);
 
-        // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
-        events.clear();
+    // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
+    events.clear();
 
-        return eventFilter;
-    }
+    return eventFilter;
 }
 
-cl::Event KernelFilterImages::runSingleSeparation(const cl::Image2D& imgSrc, SPImage2D& imgDst)
+cl::Event KernelFilterImages::runSingleSeparation(const ImageLevel& imgSrc, ImageLevel& imgDst)
 {
-    const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = imgSrc.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(imgSrc.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(imgSrc.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
 
     cl::Image2D imgTmp(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
-    imgDst = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
 
-    if (useUnrollFilter(kernelSeparation1A.rows, kernelSeparation1A.cols, kernelSeparation1B.rows, kernelSeparation1B.cols))
+    const KernelRegistry::Kernel& filterX = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernelSeparation1A.rows, kernelSeparation1A.cols);
+    const KernelRegistry::Kernel& filterY = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernelSeparation1B.rows, kernelSeparation1B.cols);
+
+    const cv::Size dilationX = filterDilation(kernelSeparation1A);
+    const cv::Size dilationY = filterDilation(kernelSeparation1B);
+    if (dilationX != cv::Size() && dilationY != cv::Size())
     {
-        std::string filterNameX = "filter_single_" + std::to_string(kernelSeparation1A.rows) + "x" + std::to_string(kernelSeparation1A.cols);
-        std::string filterNameY = "filter_single_" + std::to_string(kernelSeparation1B.rows) + "x" + std::to_string(kernelSeparation1B.cols);
+        runSingleDilated(*imgSrc, imgTmp, bufferKernelSeparation1A, kernelSeparation1A, dilationX, cols, rows);
+        return runSingleDilated(imgTmp, *imgDst, bufferKernelSeparation1B, kernelSeparation1B, dilationY, cols, rows);
+    }
 
-        cl::Kernel kernelX(*program, filterNameX.c_str());
-        kernelX.setArg(0, imgSrc);
+    if (filterX.unrolled() && filterY.unrolled())
+    {
+        cl::Kernel kernelX = programs->kernel(filterX.name);
+        kernelX.setArg(0, *imgSrc);
         kernelX.setArg(1, imgTmp);
         kernelX.setArg(2, bufferKernelSeparation1A);
         kernelX.setArg(3, border);
 
-        cl::Kernel kernelY(*program, filterNameY.c_str());
+        cl::Kernel kernelY = programs->kernel(filterY.name);
         kernelY.setArg(0, imgTmp);
         kernelY.setArg(1, *imgDst);
         kernelY.setArg(2, bufferKernelSeparation1B);
         kernelY.setArg(3, border);
 
         cl::Event eventFilter;
+        cl::Event eventFilterX;
         const cl::NDRange global(cols, rows);
-        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events);
+        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events, &eventFilterX);
         queue->enqueueNDRangeKernel(kernelY, cl::NullRange, global, local, nullptr, &eventFilter);
+        recordLaunch(filterX.name, cols, costFilter(cols, rows, 1, kernelSeparation1A), eventFilterX);
+        recordLaunch(filterY.name, cols, costFilter(cols, rows, 1, kernelSeparation1B), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -217,8 +255,8 @@ cl::Event KernelFilterImages::runSingleSeparation(const cl::Image2D& imgSrc, SPI
     }
     else
     {
-        cl::Kernel kernelX(*program, "filter_single");
-        kernelX.setArg(0, imgSrc);
+        cl::Kernel kernelX = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
+        kernelX.setArg(0, *imgSrc);
         kernelX.setArg(1, imgTmp);
         kernelX.setArg(2, bufferKernelSeparation1A);
         kernelX.setArg(3, kernelSeparation1A.rows / 2);
@@ -226,7 +264,7 @@ cl::Event KernelFilterImages::runSingleSeparation(const cl::Image2D& imgSrc, SPI
         kernelX.setArg(5, kernelSeparation1A.cols / 2);
         kernelX.setArg(6, border);
 
-        cl::Kernel kernelY(*program, "filter_single");
+        cl::Kernel kernelY = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
         kernelY.setArg(0, imgTmp);
         kernelY.setArg(1, *imgDst);
         kernelY.setArg(2, bufferKernelSeparation1B);
@@ -236,9 +274,12 @@ cl::Event KernelFilterImages::runSingleSeparation(const cl::Image2D& imgSrc, SPI
         kernelY.setArg(6, border);
 
         cl::Event eventFilter;
+        cl::Event eventFilterX;
         const cl::NDRange global(cols, rows);
-        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events);
+        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events, &eventFilterX);
         queue->enqueueNDRangeKernel(kernelY, cl::NullRange, global, local, nullptr, &eventFilter);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, 1, kernelSeparation1A), eventFilterX);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, 1, kernelSeparation1B), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -247,40 +288,50 @@ cl::Event KernelFilterImages::runSingleSeparation(const cl::Image2D& imgSrc, SPI
     }
 }
 
-cl::Event KernelFilterImages::runSingleSeparationLocal(const cl::Image2D& imgSrc, SPImage2D& imgDst)
+cl::Event KernelFilterImages::runSingleSeparationLocal(const ImageLevel& imgSrc, ImageLevel& imgDst)
 {
-    const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = imgSrc.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(imgSrc.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(imgSrc.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
 
     cl::Image2D imgTmp(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
-    imgDst = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
 
-    if (useUnrollFilter(kernelSeparation1A.rows, kernelSeparation1A.cols, kernelSeparation1B.rows, kernelSeparation1B.cols))
+    const KernelRegistry::Kernel& filterX = filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL, kernelSeparation1A.rows, kernelSeparation1A.cols);
+    const KernelRegistry::Kernel& filterY = filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL, kernelSeparation1B.rows, kernelSeparation1B.cols);
+
+    // The dilated filter reads only the non-zero taps which is cheaper than loading the complete tile to local memory
+    const cv::Size dilationX = filterDilation(kernelSeparation1A);
+    const cv::Size dilationY = filterDilation(kernelSeparation1B);
+    if (dilationX != cv::Size() && dilationY != cv::Size())
     {
-        std::string filterNameX = "filter_single_local_" + std::to_string(kernelSeparation1A.rows) + "x" + std::to_string(kernelSeparation1A.cols);
-        std::string filterNameY = "filter_single_local_" + std::to_string(kernelSeparation1B.rows) + "x" + std::to_string(kernelSeparation1B.cols);
+        runSingleDilated(*imgSrc, imgTmp, bufferKernelSeparation1A, kernelSeparation1A, dilationX, cols, rows);
+        return runSingleDilated(imgTmp, *imgDst, bufferKernelSeparation1B, kernelSeparation1B, dilationY, cols, rows);
+    }
 
-        cl::Kernel kernelX(*program, filterNameX.c_str());
-        kernelX.setArg(0, imgSrc);
+    if (filterX.unrolled() && filterY.unrolled())
+    {
+        cl::Kernel kernelX = programs->kernel(filterX.name);
+        kernelX.setArg(0, *imgSrc);
         kernelX.setArg(1, imgTmp);
         kernelX.setArg(2, bufferKernelSeparation1A);
         kernelX.setArg(3, border);
 
-        cl::Kernel kernelY(*program, filterNameY.c_str());
+        cl::Kernel kernelY = programs->kernel(filterY.name);
         kernelY.setArg(0, imgTmp);
         kernelY.setArg(1, *imgDst);
         kernelY.setArg(2, bufferKernelSeparation1B);
         kernelY.setArg(3, border);
 
         cl::Event eventFilter;
+        cl::Event eventFilterX;
         const cl::NDRange global(cols, rows);
-        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events);
+        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events, &eventFilterX);
         queue->enqueueNDRangeKernel(kernelY, cl::NullRange, global, local, nullptr, &eventFilter);
+        recordLaunch(filterX.name, cols, costFilterLocal(cols, rows, 1, kernelSeparation1A), eventFilterX);
+        recordLaunch(filterY.name, cols, costFilterLocal(cols, rows, 1, kernelSeparation1B), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -289,8 +340,8 @@ cl::Event KernelFilterImages::runSingleSeparationLocal(const cl::Image2D& imgSrc
     }
     else
     {
-        cl::Kernel kernelX(*program, "filter_single_local");
-        kernelX.setArg(0, imgSrc);
+        cl::Kernel kernelX = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL).name);
+        kernelX.setArg(0, *imgSrc);
         kernelX.setArg(1, imgTmp);
         kernelX.setArg(2, bufferKernelSeparation1A);
         kernelX.setArg(3, kernelSeparation1A.rows / 2);
@@ -298,7 +349,7 @@ cl::Event KernelFilterImages::runSingleSeparationLocal(const cl::Image2D& imgSrc
         kernelX.setArg(5, kernelSeparation1A.cols / 2);
         kernelX.setArg(6, border);
 
-        cl::Kernel kernelY(*program, "filter_single_local");
+        cl::Kernel kernelY = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL).name);
         kernelY.setArg(0, imgTmp);
         kernelY.setArg(1, *imgDst);
         kernelY.setArg(2, bufferKernelSeparation1B);
@@ -308,9 +359,12 @@ cl::Event KernelFilterImages::runSingleSeparationLocal(const cl::Image2D& imgSrc
         kernelY.setArg(6, border);
 
         cl::Event eventFilter;
+        cl::Event eventFilterX;
         const cl::NDRange global(cols, rows);
-        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events);
+        queue->enqueueNDRangeKernel(kernelX, cl::NullRange, global, local, &events, &eventFilterX);
         queue->enqueueNDRangeKernel(kernelY, cl::NullRange, global, local, nullptr, &eventFilter);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL).name, cols, costFilterLocal(cols, rows, 1, kernelSeparation1A), eventFilterX);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::LOCAL).name, cols, costFilterLocal(cols, rows, 1, kernelSeparation1B), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -319,28 +373,28 @@ cl::Event KernelFilterImages::runSingleSeparationLocal(const cl::Image2D& imgSrc
     }
 }
 
-cl::Event KernelFilterImages::runSinglePredefined(const cl::Image2D& imgSrc, SPImage2D& imgDst, const std::string& name, const std::string& size)
+cl::Event KernelFilterImages::runSinglePredefined(const ImageLevel& imgSrc, ImageLevel& imgDst, const KernelRegistry::Derivative derivative, const cv::Size& size)
 {
-    const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = imgSrc.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(imgSrc.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(imgSrc.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
 
-    imgDst = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
 
-    std::string filterName = "filter_single_" + name + "_" + size;
+    const KernelRegistry::Kernel& filter = KernelRegistry::getPredefined(KernelRegistry::NORMAL, derivative, size.height, size.width);
+    ASSERT(filter.name != nullptr, "No predefined kernel for this filter size");
 
-    cl::Kernel kernel(*program, filterName.c_str());
-    kernel.setArg(0, imgSrc);
+    cl::Kernel kernel = programs->kernel(filter.name);
+    kernel.setArg(0, *imgSrc);
     kernel.setArg(1, *imgDst);
     kernel.setArg(2, border);
 
     cl::Event eventFilter;
     const cl::NDRange global(cols, rows);
     queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+    recordLaunch(filter.name, cols, costFilter(cols, rows, 1, size), eventFilter);
 
     // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
     events.clear();
@@ -348,28 +402,28 @@ cl::Event KernelFilterImages::runSinglePredefined(const cl::Image2D& imgSrc, SPI
     return eventFilter;
 }
 
-cl::Event KernelFilterImages::runSinglePredefinedLocal(const cl::Image2D& imgSrc, SPImage2D& imgDst, const std::string& name, const std::string& size)
+cl::Event KernelFilterImages::runSinglePredefinedLocal(const ImageLevel& imgSrc, ImageLevel& imgDst, const KernelRegistry::Derivative derivative, const cv::Size& size)
 {
-    const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = imgSrc.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(imgSrc.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(imgSrc.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
 
-    imgDst = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
 
-    std::string filterName = "filter_single_local_" + name + "_" + size;
+    const KernelRegistry::Kernel& filter = KernelRegistry::getPredefined(KernelRegistry::LOCAL, derivative, size.height, size.width);
+    ASSERT(filter.name != nullptr, "No predefined kernel for this filter size");
 
-    cl::Kernel kernel(*program, filterName.c_str());
-    kernel.setArg(0, imgSrc);
+    cl::Kernel kernel = programs->kernel(filter.name);
+    kernel.setArg(0, *imgSrc);
     kernel.setArg(1, *imgDst);
     kernel.setArg(2, border);
 
     cl::Event eventFilter;
     const cl::NDRange global(cols, rows);
     queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+    recordLaunch(filter.name, cols, costFilterLocal(cols, rows, 1, size), eventFilter);
 
     // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
     events.clear();
@@ -377,26 +431,30 @@ cl::Event KernelFilterImages::runSinglePredefinedLocal(const cl::Image2D& imgSrc
     return eventFilter;
 }
 
-cl::Event KernelFilterImages::runDouble(const cl::Image2D& imgSrc, SPImage2D& imgDst1, SPImage2D& imgDst2)
+cl::Event KernelFilterImages::runDouble(const ImageLevel& imgSrc, ImageLevel& imgDst1, ImageLevel& imgDst2)
 {
-    const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = imgSrc.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(imgSrc.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(imgSrc.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
     ASSERT(kernel1.size == kernel2.size, "Both filter must have the same size");
 
-    imgDst1 = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
-    imgDst2 = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst1 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+    imgDst2 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
 
-    if (useUnrollFilter(kernel1.rows, kernel1.cols))
+    const KernelRegistry::Kernel& filter = filterKernel(KernelRegistry::DOUBLE, KernelRegistry::NORMAL, kernel1.rows, kernel1.cols);
+
+    const cv::Size dilation = filterDilation(kernel1, kernel2);
+    if (dilation != cv::Size())
     {
-        std::string filterName = "filter_double_" + std::to_string(kernel1.rows) + "x" + std::to_string(kernel1.cols);
+        return runDoubleDilated(*imgSrc, *imgDst1, *imgDst2, bufferKernel1, bufferKernel2, kernel1, dilation, cols, rows);
+    }
 
-        cl::Kernel kernel(*program, filterName.c_str());
-        kernel.setArg(0, imgSrc);
+    if (filter.unrolled())
+    {
+        cl::Kernel kernel = programs->kernel(filter.name);
+        kernel.setArg(0, *imgSrc);
         kernel.setArg(1, *imgDst1);
         kernel.setArg(2, *imgDst2);
         kernel.setArg(3, bufferKernel1);
@@ -406,6 +464,7 @@ cl::Event KernelFilterImages::runDouble(const cl::Image2D& imgSrc, SPImage2D& im
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filter.name, cols, costFilter(cols, rows, 1, kernel1, 2), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -414,8 +473,8 @@ cl::Event KernelFilterImages::runDouble(const cl::Image2D& imgSrc, SPImage2D& im
     }
     else
     {
-        cl::Kernel kernel(*program, "filter_double");
-        kernel.setArg(0, imgSrc);
+        cl::Kernel kernel = programs->kernel(filterKernel(KernelRegistry::DOUBLE, KernelRegistry::NORMAL).name);
+        kernel.setArg(0, *imgSrc);
         kernel.setArg(1, *imgDst1);
         kernel.setArg(2, *imgDst2);
         kernel.setArg(3, bufferKernel1);
@@ -428,6 +487,7 @@ cl::Event KernelFilterImages::runDouble(const cl::Image2D& imgSrc, SPImage2D& im
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filterKernel(KernelRegistry::DOUBLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, 1, kernel1, 2), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -436,26 +496,88 @@ cl::Event KernelFilterImages::runDouble(const cl::Image2D& imgSrc, SPImage2D& im
     }
 }
 
-cl::Event KernelFilterImages::runDoubleLocal(const cl::Image2D& imgSrc, SPImage2D& imgDst1, SPImage2D& imgDst2)
+cl::Event KernelFilterImages::runDoubleWinograd(const ImageLevel& imgSrc, ImageLevel& imgDst1, ImageLevel& imgDst2)
 {
-    const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = imgSrc.getImageInfo<CL_IMAGE_WIDTH>();
+    // Winograd kernels only exist for the dense 3x3 and 5x5 filters
+    const KernelRegistry::Kernel& filter = KernelRegistry::getWinograd(kernel1.rows, kernel1.cols);
+    if (kernel1.size != kernel2.size || filter.name == nullptr)
+    {
+        return runDouble(imgSrc, imgDst1, imgDst2);
+    }
+
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(imgSrc.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(imgSrc.readable(), "Can't read the input image");
+    ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
+
+    imgDst1 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+    imgDst2 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+
+    // The transformed filters are only calculated once for all images of the pyramid
+    if (winogradSource1.data != kernel1.data || winogradSource2.data != kernel2.data)
+    {
+        const auto uploadTransformed = [&](const cv::Mat& filter, cl::Buffer& buffer)
+        {
+            const cv::Mat transformed = winogradFilterTransform(filter);
+            const size_t size = sizeof(float) * transformed.rows * transformed.cols;
+            buffer = cl::Buffer(*context, CL_MEM_READ_ONLY, size);
+
+            // Blocking since the transformed filter is a local variable
+            queue->enqueueWriteBuffer(buffer, CL_BLOCKING, 0, size, transformed.data);
+        };
+
+        uploadTransformed(kernel1, bufferWinograd1);
+        uploadTransformed(kernel2, bufferWinograd2);
+        winogradSource1 = kernel1;
+        winogradSource2 = kernel2;
+    }
+
+    cl::Kernel kernel = programs->kernel(filter.name);
+    kernel.setArg(0, *imgSrc);
+    kernel.setArg(1, *imgDst1);
+    kernel.setArg(2, *imgDst2);
+    kernel.setArg(3, bufferWinograd1);
+    kernel.setArg(4, bufferWinograd2);
+    kernel.setArg(5, border);
+
+    // One work-item per 2x2 output tile
+    cl::Event eventFilter;
+    const cl::NDRange global((cols + 1) / 2, (rows + 1) / 2);
+    queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+    recordLaunch(filter.name, cols, CostModel::filterWinograd(storage, cols, rows, kernel1.rows, 2), eventFilter);
+
+    // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
+    events.clear();
+
+    return eventFilter;
+}
+
+cl::Event KernelFilterImages::runDoubleLocal(const ImageLevel& imgSrc, ImageLevel& imgDst1, ImageLevel& imgDst2)
+{
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
+
+    ASSERT(imgSrc.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
     ASSERT(kernel1.size == kernel2.size, "Both filter must have the same size");
 
-    imgDst1 = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
-    imgDst2 = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst1 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+    imgDst2 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+
+    const KernelRegistry::Kernel& filter = filterKernel(KernelRegistry::DOUBLE, KernelRegistry::LOCAL, kernel1.rows, kernel1.cols);
 
-    if (useUnrollFilter(kernel1.rows, kernel1.cols))
+    // The dilated filter reads only the non-zero taps which is cheaper than loading the complete tile to local memory
+    const cv::Size dilation = filterDilation(kernel1, kernel2);
+    if (dilation != cv::Size())
     {
-        std::string filterName = "filter_double_local_" + std::to_string(kernel1.rows) + "x" + std::to_string(kernel1.cols);
+        return runDoubleDilated(*imgSrc, *imgDst1, *imgDst2, bufferKernel1, bufferKernel2, kernel1, dilation, cols, rows);
+    }
 
-        cl::Kernel kernel(*program, filterName.c_str());
-        kernel.setArg(0, imgSrc);
+    if (filter.unrolled())
+    {
+        cl::Kernel kernel = programs->kernel(filter.name);
+        kernel.setArg(0, *imgSrc);
         kernel.setArg(1, *imgDst1);
         kernel.setArg(2, *imgDst2);
         kernel.setArg(3, bufferKernel1);
@@ -465,6 +587,7 @@ cl::Event KernelFilterImages::runDoubleLocal(const cl::Image2D& imgSrc, SPImage2
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filter.name, cols, costFilterLocal(cols, rows, 1, kernel1, 2), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -473,8 +596,8 @@ cl::Event KernelFilterImages::runDoubleLocal(const cl::Image2D& imgSrc, SPImage2
     }
     else
     {
-        cl::Kernel kernel(*program, "filter_double_local");
-        kernel.setArg(0, imgSrc);
+        cl::Kernel kernel = programs->kernel(filterKernel(KernelRegistry::DOUBLE, KernelRegistry::LOCAL).name);
+        kernel.setArg(0, *imgSrc);
         kernel.setArg(1, *imgDst1);
         kernel.setArg(2, *imgDst2);
         kernel.setArg(3, bufferKernel1);
@@ -487,6 +610,7 @@ cl::Event KernelFilterImages::runDoubleLocal(const cl::Image2D& imgSrc, SPImage2
         cl::Event eventFilter;
         const cl::NDRange global(cols, rows);
         queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+        recordLaunch(filterKernel(KernelRegistry::DOUBLE, KernelRegistry::LOCAL).name, cols, costFilterLocal(cols, rows, 1, kernel1, 2), eventFilter);
 
         // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
         events.clear();
@@ -495,56 +619,69 @@ cl::Event KernelFilterImages::runDoubleLocal(const cl::Image2D& imgSrc, SPImage2
     }
 }
 
-cl::Event KernelFilterImages::runDoubleSeparation(const cl::Image2D& img, SPImage2D& imgDst1, SPImage2D& imgDst2)
+cl::Event KernelFilterImages::runDoubleSeparation(const ImageLevel& img, ImageLevel& imgDst1, ImageLevel& imgDst2)
 {
     ASSERT(kernelSeparation1A.size == kernelSeparation2A.size, "Both A filters must be of same size");
     ASSERT(kernelSeparation1B.size == kernelSeparation2B.size, "Both B filters must be of same size");
 
-    const size_t rows = img.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = img.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = img.rows;
+    const size_t cols = img.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(img.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(img.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || img.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(img.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
 
     cl::Image2D imgTmp1(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
     cl::Image2D imgTmp2(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
 
-    imgDst1 = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
-    imgDst2 = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst1 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+    imgDst2 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
 
-    if (useUnrollFilter(kernelSeparation1A.rows, kernelSeparation1A.cols, kernelSeparation1B.rows, kernelSeparation1B.cols))
+    const KernelRegistry::Kernel& filter1 = filterKernel(KernelRegistry::DOUBLE, KernelRegistry::NORMAL, kernelSeparation1A.rows, kernelSeparation1A.cols);
+    const KernelRegistry::Kernel& filter2 = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernelSeparation1B.rows, kernelSeparation1B.cols);
+    const KernelRegistry::Kernel& filter3 = filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL, kernelSeparation2B.rows, kernelSeparation2B.cols);
+
+    const cv::Size dilationA = filterDilation(kernelSeparation1A, kernelSeparation2A);
+    const cv::Size dilation1B = filterDilation(kernelSeparation1B);
+    const cv::Size dilation2B = filterDilation(kernelSeparation2B);
+    if (dilationA != cv::Size() && dilation1B != cv::Size() && dilation2B != cv::Size())
     {
-        std::string filterName1 = "filter_double_" + std::to_string(kernelSeparation1A.rows) + "x" + std::to_string(kernelSeparation1A.cols);
-        std::string filterName2 = "filter_single_" + std::to_string(kernelSeparation1B.rows) + "x" + std::to_string(kernelSeparation1B.cols);
-        std::string filterName3 = "filter_single_" + std::to_string(kernelSeparation2B.rows) + "x" + std::to_string(kernelSeparation2B.cols);
+        runDoubleDilated(*img, imgTmp1, imgTmp2, bufferKernelSeparation1A, bufferKernelSeparation2A, kernelSeparation1A, dilationA, cols, rows);
+        runSingleDilated(imgTmp1, *imgDst1, bufferKernelSeparation1B, kernelSeparation1B, dilation1B, cols, rows);
+        return runSingleDilated(imgTmp2, *imgDst2, bufferKernelSeparation2B, kernelSeparation2B, dilation2B, cols, rows);
+    }
 
-        cl::Kernel kernelStep1(*program, filterName1.c_str());
-        kernelStep1.setArg(0, img);
+    if (filter1.unrolled() && filter2.unrolled() && filter3.unrolled())
+    {
+        cl::Kernel kernelStep1 = programs->kernel(filter1.name);
+        kernelStep1.setArg(0, *img);
         kernelStep1.setArg(1, imgTmp1);
         kernelStep1.setArg(2, imgTmp2);
         kernelStep1.setArg(3, bufferKernelSeparation1A);
         kernelStep1.setArg(4, bufferKernelSeparation2A);
         kernelStep1.setArg(5, border);
 
-        cl::Kernel kernelStep2(*program, filterName2.c_str());
+        cl::Kernel kernelStep2 = programs->kernel(filter2.name);
         kernelStep2.setArg(0, imgTmp1);
         kernelStep2.setArg(1, *imgDst1);
         kernelStep2.setArg(2, bufferKernelSeparation1B);
         kernelStep2.setArg(3, border);
 
-        cl::Kernel kernelStep3(*program, filterName3.c_str());
+        cl::Kernel kernelStep3 = programs->kernel(filter3.name);
         kernelStep3.setArg(0, imgTmp2);
         kernelStep3.setArg(1, *imgDst2);
         kernelStep3.setArg(2, bufferKernelSeparation2B);
         kernelStep3.setArg(3, border);
 
         cl::Event eventKernel;
+        cl::Event eventStep1;
+        cl::Event eventStep2;
         const cl::NDRange global(cols, rows);
-        queue->enqueueNDRangeKernel(kernelStep1, cl::NullRange, global, local, &events);
-        queue->enqueueNDRangeKernel(kernelStep2, cl::NullRange, global, local);
+        queue->enqueueNDRangeKernel(kernelStep1, cl::NullRange, global, local, &events, &eventStep1);
+        queue->enqueueNDRangeKernel(kernelStep2, cl::NullRange, global, local, nullptr, &eventStep2);
         queue->enqueueNDRangeKernel(kernelStep3, cl::NullRange, global, local, nullptr, &eventKernel);
+        recordLaunch(filter1.name, cols, costFilter(cols, rows, 1, kernelSeparation1A, 2), eventStep1);
+        recordLaunch(filter2.name, cols, costFilter(cols, rows, 1, kernelSeparation1B), eventStep2);
+        recordLaunch(filter3.name, cols, costFilter(cols, rows, 1, kernelSeparation2B), eventKernel);
 
         events.clear();
 
@@ -552,8 +689,8 @@ cl::Event KernelFilterImages::runDoubleSeparation(const cl::Image2D& img, SPImag
     }
     else
     {
-        cl::Kernel kernelStep1(*program, "filter_double");
-        kernelStep1.setArg(0, img);
+        cl::Kernel kernelStep1 = programs->kernel(filterKernel(KernelRegistry::DOUBLE, KernelRegistry::NORMAL).name);
+        kernelStep1.setArg(0, *img);
         kernelStep1.setArg(1, imgTmp1);
         kernelStep1.setArg(2, imgTmp2);
         kernelStep1.setArg(3, bufferKernelSeparation1A);
@@ -563,7 +700,7 @@ cl::Event KernelFilterImages::runDoubleSeparation(const cl::Image2D& img, SPImag
         kernelStep1.setArg(7, kernelSeparation1A.cols / 2);
         kernelStep1.setArg(8, border);
 
-        cl::Kernel kernelStep2(*program, "filter_single");
+        cl::Kernel kernelStep2 = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
         kernelStep2.setArg(0, imgTmp1);
         kernelStep2.setArg(1, *imgDst1);
         kernelStep2.setArg(2, bufferKernelSeparation1B);
@@ -572,7 +709,7 @@ cl::Event KernelFilterImages::runDoubleSeparation(const cl::Image2D& img, SPImag
         kernelStep2.setArg(5, kernelSeparation1B.cols / 2);
         kernelStep2.setArg(6, border);
 
-        cl::Kernel kernelStep3(*program, "filter_single");
+        cl::Kernel kernelStep3 = programs->kernel(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name);
         kernelStep3.setArg(0, imgTmp2);
         kernelStep3.setArg(1, *imgDst2);
         kernelStep3.setArg(2, bufferKernelSeparation2B);
@@ -582,10 +719,15 @@ cl::Event KernelFilterImages::runDoubleSeparation(const cl::Image2D& img, SPImag
         kernelStep3.setArg(6, border);
 
         cl::Event eventKernel;
+        cl::Event eventStep1;
+        cl::Event eventStep2;
         const cl::NDRange global(cols, rows);
-        queue->enqueueNDRangeKernel(kernelStep1, cl::NullRange, global, local, &events);
-        queue->enqueueNDRangeKernel(kernelStep2, cl::NullRange, global, local);
+        queue->enqueueNDRangeKernel(kernelStep1, cl::NullRange, global, local, &events, &eventStep1);
+        queue->enqueueNDRangeKernel(kernelStep2, cl::NullRange, global, local, nullptr, &eventStep2);
         queue->enqueueNDRangeKernel(kernelStep3, cl::NullRange, global, local, nullptr, &eventKernel);
+        recordLaunch(filterKernel(KernelRegistry::DOUBLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, 1, kernelSeparation1A, 2), eventStep1);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, 1, kernelSeparation1B), eventStep2);
+        recordLaunch(filterKernel(KernelRegistry::SINGLE, KernelRegistry::NORMAL).name, cols, costFilter(cols, rows, 1, kernelSeparation2B), eventKernel);
 
         events.clear();
 
@@ -593,24 +735,23 @@ cl::Event KernelFilterImages::runDoubleSeparation(const cl::Image2D& img, SPImag
     }
 }
 
-cl::Event KernelFilterImages::runDoublePredefined(const cl::Image2D& img, SPImage2D& imgDst1, SPImage2D& imgDst2, const std::string& name, const std::string& size)
+cl::Event KernelFilterImages::runDoublePredefined(const ImageLevel& img, ImageLevel& imgDst1, ImageLevel& imgDst2, const cv::Size& size)
 {
-    const size_t rows = img.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = img.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = img.rows;
+    const size_t cols = img.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(img.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(img.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || img.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(img.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
     ASSERT(kernel1.size == kernel2.size, "Both filter must have the same size");
 
-    imgDst1 = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
-    imgDst2 = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst1 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+    imgDst2 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
 
-    std::string filterName = "filter_double_" + name + "_" + size;
+    const KernelRegistry::Kernel& filter = KernelRegistry::getPredefined(KernelRegistry::NORMAL, KernelRegistry::GXGY, size.height, size.width);
+    ASSERT(filter.name != nullptr, "No predefined kernel for this filter size");
 
-    cl::Kernel kernel(*program, filterName.c_str());
-    kernel.setArg(0, img);
+    cl::Kernel kernel = programs->kernel(filter.name);
+    kernel.setArg(0, *img);
     kernel.setArg(1, *imgDst1);
     kernel.setArg(2, *imgDst2);
     kernel.setArg(3, border);
@@ -618,6 +759,7 @@ cl::Event KernelFilterImages::runDoublePredefined(const cl::Image2D& img, SPImag
     cl::Event eventFilter;
     const cl::NDRange global(cols, rows);
     queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+    recordLaunch(filter.name, cols, costFilter(cols, rows, 1, size, 2), eventFilter);
 
     // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
     events.clear();
@@ -625,24 +767,23 @@ cl::Event KernelFilterImages::runDoublePredefined(const cl::Image2D& img, SPImag
     return eventFilter;
 }
 
-cl::Event KernelFilterImages::runDoublePredefinedLocal(const cl::Image2D& img, SPImage2D& imgDst1, SPImage2D& imgDst2, const std::string& name, const std::string& size)
+cl::Event KernelFilterImages::runDoublePredefinedLocal(const ImageLevel& img, ImageLevel& imgDst1, ImageLevel& imgDst2, const cv::Size& size)
 {
-    const size_t rows = img.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = img.getImageInfo<CL_IMAGE_WIDTH>();
+    const size_t rows = img.rows;
+    const size_t cols = img.cols;
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(img.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(img.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || img.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    ASSERT(img.readable(), "Can't read the input image");
     ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
     ASSERT(kernel1.size == kernel2.size, "Both filter must have the same size");
 
-    imgDst1 = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
-    imgDst2 = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols, rows);
+    imgDst1 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+    imgDst2 = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
 
-    std::string filterName = "filter_double_local_" + name + "_" + size;
+    const KernelRegistry::Kernel& filter = KernelRegistry::getPredefined(KernelRegistry::LOCAL, KernelRegistry::GXGY, size.height, size.width);
+    ASSERT(filter.name != nullptr, "No predefined kernel for this filter size");
 
-    cl::Kernel kernel(*program, filterName.c_str());
-    kernel.setArg(0, img);
+    cl::Kernel kernel = programs->kernel(filter.name);
+    kernel.setArg(0, *img);
     kernel.setArg(1, *imgDst1);
     kernel.setArg(2, *imgDst2);
     kernel.setArg(3, border);
@@ -650,6 +791,7 @@ cl::Event KernelFilterImages::runDoublePredefinedLocal(const cl::Image2D& img, S
     cl::Event eventFilter;
     const cl::NDRange global(cols, rows);
     queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+    recordLaunch(filter.name, cols, costFilterLocal(cols, rows, 1, size, 2), eventFilter);
 
     // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
     events.clear();
@@ -657,24 +799,221 @@ cl::Event KernelFilterImages::runDoublePredefinedLocal(const cl::Image2D& img, S
     return eventFilter;
 }
 
-cl::Event KernelFilterImages::runHalfsampleImage(const cl::Image2D& imgSrc, SPImage2D& imgDst)
+void KernelFilterImages::setDecomposition(const FilterDecomposition& decomposition)
+{
+    // All filters of the strategy are transferred once so that the runs neither allocate device memory nor enqueue host --> device transfers
+    decompositionStrategy = decomposition.getStrategy();
+    decompositionTerms.clear();
+    for (const FilterDecomposition::Term& term : decomposition.getTerms())
+    {
+        decompositionTerms.push_back({ uploadFilter(term.column), uploadFilter(term.row) });
+    }
+    decompositionFilter = uploadFilter(decomposition.getFilter());
+}
+
+cl::Event KernelFilterImages::runDecomposed(const ImageLevel& imgSrc, ImageLevel& imgDst)
+{
+    ASSERT(!decompositionFilter.kernel.empty(), "No decomposition set");
+
+    switch (decompositionStrategy)
+    {
+        case FilterDecomposition::SEPARABLE:
+        case FilterDecomposition::SEPARABLE_SUM:
+        {
+            // Filter with every separable term and sum up the responses (the queue is in-order so no additional synchronization is necessary)
+            cl::Event eventFilter;
+            for (size_t i = 0; i < decompositionTerms.size(); ++i)
+            {
+                // The vectors of non-square filters have different sizes so they are set directly (the separable passes use the size of their own filter)
+                kernelSeparation1A = decompositionTerms[i][0].kernel;
+                kernelSeparation1B = decompositionTerms[i][1].kernel;
+                bufferKernelSeparation1A = decompositionTerms[i][0].buffer;
+                bufferKernelSeparation1B = decompositionTerms[i][1].buffer;
+
+                ImageLevel imgTerm;
+                eventFilter = runSingleSeparation(imgSrc, imgTerm);
+
+                if (i == 0)
+                {
+                    imgDst = imgTerm;
+                }
+                else
+                {
+                    ImageLevel imgSum;
+                    eventFilter = runAddImages(imgDst, imgTerm, imgSum);
+                    imgDst = imgSum;
+                }
+            }
+
+            return eventFilter;
+        }
+        case FilterDecomposition::DENSE_LOCAL:
+        {
+            setKernel1(decompositionFilter);
+            return runSingleLocal(imgSrc, imgDst);
+        }
+        case FilterDecomposition::SPARSE:
+        case FilterDecomposition::DENSE:
+        default:
+        {
+            setKernel1(decompositionFilter);
+            return runSingle(imgSrc, imgDst);
+        }
+    }
+}
+
+void KernelFilterImages::setSmoothingCoefficients(const FilterBank::Filter& smoothingCoefficients)
 {
-    const size_t rows = imgSrc.getImageInfo<CL_IMAGE_HEIGHT>();
-    const size_t cols = imgSrc.getImageInfo<CL_IMAGE_WIDTH>();
+    ASSERT(smoothingCoefficients.kernel.rows >= 4 && smoothingCoefficients.kernel.cols == 2, "The smoothing coefficients (border and centre value) for the sigma sizes 1-4 are required");
 
-    ASSERT(rows > 0 && cols > 0, "The image object seems to be invalid, no rows/cols set");
-    ASSERT(imgSrc.getImageInfo<CL_IMAGE_FORMAT>().image_channel_data_type == CL_FLOAT, "Only float type images are supported");
-    ASSERT(imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_ONLY || imgSrc.getInfo<CL_MEM_FLAGS>() == CL_MEM_READ_WRITE, "Can't read the input image");
+    bufferSmoothingCoefficients = smoothingCoefficients.buffer;
+}
 
-    imgDst = std::make_shared<cl::Image2D>(*context, CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_FLOAT), cols / 2, rows / 2);
+cl::Event KernelFilterImages::runDerivativesMultiSigmaLocal(const ImageLevel& imgSrc, std::array<ImageLevel, 4>& imgDstGx, std::array<ImageLevel, 4>& imgDstGy)
+{
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
 
-    cl::Kernel kernelConductivty(*program, "fed_resize");
-    kernelConductivty.setArg(0, imgSrc);
+    ASSERT(imgSrc.readable(), "Can't read the input image");
+    ASSERT(border == cv::BORDER_REPLICATE || border == cv::BORDER_REFLECT101, "Unsupported border type");
+    ASSERT(bufferSmoothingCoefficients(), "The smoothing coefficients must be set before the filter can be applied");
+    ASSERT(device->getInfo<CL_DEVICE_MAX_WRITE_IMAGE_ARGS>() >= 8, "The device does not support 8 write images per kernel");
+
+    cl::Kernel kernel = programs->kernel("filter_derivatives_multi_sigma_local");
+    kernel.setArg(0, *imgSrc);
+
+    for (size_t i = 0; i < imgDstGx.size(); ++i)
+    {
+        imgDstGx[i] = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+        imgDstGy[i] = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+
+        kernel.setArg(1 + i, *imgDstGx[i]);
+        kernel.setArg(1 + imgDstGx.size() + i, *imgDstGy[i]);
+    }
+
+    kernel.setArg(9, bufferSmoothingCoefficients);
+    kernel.setArg(10, border);
+
+    // One tile with the apron of the largest filter (9x9), the filters read 6 taps each (6 differences and 4 operations for Gx and Gy per sigma size)
+    KernelCost cost = costFilterLocal(cols, rows, 1, cv::Size(9, 9), 8);
+    cost.flops = 4 * (6 + 2 * 4) * static_cast<double>(cols * rows);
+
+    cl::Event eventFilter;
+    const cl::NDRange global(cols, rows);
+    queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+    recordLaunch("filter_derivatives_multi_sigma_local", cols, cost, eventFilter);
+
+    // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
+    events.clear();
+
+    return eventFilter;
+}
+
+cl::Event KernelFilterImages::runHalfsampleImage(const ImageLevel& imgSrc, ImageLevel& imgDst)
+{
+    const size_t rows = imgSrc.rows;
+    const size_t cols = imgSrc.cols;
+
+    ASSERT(imgSrc.readable(), "Can't read the input image");
+
+    imgDst = ImageLevel(*context, CL_MEM_READ_WRITE, cols / 2, rows / 2);
+
+    cl::Kernel kernelConductivty = programs->kernel("fed_resize");
+    kernelConductivty.setArg(0, *imgSrc);
     kernelConductivty.setArg(1, *imgDst);
 
     cl::Event event;
     const cl::NDRange global(cols / 2, rows / 2);
     queue->enqueueNDRangeKernel(kernelConductivty, cl::NullRange, global, cl::NullRange, &events, &event);
+    recordLaunch("fed_resize", cols, CostModel::pointwise(storage, (cols / 2) * (rows / 2), 4, 1, 4.0), event);
+
+    events.clear();
+
+    return event;
+}
+
+FilterBank::Filter KernelFilterImages::uploadFilter(const cv::Mat& kernel)
+{
+    FilterBank::Filter filter;
+    filter.kernel = kernel.isContinuous() ? kernel : kernel.clone();
+    filter.buffer = cl::Buffer(*context, CL_MEM_READ_ONLY, sizeof(float) * filter.kernel.rows * filter.kernel.cols);
+
+    cl::Event eventKernel;
+    queue->enqueueWriteBuffer(filter.buffer, CL_NON_BLOCKING, 0, sizeof(float) * filter.kernel.rows * filter.kernel.cols, filter.kernel.data, nullptr, &eventKernel);
+    events.push_back(eventKernel);
+
+    return filter;
+}
+
+cl::Event KernelFilterImages::runSingleDilated(const cl::Image2D& imgSrc, const cl::Image2D& imgDst, const cl::Buffer& bufferKernel, const cv::Mat& filter, const cv::Size& dilation, const size_t cols, const size_t rows)
+{
+    const KernelRegistry::Kernel& filterDilated = KernelRegistry::getDilated(storage, KernelRegistry::SINGLE);
+
+    cl::Kernel kernel = programs->kernel(filterDilated.name);
+    kernel.setArg(0, imgSrc);
+    kernel.setArg(1, imgDst);
+    kernel.setArg(2, bufferKernel);
+    kernel.setArg(3, filter.cols);
+    kernel.setArg(4, dilation.height);
+    kernel.setArg(5, dilation.width);
+    kernel.setArg(6, border);
+
+    cl::Event eventFilter;
+    const cl::NDRange global(cols, rows);
+    queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+    recordLaunch(filterDilated.name, cols, costFilterDilated(cols, rows, 1, dilation), eventFilter);
+
+    // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
+    events.clear();
+
+    return eventFilter;
+}
+
+cl::Event KernelFilterImages::runDoubleDilated(const cl::Image2D& imgSrc, const cl::Image2D& imgDst1, const cl::Image2D& imgDst2, const cl::Buffer& bufferKernelA, const cl::Buffer& bufferKernelB, const cv::Mat& filter, const cv::Size& dilation, const size_t cols, const size_t rows)
+{
+    const KernelRegistry::Kernel& filterDilated = KernelRegistry::getDilated(storage, KernelRegistry::DOUBLE);
+
+    cl::Kernel kernel = programs->kernel(filterDilated.name);
+    kernel.setArg(0, imgSrc);
+    kernel.setArg(1, imgDst1);
+    kernel.setArg(2, imgDst2);
+    kernel.setArg(3, bufferKernelA);
+    kernel.setArg(4, bufferKernelB);
+    kernel.setArg(5, filter.cols);
+    kernel.setArg(6, dilation.height);
+    kernel.setArg(7, dilation.width);
+    kernel.setArg(8, border);
+
+    cl::Event eventFilter;
+    const cl::NDRange global(cols, rows);
+    queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, local, &events, &eventFilter);
+    recordLaunch(filterDilated.name, cols, costFilterDilated(cols, rows, 1, dilation, 2), eventFilter);
+
+    // Clear for next call. From the OpenCL API side this is no problem since the event list can be freed after the enqueue function returns
+    events.clear();
+
+    return eventFilter;
+}
+
+cl::Event KernelFilterImages::runAddImages(const ImageLevel& imgSrc1, const ImageLevel& imgSrc2, ImageLevel& imgDst)
+{
+    const size_t rows = imgSrc1.rows;
+    const size_t cols = imgSrc1.cols;
+
+    ASSERT(imgSrc1.readable(), "Can't read the input image");
+    ASSERT(rows == imgSrc2.rows && cols == imgSrc2.cols, "Both images must have the same size");
+
+    imgDst = ImageLevel(*context, CL_MEM_READ_WRITE, cols, rows);
+
+    cl::Kernel kernel = programs->kernel("add_images");
+    kernel.setArg(0, *imgSrc1);
+    kernel.setArg(1, *imgSrc2);
+    kernel.setArg(2, *imgDst);
+
+    cl::Event event;
+    const cl::NDRange global(cols, rows);
+    queue->enqueueNDRangeKernel(kernel, cl::NullRange, global, cl::NullRange, &events, &event);
+    recordLaunch("add_images", cols, CostModel::pointwise(storage, cols * rows, 2, 1, 1.0), event);
 
     events.clear();
 
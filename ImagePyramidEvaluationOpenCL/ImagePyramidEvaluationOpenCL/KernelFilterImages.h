@@ -3,27 +3,55 @@
 #include "AKernel.h"
 #include <opencv2/core.hpp>
 #include "KernelFilter.h"
+#include "ImageLevel.h"
+#include <array>
 
 class KernelFilterImages : public KernelFilter<KernelFilterImages>
 {
 public:
-    KernelFilterImages(AOpenCLInterface* const opencl, cl::Program* const program);
-    virtual ~KernelFilterImages();
+    static constexpr KernelRegistry::Storage storage = KernelRegistry::IMAGES;
 
-    static std::string kernelSource();
+    KernelFilterImages(AOpenCLInterface* const opencl, ProgramCache* const programs);
+    virtual ~KernelFilterImages();
     
-    cl::Event runSingle(const cl::Image2D& imgSrc, SPImage2D& imgDst);
-    cl::Event runSingleLocal(const cl::Image2D& imgSrc, SPImage2D& imgDst);
-    cl::Event runSingleLocalOnePass(const cl::Image2D& imgSrc, SPImage2D& imgDst);
-    cl::Event runSingleSeparation(const cl::Image2D& imgSrc, SPImage2D& imgDst);
-    cl::Event runSingleSeparationLocal(const cl::Image2D& imgSrc, SPImage2D& imgDst);
-    cl::Event runSinglePredefined(const cl::Image2D& imgSrc, SPImage2D& imgDst, const std::string& name, const std::string& size);
-    cl::Event runSinglePredefinedLocal(const cl::Image2D& imgSrc, SPImage2D& imgDst, const std::string& name, const std::string& size);
-    cl::Event runDouble(const cl::Image2D& imgSrc, SPImage2D& imgDst1, SPImage2D& imgDst2);
-    cl::Event runDoubleLocal(const cl::Image2D& imgSrc, SPImage2D& imgDst1, SPImage2D& imgDst2);
-    cl::Event runDoubleSeparation(const cl::Image2D& img, SPImage2D& imgDst1, SPImage2D& imgDst2);
-    cl::Event runDoublePredefined(const cl::Image2D& img, SPImage2D& imgDst1, SPImage2D& imgDst2, const std::string& name, const std::string& size);
-    cl::Event runDoublePredefinedLocal(const cl::Image2D& img, SPImage2D& imgDst1, SPImage2D& imgDst2, const std::string& name, const std::string& size);
-
-    cl::Event runHalfsampleImage(const cl::Image2D& imgSrc, SPImage2D& imgDst);
+    cl::Event runSingle(const ImageLevel& imgSrc, ImageLevel& imgDst);
+    cl::Event runSingleLocal(const ImageLevel& imgSrc, ImageLevel& imgDst);
+    cl::Event runSingleSliding(const ImageLevel& imgSrc, ImageLevel& imgDst);
+    cl::Event runSingleSeparation(const ImageLevel& imgSrc, ImageLevel& imgDst);
+    cl::Event runSingleSeparationLocal(const ImageLevel& imgSrc, ImageLevel& imgDst);
+    cl::Event runSinglePredefined(const ImageLevel& imgSrc, ImageLevel& imgDst, const KernelRegistry::Derivative derivative, const cv::Size& size);
+    cl::Event runSinglePredefinedLocal(const ImageLevel& imgSrc, ImageLevel& imgDst, const KernelRegistry::Derivative derivative, const cv::Size& size);
+    cl::Event runDouble(const ImageLevel& imgSrc, ImageLevel& imgDst1, ImageLevel& imgDst2);
+    cl::Event runDoubleLocal(const ImageLevel& imgSrc, ImageLevel& imgDst1, ImageLevel& imgDst2);
+    cl::Event runDoubleWinograd(const ImageLevel& imgSrc, ImageLevel& imgDst1, ImageLevel& imgDst2);
+    cl::Event runDoubleSeparation(const ImageLevel& img, ImageLevel& imgDst1, ImageLevel& imgDst2);
+    cl::Event runDoublePredefined(const ImageLevel& img, ImageLevel& imgDst1, ImageLevel& imgDst2, const cv::Size& size);
+    cl::Event runDoublePredefinedLocal(const ImageLevel& img, ImageLevel& imgDst1, ImageLevel& imgDst2, const cv::Size& size);
+
+    /**
+     * @brief Transfers the filters of the selected execution strategy to the device (used by all following calls to runDecomposed())
+     */
+    void setDecomposition(const FilterDecomposition& decomposition);
+    cl::Event runDecomposed(const ImageLevel& imgSrc, ImageLevel& imgDst);
+
+    void setSmoothingCoefficients(const FilterBank::Filter& smoothingCoefficients);
+    cl::Event runDerivativesMultiSigmaLocal(const ImageLevel& imgSrc, std::array<ImageLevel, 4>& imgDstGx, std::array<ImageLevel, 4>& imgDstGy);
+
+    cl::Event runHalfsampleImage(const ImageLevel& imgSrc, ImageLevel& imgDst);
+
+private:
+    FilterBank::Filter uploadFilter(const cv::Mat& kernel);
+    cl::Event runSingleDilated(const cl::Image2D& imgSrc, const cl::Image2D& imgDst, const cl::Buffer& bufferKernel, const cv::Mat& filter, const cv::Size& dilation, const size_t cols, const size_t rows);
+    cl::Event runDoubleDilated(const cl::Image2D& imgSrc, const cl::Image2D& imgDst1, const cl::Image2D& imgDst2, const cl::Buffer& bufferKernelA, const cl::Buffer& bufferKernelB, const cv::Mat& filter, const cv::Size& dilation, const size_t cols, const size_t rows);
+    cl::Event runAddImages(const ImageLevel& imgSrc1, const ImageLevel& imgSrc2, ImageLevel& imgDst);
+
+private:
+    cl::Buffer bufferSmoothingCoefficients;
+    cv::Mat winogradSource1;    //!< Filters the transformed Winograd filters were calculated from
+    cv::Mat winogradSource2;
+    cl::Buffer bufferWinograd1;
+    cl::Buffer bufferWinograd2;
+    FilterDecomposition::Strategy decompositionStrategy = FilterDecomposition::DENSE;
+    std::vector<std::array<FilterBank::Filter, 2>> decompositionTerms;     //!< Column and row vector of every separable term
+    FilterBank::Filter decompositionFilter;
 };
@@ -0,0 +1,520 @@
+/* This file is generated. Do not modify. */
+
+#pragma once
+
+/**
+ * @brief All filter kernels generated from the *_normal.base.cl, *_local.base.cl and *_dilated.base.cl templates, the predefined derivative filters and the
+ * Winograd filters (see kernels/generate_kernels.pl)
+ */
+namespace KernelRegistry
+{
+    enum Storage
+    {
+        IMAGES,
+        CUBES,
+        BUFFER,
+        IMAGE1D,
+        NUMBER_STORAGES
+    };
+
+    enum Multiplicity
+    {
+        SINGLE,
+        DOUBLE,
+        NUMBER_MULTIPLICITIES
+    };
+
+    enum Memory
+    {
+        NORMAL,
+        LOCAL,
+        NUMBER_MEMORIES
+    };
+
+    enum Size
+    {
+        SIZE_GENERIC,
+        SIZE_3x3,
+        SIZE_5x5,
+        SIZE_7x7,
+        SIZE_9x9,
+        SIZE_1x3,
+        SIZE_1x5,
+        SIZE_1x7,
+        SIZE_1x9,
+        SIZE_3x1,
+        SIZE_5x1,
+        SIZE_7x1,
+        SIZE_9x1,
+        NUMBER_SIZES
+    };
+
+    enum Derivative
+    {
+        GX,
+        GY,
+        GXGY,
+        NUMBER_DERIVATIVES
+    };
+
+    struct Kernel
+    {
+        const char* name;       //!< nullptr if the kernel does not exist (predefined and Winograd kernels are only generated for some sizes)
+        int rows;               //!< Filter size of the unrolled kernels (0 for the generic kernels which additionally need the filter size as arguments)
+        int cols;
+
+        constexpr bool unrolled() const
+        {
+            return rows > 0;
+        }
+    };
+
+    /**
+     * @brief Index of the unrolled kernel for the given filter size or SIZE_GENERIC if no such kernel exists
+     */
+    constexpr Size size(const int rows, const int cols)
+    {
+        return
+            rows == 3 && cols == 3 ? SIZE_3x3 :
+            rows == 5 && cols == 5 ? SIZE_5x5 :
+            rows == 7 && cols == 7 ? SIZE_7x7 :
+            rows == 9 && cols == 9 ? SIZE_9x9 :
+            rows == 1 && cols == 3 ? SIZE_1x3 :
+            rows == 1 && cols == 5 ? SIZE_1x5 :
+            rows == 1 && cols == 7 ? SIZE_1x7 :
+            rows == 1 && cols == 9 ? SIZE_1x9 :
+            rows == 3 && cols == 1 ? SIZE_3x1 :
+            rows == 5 && cols == 1 ? SIZE_5x1 :
+            rows == 7 && cols == 1 ? SIZE_7x1 :
+            rows == 9 && cols == 1 ? SIZE_9x1 :
+            SIZE_GENERIC;
+    }
+
+    constexpr Kernel kernels[NUMBER_STORAGES][NUMBER_MULTIPLICITIES][NUMBER_MEMORIES][NUMBER_SIZES] = {
+        {   // IMAGES
+            {   // SINGLE
+                {   // NORMAL
+                    { "filter_single", 0, 0 },
+                    { "filter_single_3x3", 3, 3 },
+                    { "filter_single_5x5", 5, 5 },
+                    { "filter_single_7x7", 7, 7 },
+                    { "filter_single_9x9", 9, 9 },
+                    { "filter_single_1x3", 1, 3 },
+                    { "filter_single_1x5", 1, 5 },
+                    { "filter_single_1x7", 1, 7 },
+                    { "filter_single_1x9", 1, 9 },
+                    { "filter_single_3x1", 3, 1 },
+                    { "filter_single_5x1", 5, 1 },
+                    { "filter_single_7x1", 7, 1 },
+                    { "filter_single_9x1", 9, 1 }
+                },
+                {   // LOCAL
+                    { "filter_single_local", 0, 0 },
+                    { "filter_single_local_3x3", 3, 3 },
+                    { "filter_single_local_5x5", 5, 5 },
+                    { "filter_single_local_7x7", 7, 7 },
+                    { "filter_single_local_9x9", 9, 9 },
+                    { "filter_single_local_1x3", 1, 3 },
+                    { "filter_single_local_1x5", 1, 5 },
+                    { "filter_single_local_1x7", 1, 7 },
+                    { "filter_single_local_1x9", 1, 9 },
+                    { "filter_single_local_3x1", 3, 1 },
+                    { "filter_single_local_5x1", 5, 1 },
+                    { "filter_single_local_7x1", 7, 1 },
+                    { "filter_single_local_9x1", 9, 1 }
+                }
+            },
+            {   // DOUBLE
+                {   // NORMAL
+                    { "filter_double", 0, 0 },
+                    { "filter_double_3x3", 3, 3 },
+                    { "filter_double_5x5", 5, 5 },
+                    { "filter_double_7x7", 7, 7 },
+                    { "filter_double_9x9", 9, 9 },
+                    { "filter_double_1x3", 1, 3 },
+                    { "filter_double_1x5", 1, 5 },
+                    { "filter_double_1x7", 1, 7 },
+                    { "filter_double_1x9", 1, 9 },
+                    { "filter_double_3x1", 3, 1 },
+                    { "filter_double_5x1", 5, 1 },
+                    { "filter_double_7x1", 7, 1 },
+                    { "filter_double_9x1", 9, 1 }
+                },
+                {   // LOCAL
+                    { "filter_double_local", 0, 0 },
+                    { "filter_double_local_3x3", 3, 3 },
+                    { "filter_double_local_5x5", 5, 5 },
+                    { "filter_double_local_7x7", 7, 7 },
+                    { "filter_double_local_9x9", 9, 9 },
+                    { "filter_double_local_1x3", 1, 3 },
+                    { "filter_double_local_1x5", 1, 5 },
+                    { "filter_double_local_1x7", 1, 7 },
+                    { "filter_double_local_1x9", 1, 9 },
+                    { "filter_double_local_3x1", 3, 1 },
+                    { "filter_double_local_5x1", 5, 1 },
+                    { "filter_double_local_7x1", 7, 1 },
+                    { "filter_double_local_9x1", 9, 1 }
+                }
+            }
+        },
+        {   // CUBES
+            {   // SINGLE
+                {   // NORMAL
+                    { "filter_single", 0, 0 },
+                    { "filter_single_3x3", 3, 3 },
+                    { "filter_single_5x5", 5, 5 },
+                    { "filter_single_7x7", 7, 7 },
+                    { "filter_single_9x9", 9, 9 },
+                    { "filter_single_1x3", 1, 3 },
+                    { "filter_single_1x5", 1, 5 },
+                    { "filter_single_1x7", 1, 7 },
+                    { "filter_single_1x9", 1, 9 },
+                    { "filter_single_3x1", 3, 1 },
+                    { "filter_single_5x1", 5, 1 },
+                    { "filter_single_7x1", 7, 1 },
+                    { "filter_single_9x1", 9, 1 }
+                },
+                {   // LOCAL
+                    { "filter_single_local", 0, 0 },
+                    { "filter_single_local_3x3", 3, 3 },
+                    { "filter_single_local_5x5", 5, 5 },
+                    { "filter_single_local_7x7", 7, 7 },
+                    { "filter_single_local_9x9", 9, 9 },
+                    { "filter_single_local_1x3", 1, 3 },
+                    { "filter_single_local_1x5", 1, 5 },
+                    { "filter_single_local_1x7", 1, 7 },
+                    { "filter_single_local_1x9", 1, 9 },
+                    { "filter_single_local_3x1", 3, 1 },
+                    { "filter_single_local_5x1", 5, 1 },
+                    { "filter_single_local_7x1", 7, 1 },
+                    { "filter_single_local_9x1", 9, 1 }
+                }
+            },
+            {   // DOUBLE
+                {   // NORMAL
+                    { "filter_double", 0, 0 },
+                    { "filter_double_3x3", 3, 3 },
+                    { "filter_double_5x5", 5, 5 },
+                    { "filter_double_7x7", 7, 7 },
+                    { "filter_double_9x9", 9, 9 },
+                    { "filter_double_1x3", 1, 3 },
+                    { "filter_double_1x5", 1, 5 },
+                    { "filter_double_1x7", 1, 7 },
+                    { "filter_double_1x9", 1, 9 },
+                    { "filter_double_3x1", 3, 1 },
+                    { "filter_double_5x1", 5, 1 },
+                    { "filter_double_7x1", 7, 1 },
+                    { "filter_double_9x1", 9, 1 }
+                },
+                {   // LOCAL
+                    { "filter_double_local", 0, 0 },
+                    { "filter_double_local_3x3", 3, 3 },
+                    { "filter_double_local_5x5", 5, 5 },
+                    { "filter_double_local_7x7", 7, 7 },
+                    { "filter_double_local_9x9", 9, 9 },
+                    { "filter_double_local_1x3", 1, 3 },
+                    { "filter_double_local_1x5", 1, 5 },
+                    { "filter_double_local_1x7", 1, 7 },
+                    { "filter_double_local_1x9", 1, 9 },
+                    { "filter_double_local_3x1", 3, 1 },
+                    { "filter_double_local_5x1", 5, 1 },
+                    { "filter_double_local_7x1", 7, 1 },
+                    { "filter_double_local_9x1", 9, 1 }
+                }
+            }
+        },
+        {   // BUFFER
+            {   // SINGLE
+                {   // NORMAL
+                    { "filter_single", 0, 0 },
+                    { "filter_single_3x3", 3, 3 },
+                    { "filter_single_5x5", 5, 5 },
+                    { "filter_single_7x7", 7, 7 },
+                    { "filter_single_9x9", 9, 9 },
+                    { "filter_single_1x3", 1, 3 },
+                    { "filter_single_1x5", 1, 5 },
+                    { "filter_single_1x7", 1, 7 },
+                    { "filter_single_1x9", 1, 9 },
+                    { "filter_single_3x1", 3, 1 },
+                    { "filter_single_5x1", 5, 1 },
+                    { "filter_single_7x1", 7, 1 },
+                    { "filter_single_9x1", 9, 1 }
+                },
+                {   // LOCAL
+                    { "filter_single_local", 0, 0 },
+                    { "filter_single_local_3x3", 3, 3 },
+                    { "filter_single_local_5x5", 5, 5 },
+                    { "filter_single_local_7x7", 7, 7 },
+                    { "filter_single_local_9x9", 9, 9 },
+                    { "filter_single_local_1x3", 1, 3 },
+                    { "filter_single_local_1x5", 1, 5 },
+                    { "filter_single_local_1x7", 1, 7 },
+                    { "filter_single_local_1x9", 1, 9 },
+                    { "filter_single_local_3x1", 3, 1 },
+                    { "filter_single_local_5x1", 5, 1 },
+                    { "filter_single_local_7x1", 7, 1 },
+                    { "filter_single_local_9x1", 9, 1 }
+                }
+            },
+            {   // DOUBLE
+                {   // NORMAL
+                    { "filter_double", 0, 0 },
+                    { "filter_double_3x3", 3, 3 },
+                    { "filter_double_5x5", 5, 5 },
+                    { "filter_double_7x7", 7, 7 },
+                    { "filter_double_9x9", 9, 9 },
+                    { "filter_double_1x3", 1, 3 },
+                    { "filter_double_1x5", 1, 5 },
+                    { "filter_double_1x7", 1, 7 },
+                    { "filter_double_1x9", 1, 9 },
+                    { "filter_double_3x1", 3, 1 },
+                    { "filter_double_5x1", 5, 1 },
+                    { "filter_double_7x1", 7, 1 },
+                    { "filter_double_9x1", 9, 1 }
+                },
+                {   // LOCAL
+                    { "filter_double_local", 0, 0 },
+                    { "filter_double_local_3x3", 3, 3 },
+                    { "filter_double_local_5x5", 5, 5 },
+                    { "filter_double_local_7x7", 7, 7 },
+                    { "filter_double_local_9x9", 9, 9 },
+                    { "filter_double_local_1x3", 1, 3 },
+                    { "filter_double_local_1x5", 1, 5 },
+                    { "filter_double_local_1x7", 1, 7 },
+                    { "filter_double_local_1x9", 1, 9 },
+                    { "filter_double_local_3x1", 3, 1 },
+                    { "filter_double_local_5x1", 5, 1 },
+                    { "filter_double_local_7x1", 7, 1 },
+                    { "filter_double_local_9x1", 9, 1 }
+                }
+            }
+        },
+        {   // IMAGE1D
+            {   // SINGLE
+                {   // NORMAL
+                    { "filter_single", 0, 0 },
+                    { "filter_single_3x3", 3, 3 },
+                    { "filter_single_5x5", 5, 5 },
+                    { "filter_single_7x7", 7, 7 },
+                    { "filter_single_9x9", 9, 9 },
+                    { "filter_single_1x3", 1, 3 },
+                    { "filter_single_1x5", 1, 5 },
+                    { "filter_single_1x7", 1, 7 },
+                    { "filter_single_1x9", 1, 9 },
+                    { "filter_single_3x1", 3, 1 },
+                    { "filter_single_5x1", 5, 1 },
+                    { "filter_single_7x1", 7, 1 },
+                    { "filter_single_9x1", 9, 1 }
+                },
+                {   // LOCAL
+                    { "filter_single_local", 0, 0 },
+                    { "filter_single_local_3x3", 3, 3 },
+                    { "filter_single_local_5x5", 5, 5 },
+                    { "filter_single_local_7x7", 7, 7 },
+                    { "filter_single_local_9x9", 9, 9 },
+                    { "filter_single_local_1x3", 1, 3 },
+                    { "filter_single_local_1x5", 1, 5 },
+                    { "filter_single_local_1x7", 1, 7 },
+                    { "filter_single_local_1x9", 1, 9 },
+                    { "filter_single_local_3x1", 3, 1 },
+                    { "filter_single_local_5x1", 5, 1 },
+                    { "filter_single_local_7x1", 7, 1 },
+                    { "filter_single_local_9x1", 9, 1 }
+                }
+            },
+            {   // DOUBLE
+                {   // NORMAL
+                    { "filter_double", 0, 0 },
+                    { "filter_double_3x3", 3, 3 },
+                    { "filter_double_5x5", 5, 5 },
+                    { "filter_double_7x7", 7, 7 },
+                    { "filter_double_9x9", 9, 9 },
+                    { "filter_double_1x3", 1, 3 },
+                    { "filter_double_1x5", 1, 5 },
+                    { "filter_double_1x7", 1, 7 },
+                    { "filter_double_1x9", 1, 9 },
+                    { "filter_double_3x1", 3, 1 },
+                    { "filter_double_5x1", 5, 1 },
+                    { "filter_double_7x1", 7, 1 },
+                    { "filter_double_9x1", 9, 1 }
+                },
+                {   // LOCAL
+                    { "filter_double_local", 0, 0 },
+                    { "filter_double_local_3x3", 3, 3 },
+                    { "filter_double_local_5x5", 5, 5 },
+                    { "filter_double_local_7x7", 7, 7 },
+                    { "filter_double_local_9x9", 9, 9 },
+                    { "filter_double_local_1x3", 1, 3 },
+                    { "filter_double_local_1x5", 1, 5 },
+                    { "filter_double_local_1x7", 1, 7 },
+                    { "filter_double_local_1x9", 1, 9 },
+                    { "filter_double_local_3x1", 3, 1 },
+                    { "filter_double_local_5x1", 5, 1 },
+                    { "filter_double_local_7x1", 7, 1 },
+                    { "filter_double_local_9x1", 9, 1 }
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Dilated 3x3 filter kernels (for every filter size, the dilation is passed as argument)
+     */
+    constexpr Kernel dilated[NUMBER_STORAGES][NUMBER_MULTIPLICITIES] = {
+        {   // IMAGES
+            { "filter_single_dilated", 0, 0 },
+            { "filter_double_dilated", 0, 0 }
+        },
+        {   // CUBES
+            { "filter_single_dilated", 0, 0 },
+            { "filter_double_dilated", 0, 0 }
+        },
+        {   // BUFFER
+            { "filter_single_dilated", 0, 0 },
+            { "filter_double_dilated", 0, 0 }
+        },
+        {   // IMAGE1D
+            { "filter_single_dilated", 0, 0 },
+            { "filter_double_dilated", 0, 0 }
+        }
+    };
+
+    /**
+     * @brief Kernels with the derivative filters compiled in (only for the image storage). Gx and Gy are single kernels, GxGy are double kernels
+     */
+    constexpr Kernel predefined[NUMBER_MEMORIES][NUMBER_DERIVATIVES][NUMBER_SIZES] = {
+        {   // NORMAL
+            {   // GX
+                { nullptr, 0, 0 },
+                { "filter_single_Gx_3x3", 3, 3 },
+                { "filter_single_Gx_5x5", 5, 5 },
+                { "filter_single_Gx_7x7", 7, 7 },
+                { "filter_single_Gx_9x9", 9, 9 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 }
+            },
+            {   // GY
+                { nullptr, 0, 0 },
+                { "filter_single_Gy_3x3", 3, 3 },
+                { "filter_single_Gy_5x5", 5, 5 },
+                { "filter_single_Gy_7x7", 7, 7 },
+                { "filter_single_Gy_9x9", 9, 9 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 }
+            },
+            {   // GXGY
+                { nullptr, 0, 0 },
+                { "filter_double_GxGy_3x3", 3, 3 },
+                { "filter_double_GxGy_5x5", 5, 5 },
+                { "filter_double_GxGy_7x7", 7, 7 },
+                { "filter_double_GxGy_9x9", 9, 9 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 }
+            }
+        },
+        {   // LOCAL
+            {   // GX
+                { nullptr, 0, 0 },
+                { "filter_single_local_Gx_3x3", 3, 3 },
+                { "filter_single_local_Gx_5x5", 5, 5 },
+                { "filter_single_local_Gx_7x7", 7, 7 },
+                { "filter_single_local_Gx_9x9", 9, 9 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 }
+            },
+            {   // GY
+                { nullptr, 0, 0 },
+                { "filter_single_local_Gy_3x3", 3, 3 },
+                { "filter_single_local_Gy_5x5", 5, 5 },
+                { "filter_single_local_Gy_7x7", 7, 7 },
+                { "filter_single_local_Gy_9x9", 9, 9 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 }
+            },
+            {   // GXGY
+                { nullptr, 0, 0 },
+                { "filter_double_local_GxGy_3x3", 3, 3 },
+                { "filter_double_local_GxGy_5x5", 5, 5 },
+                { "filter_double_local_GxGy_7x7", 7, 7 },
+                { "filter_double_local_GxGy_9x9", 9, 9 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 },
+                { nullptr, 0, 0 }
+            }
+        }
+    };
+
+    /**
+     * @brief Winograd kernels for two filters (only for the image storage)
+     */
+    constexpr Kernel winograd[NUMBER_SIZES] = {
+        { nullptr, 0, 0 },
+        { "filter_double_winograd_3x3", 3, 3 },
+        { "filter_double_winograd_5x5", 5, 5 },
+        { nullptr, 0, 0 },
+        { nullptr, 0, 0 },
+        { nullptr, 0, 0 },
+        { nullptr, 0, 0 },
+        { nullptr, 0, 0 },
+        { nullptr, 0, 0 },
+        { nullptr, 0, 0 },
+        { nullptr, 0, 0 },
+        { nullptr, 0, 0 },
+        { nullptr, 0, 0 }
+    };
+
+    constexpr const Kernel& get(const Storage storage, const Multiplicity multiplicity, const Memory memory, const int rows, const int cols)
+    {
+        return kernels[storage][multiplicity][memory][size(rows, cols)];
+    }
+
+    constexpr const Kernel& getDilated(const Storage storage, const Multiplicity multiplicity)
+    {
+        return dilated[storage][multiplicity];
+    }
+
+    constexpr const Kernel& getPredefined(const Memory memory, const Derivative derivative, const int rows, const int cols)
+    {
+        return predefined[memory][derivative][size(rows, cols)];
+    }
+
+    constexpr const Kernel& getWinograd(const int rows, const int cols)
+    {
+        return winograd[size(rows, cols)];
+    }
+}
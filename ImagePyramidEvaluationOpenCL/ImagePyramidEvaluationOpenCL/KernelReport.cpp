@@ -0,0 +1,141 @@
+#include "KernelReport.h"
+#include "JsonWriter.h"
+#include "general.h"
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+
+KernelReport::KernelReport(const size_t launchSize, const size_t workItemsPerComputeUnit)
+    : launchSize(launchSize),
+      workItemsPerComputeUnit(workItemsPerComputeUnit)
+{}
+
+void KernelReport::add(const cl::Device& device, ProgramCache& programs, const std::string& pyramidName)
+{
+    Pyramid pyramid;
+    pyramid.name = pyramidName;
+
+    device.getInfo(CL_DEVICE_NAME, &pyramid.device.name);
+    device.getInfo(CL_DEVICE_LOCAL_MEM_SIZE, &pyramid.device.localMemory);
+    device.getInfo(CL_DEVICE_MAX_COMPUTE_UNITS, &pyramid.device.computeUnits);
+    device.getInfo(CL_DEVICE_MAX_WORK_GROUP_SIZE, &pyramid.device.maxWorkGroupSize);
+    pyramid.device.workItemsPerComputeUnit = workItemsPerComputeUnit > 0 ? workItemsPerComputeUnit : std::max(pyramid.device.maxWorkGroupSize, launchSize);
+
+    for (const char* name : programs.kernelNames())
+    {
+        pyramid.entries.push_back(analyse(device, pyramid.device, programs.kernel(name), name));
+    }
+
+    pyramids.push_back(pyramid);
+}
+
+void KernelReport::print(std::ostream& stream) const
+{
+    for (const Pyramid& pyramid : pyramids)
+    {
+        stream << "--- Kernel resources of the " << pyramid.name << " pyramid on " << pyramid.device.name << " (" << pyramid.device.computeUnits << " compute units, "
+               << pyramid.device.localMemory << " bytes local memory, work-group size " << launchSize << ") ---" << std::endl;
+        stream << std::left << std::setw(48) << "kernel" << std::right
+               << std::setw(8) << "local" << std::setw(9) << "private" << std::setw(7) << "wgs" << std::setw(6) << "simd"
+               << std::setw(8) << "groups" << std::setw(11) << "occupancy" << "  limited by" << std::endl;
+
+        for (const Entry& entry : pyramid.entries)
+        {
+            stream << std::left << std::setw(48) << entry.name << std::right
+                   << std::setw(8) << entry.localMemory << std::setw(9) << entry.privateMemory << std::setw(7) << entry.workGroupSize << std::setw(6) << entry.preferredMultiple
+                   << std::setw(8) << entry.groupsPerComputeUnit << std::setw(10) << std::fixed << std::setprecision(1) << 100.0 * entry.occupancy << "%"
+                   << "  " << entry.limitedBy << std::defaultfloat << std::endl;
+        }
+    }
+}
+
+void KernelReport::writeJson(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    ASSERT(file.is_open(), "Could not open " << filename);
+
+    JsonWriter json(file);
+    json.beginObject();
+
+    json.key("launchSize").value(launchSize);
+
+    json.key("pyramids").beginArray();
+    for (const Pyramid& pyramid : pyramids)
+    {
+        json.beginObject();
+        json.key("name").value(pyramid.name);
+
+        json.key("device").beginObject();
+        json.key("name").value(pyramid.device.name);
+        json.key("computeUnits").value(pyramid.device.computeUnits);
+        json.key("localMemory").value(pyramid.device.localMemory);
+        json.key("maxWorkGroupSize").value(pyramid.device.maxWorkGroupSize);
+        json.key("workItemsPerComputeUnit").value(pyramid.device.workItemsPerComputeUnit);
+        json.endObject();
+
+        json.key("kernels").beginArray();
+        for (const Entry& entry : pyramid.entries)
+        {
+            json.beginObject();
+            json.key("name").value(entry.name);
+            json.key("localMemory").value(entry.localMemory);
+            json.key("privateMemory").value(entry.privateMemory);
+            json.key("workGroupSize").value(entry.workGroupSize);
+            json.key("preferredWorkGroupSizeMultiple").value(entry.preferredMultiple);
+            json.key("groupsPerComputeUnit").value(entry.groupsPerComputeUnit);
+            json.key("simdEfficiency").value(entry.simdEfficiency);
+            json.key("occupancy").value(entry.occupancy);
+            json.key("limitedBy").value(entry.limitedBy);
+            json.endObject();
+        }
+        json.endArray();
+
+        json.endObject();
+    }
+    json.endArray();
+
+    json.endObject();
+}
+
+KernelReport::Entry KernelReport::analyse(const cl::Device& device, const DeviceLimits& limits, const cl::Kernel& kernel, const std::string& name) const
+{
+    Entry entry;
+    entry.name = name;
+    kernel.getWorkGroupInfo(device, CL_KERNEL_LOCAL_MEM_SIZE, &entry.localMemory);
+    kernel.getWorkGroupInfo(device, CL_KERNEL_PRIVATE_MEM_SIZE, &entry.privateMemory);
+    kernel.getWorkGroupInfo(device, CL_KERNEL_WORK_GROUP_SIZE, &entry.workGroupSize);
+    kernel.getWorkGroupInfo(device, CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE, &entry.preferredMultiple);
+
+    // A partially filled SIMD block at the end of the work-group still occupies the full block
+    const size_t multiple = std::max<size_t>(entry.preferredMultiple, 1);
+    const size_t launchSizeRounded = (launchSize + multiple - 1) / multiple * multiple;
+    entry.simdEfficiency = static_cast<double>(launchSize) / launchSizeRounded;
+
+    if (entry.workGroupSize < launchSize)
+    {
+        // The kernel needs too many resources to be launched with the work-group size of the filter kernels at all
+        entry.limitedBy = "workGroupSize";
+        return entry;
+    }
+
+    // Resident work-groups per compute unit according to the work-item capacity, the registers and the local memory. The driver reduces the work-group
+    // size of a kernel below the device limit when the kernel needs many registers; in this case, the reduced size is taken as register limit
+    entry.groupsPerComputeUnit = std::max<size_t>(limits.workItemsPerComputeUnit / launchSizeRounded, 1);
+    entry.limitedBy = "workItems";
+
+    if (entry.workGroupSize < limits.maxWorkGroupSize && entry.workGroupSize / launchSizeRounded < entry.groupsPerComputeUnit)
+    {
+        entry.groupsPerComputeUnit = std::max<size_t>(entry.workGroupSize / launchSizeRounded, 1);
+        entry.limitedBy = "registers";
+    }
+
+    if (entry.localMemory > 0 && limits.localMemory / entry.localMemory < entry.groupsPerComputeUnit)
+    {
+        entry.groupsPerComputeUnit = static_cast<size_t>(limits.localMemory / entry.localMemory);
+        entry.limitedBy = "localMemory";
+    }
+
+    entry.occupancy = std::min(1.0, static_cast<double>(entry.groupsPerComputeUnit * launchSize) / limits.workItemsPerComputeUnit);
+
+    return entry;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include "opencl_common.h"
+#include "ProgramCache.h"
+
+/**
+ * @brief Resource usage of the built kernels combined with the device limits to an estimated occupancy
+ *
+ * OpenCL has no query for the number of work-items which can be resident on one compute unit at the same time. The maximum work-group size of the device
+ * is used as capacity of a compute unit which is a lower bound on most devices; pass the value from the vendor documentation for a more precise estimate.
+ * The estimate is therefore mainly useful to compare the kernels on the same device (e.g. why the local 9x9 kernel is slower than expected).
+ */
+class KernelReport
+{
+public:
+    struct Entry
+    {
+        std::string name;
+        cl_ulong localMemory = 0;           //!< CL_KERNEL_LOCAL_MEM_SIZE in bytes (static local buffers of the kernel)
+        cl_ulong privateMemory = 0;         //!< CL_KERNEL_PRIVATE_MEM_SIZE in bytes per work-item
+        size_t workGroupSize = 0;           //!< CL_KERNEL_WORK_GROUP_SIZE, lower than the device limit when the kernel needs many registers
+        size_t preferredMultiple = 0;       //!< CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE (usually the SIMD width)
+        size_t groupsPerComputeUnit = 0;    //!< Resident work-groups per compute unit
+        double simdEfficiency = 0.0;        //!< Fraction of the SIMD lanes which are used by one work-group
+        double occupancy = 0.0;             //!< Estimated fraction of the compute unit capacity which is used
+        std::string limitedBy;              //!< Resource which limits the occupancy
+    };
+
+    struct DeviceLimits
+    {
+        std::string name;
+        cl_ulong localMemory = 0;
+        cl_uint computeUnits = 0;
+        size_t maxWorkGroupSize = 0;
+        size_t workItemsPerComputeUnit = 0;
+    };
+
+public:
+    /**
+     * @param launchSize number of work-items per work-group used by the filter kernels (16x16)
+     * @param workItemsPerComputeUnit capacity of one compute unit, 0 to use the maximum work-group size of the device
+     */
+    explicit KernelReport(const size_t launchSize = 16 * 16, const size_t workItemsPerComputeUnit = 0);
+
+    /**
+     * @brief Adds all kernels of the program cache (units which are not built yet are built now)
+     */
+    void add(const cl::Device& device, ProgramCache& programs, const std::string& pyramidName);
+
+    void print(std::ostream& stream) const;
+    void writeJson(const std::string& filename) const;
+
+private:
+    struct Pyramid
+    {
+        std::string name;
+        DeviceLimits device;
+        std::vector<Entry> entries;
+    };
+
+    Entry analyse(const cl::Device& device, const DeviceLimits& limits, const cl::Kernel& kernel, const std::string& name) const;
+
+private:
+    const size_t launchSize;
+    const size_t workItemsPerComputeUnit;
+    std::vector<Pyramid> pyramids;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <string>
+#include <cstring>
+#include <algorithm>
+#include "general.h"
+#include "KernelRegistry.h"
+
+/**
+ * @brief OpenCL sources embedded in the executable (KernelSources.cpp is generated by kernels/generate_kernels.pl)
+ *
+ * The kernels of every storage type are split into independent compilation units (e.g. one unit per unrolled filter size) which all start with the same
+ * prelude (shared variables, defines and border handling). This way, a program only needs to be compiled for the units which are actually used.
+ */
+namespace KernelSources
+{
+    /**
+     * @brief Source code split into several string literals since MSVC limits their length
+     */
+    struct Source
+    {
+        const char* const* chunks;
+        size_t numberChunks;
+
+        std::string str() const
+        {
+            std::string code;
+            for (size_t i = 0; i < numberChunks; ++i)
+            {
+                code += chunks[i];
+            }
+
+            return code;
+        }
+    };
+
+    struct Unit
+    {
+        const char* name;   //!< Origin of the unit, e.g. filter_images_local.cl:filter_single_local_5x5
+        Source source;
+    };
+
+    struct KernelEntry
+    {
+        const char* name;
+        size_t unit;        //!< Index of the unit which defines the kernel
+    };
+
+    struct StorageSources
+    {
+        Source prelude;
+        const Unit* units;
+        size_t numberUnits;
+        const KernelEntry* kernels; //!< Sorted by name
+        size_t numberKernels;
+    };
+
+    extern const StorageSources storages[KernelRegistry::NUMBER_STORAGES];
+
+    /**
+     * @brief Finds the unit which defines the kernel (binary search without any memory allocation)
+     */
+    inline size_t findUnit(const KernelRegistry::Storage storage, const char* kernelName)
+    {
+        const StorageSources& sources = storages[storage];
+        const KernelEntry* end = sources.kernels + sources.numberKernels;
+        const KernelEntry* entry = std::lower_bound(sources.kernels, end, kernelName, [](const KernelEntry& entry, const char* name)
+        {
+            return std::strcmp(entry.name, name) < 0;
+        });
+
+        ASSERT(entry != end && std::strcmp(entry->name, kernelName) == 0, "The kernel " << kernelName << " does not exist");
+
+        return entry->unit;
+    }
+
+    /**
+     * @brief Complete source code of the unit (including the prelude) which can be passed to the OpenCL compiler
+     */
+    inline std::string unitSource(const KernelRegistry::Storage storage, const size_t unit)
+    {
+        const StorageSources& sources = storages[storage];
+        ASSERT(unit < sources.numberUnits, "Invalid unit index");
+
+        return sources.prelude.str() + sources.units[unit].source.str();
+    }
+}
@@ -1,6 +1,8 @@
 #include "OpenCLInterface.h"
 #include "general.h"
 #include "settings.h"
+#include "Roofline.h"
+#include "Tracer.h"
 
 OpenCLInterface::OpenCLInterface()
 {}
@@ -22,7 +24,8 @@ void OpenCLInterface::init()
     // The context is responsible for the host-device interaction and manages the interacting objects (program, kernel, queue)
     context = cl::Context(device);
 	
-	// Every command is enqueued in this queue and then executed by the runtime on the device
+	// Every command is enqueued in this queue and then executed by the runtime on the device (profiling is only needed for the roofline instrumentation and the tracer)
+    const cl_command_queue_properties properties = roofline || tracer ? CL_QUEUE_PROFILING_ENABLE : 0;
 
 	std::string deviceNameLower(device.getInfo<CL_DEVICE_VENDOR>());
 	std::transform(deviceNameLower.begin(), deviceNameLower.end(), deviceNameLower.begin(), ::tolower);
@@ -30,16 +33,25 @@ void OpenCLInterface::init()
 	if (deviceNameLower.find("nvidia") != deviceNameLower.npos)
 	{
 		cl_int error;
-		cl_command_queue_properties properties = 0;
 
         queue = clCreateCommandQueue(context(), device(), properties, &error);
         queue2 = clCreateCommandQueue(context(), device(), properties, &error);
 	}
 	else
 	{
-        queue = cl::CommandQueue(context, device);
-        queue2 = cl::CommandQueue(context, device);
+        queue = cl::CommandQueue(context, device, properties);
+        queue2 = cl::CommandQueue(context, device, properties);
 	}
+
+    if (roofline && !roofline->hasPeaks())
+    {
+        roofline->measurePeaks(context, device, queue);
+    }
+
+    if (tracer)
+    {
+        tracer->init(queue, queue2);
+    }
 }
 
 cl::Event OpenCLInterface::createImageOnDevice(const cv::Mat& img, cl::Image2D& imgOpencl) const
@@ -52,6 +64,10 @@ cl::Event OpenCLInterface::createImageOnDevice(const cv::Mat& img, cl::Image2D&
     std::array<size_t, 3> origin = { 0, 0, 0 };
     std::array<size_t, 3> imgSize = { static_cast<size_t>(img.cols), static_cast<size_t>(img.rows), 1 };
     queue.enqueueWriteImage(imgOpencl, CL_NON_BLOCKING, origin, imgSize, img.cols * sizeof(float), 0, img.data, nullptr, &eventImage);
+    if (tracer)
+    {
+        tracer->record("write_image", img.cols, eventImage);
+    }
 
     return eventImage;
 }
@@ -68,7 +84,11 @@ cl::Event OpenCLInterface::copyImageOnDevice(const cl::Image2D& imgSrc, SPImage2
     std::array<size_t, 3> imgSize = { cols, rows, 1 };
     std::vector<cl::Event> events = { event };
     queue.enqueueCopyImage(imgSrc, *imgDst, origin, origin, imgSize, &events, &eventCopy);
-    
+    if (tracer)
+    {
+        tracer->record("copy_image", cols, eventCopy);
+    }
+
     return eventCopy;
 }
 
@@ -84,8 +104,13 @@ cv::Mat OpenCLInterface::copyImageFromDevice(const cl::Image2D& img) const
     ASSERT(imgHost.isContinuous(), "Not enough memory available to store the image continuously in memory");
 
     queue.finish(); // Wair until every operation finished before reading the image back from the device
-    queue.enqueueReadImage(img, true, origin, imgSize, cols * sizeof(float), 0, imgHost.data);
+    cl::Event eventRead;
+    queue.enqueueReadImage(img, true, origin, imgSize, cols * sizeof(float), 0, imgHost.data, nullptr, &eventRead);
     queue.finish();
+    if (tracer)
+    {
+        tracer->record("read_image", cols, eventRead);
+    }
 
     return imgHost;
 }
@@ -102,8 +127,13 @@ cv::Mat OpenCLInterface::copyImageFromDevice(const cl::Image2DArray& img, size_t
     ASSERT(imgHost.isContinuous(), "Not enough memory available to store the image continuously in memory");
 
     queue.finish(); // Wair until every operation finished before reading the image back from the device
-    queue.enqueueReadImage(img, true, origin, imgSize, cols * sizeof(float), 0, imgHost.data);
+    cl::Event eventRead;
+    queue.enqueueReadImage(img, true, origin, imgSize, cols * sizeof(float), 0, imgHost.data, nullptr, &eventRead);
     queue.finish();
+    if (tracer)
+    {
+        tracer->record("read_image", cols, eventRead);
+    }
 
     return imgHost;
 }
@@ -128,11 +158,40 @@ cl::CommandQueue& OpenCLInterface::getQueue2()
     return queue2;
 }
 
+Roofline* OpenCLInterface::getRoofline()
+{
+    return roofline;
+}
+
+void OpenCLInterface::setRoofline(Roofline* roofline)
+{
+    this->roofline = roofline;
+}
+
+Tracer* OpenCLInterface::getTracer()
+{
+    return tracer;
+}
+
+void OpenCLInterface::setTracer(Tracer* tracer)
+{
+    this->tracer = tracer;
+}
+
 std::string& OpenCLInterface::getBuildOptions()
 {
     return buildOptions;
 }
 
+void OpenCLInterface::addBuildOptions(const std::string& options)
+{
+    if (!options.empty())
+    {
+        buildOptions += " " + options;
+        buildOptionsDebug += " " + options;
+    }
+}
+
 std::string& OpenCLInterface::getBuildOptionsDebug()
 {
     return buildOptionsDebug;
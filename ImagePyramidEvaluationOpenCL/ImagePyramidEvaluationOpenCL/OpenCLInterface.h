@@ -24,8 +24,26 @@ public:
     virtual cl::Context& getContext() override;
     virtual cl::CommandQueue& getQueue() override;
     virtual cl::CommandQueue& getQueue2() override;
+    virtual Roofline* getRoofline() override;
+
+    /**
+     * @brief Attaches the roofline instrumentation (must be called before init() since the queues need profiling)
+     */
+    void setRoofline(Roofline* roofline);
+
+    virtual Tracer* getTracer() override;
+
+    /**
+     * @brief Attaches the tracer (must be called before init() since the queues need profiling)
+     */
+    void setTracer(Tracer* tracer);
 
     std::string& getBuildOptions();
+
+    /**
+     * @brief Appends options (e.g. -cl-fast-relaxed-math) to the build options of the programs (must be called before init())
+     */
+    void addBuildOptions(const std::string& options);
     std::string& getBuildOptionsDebug();
 
 private:
@@ -33,7 +51,9 @@ private:
     cl::Context context;
     cl::CommandQueue queue;
     cl::CommandQueue queue2;
+    Roofline* roofline = nullptr;
+    Tracer* tracer = nullptr;
 
-    std::string buildOptions = "-cl-std=CL2.0 -I kernels";
+    std::string buildOptions = "-cl-std=CL2.0";
     std::string buildOptionsDebug = "-cl-std=CL2.0 -I kernels -Werror -g -s kernels/filter_images.cl";
 };
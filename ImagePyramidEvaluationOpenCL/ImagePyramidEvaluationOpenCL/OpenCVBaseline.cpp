@@ -0,0 +1,225 @@
+#include "OpenCVBaseline.h"
+#include "FilterBank.h"
+#include "JsonWriter.h"
+#include "general.h"
+#include "HostPyramid.h"
+#include <opencv2/imgproc.hpp>
+#include <opencv2/core/ocl.hpp>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace
+{
+    /**
+     * @brief Gx and Gy of every level, works for cv::Mat and cv::UMat
+     */
+    template<typename MatType>
+    void derivatives(const std::vector<MatType>& levels, std::vector<MatType>& levelsGx, std::vector<MatType>& levelsGy, const int sigmaSize,
+                     const cv::Mat& Gx1, const cv::Mat& Gx2, const cv::Mat& Gy1, const cv::Mat& Gy2)
+    {
+        levelsGx.resize(levels.size());
+        levelsGy.resize(levels.size());
+
+        for (size_t i = 0; i < levels.size(); ++i)
+        {
+            if (sigmaSize == 1)
+            {
+                // Same (unnormalized) Scharr kernels as the device
+                cv::Scharr(levels[i], levelsGx[i], CV_32F, 1, 0);
+                cv::Scharr(levels[i], levelsGy[i], CV_32F, 0, 1);
+            }
+            else
+            {
+                cv::sepFilter2D(levels[i], levelsGx[i], CV_32F, Gx2, Gx1);
+                cv::sepFilter2D(levels[i], levelsGy[i], CV_32F, Gy2, Gy1);
+            }
+        }
+    }
+
+    double median(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    }
+}
+
+OpenCVBaseline::OpenCVBaseline(const cv::Mat& img, const int numberOctaves, const int levelsPerOctave, const Downsampling downsampling, const int iterations)
+    : img(img),
+      numberOctaves(numberOctaves),
+      levelsPerOctave(levelsPerOctave),
+      downsampling(downsampling),
+      iterations(iterations)
+{}
+
+void OpenCVBaseline::compare(const std::string& pyramidName, const APyramid::Method method, const int sigmaSize, const double deviceMilliseconds, const APyramid::Levels& levels)
+{
+    const Reference& ref = reference(sigmaSize);
+    ASSERT(levels.Gx.size() == ref.levels.Gx.size(), "The device pyramid has " << levels.Gx.size() << " levels but the baseline has " << ref.levels.Gx.size());
+
+    Comparison comparison;
+    comparison.pyramid = pyramidName;
+    comparison.method = method;
+    comparison.sigmaSize = sigmaSize;
+    comparison.deviceMilliseconds = deviceMilliseconds;
+    comparison.maxAbsError = 0.0;
+    comparison.maxAbsErrorInterior = 0.0;
+
+    for (size_t i = 0; i < levels.Gx.size(); ++i)
+    {
+        comparison.maxAbsError = std::max({ comparison.maxAbsError, HostPyramid::maxAbsError(ref.levels.Gx[i], levels.Gx[i], 0), HostPyramid::maxAbsError(ref.levels.Gy[i], levels.Gy[i], 0) });
+        comparison.maxAbsErrorInterior = std::max({ comparison.maxAbsErrorInterior, HostPyramid::maxAbsError(ref.levels.Gx[i], levels.Gx[i], sigmaSize),
+                                                    HostPyramid::maxAbsError(ref.levels.Gy[i], levels.Gy[i], sigmaSize) });
+    }
+
+    comparisons.push_back(comparison);
+}
+
+void OpenCVBaseline::print(std::ostream& stream) const
+{
+    stream << "--- OpenCV baseline (" << (cv::ocl::useOpenCL() ? "T-API on OpenCL" : "T-API without OpenCL device") << ") ---" << std::endl;
+    for (const auto& pair : references)
+    {
+        stream << "sigma " << pair.first << ": cv::Mat " << std::fixed << std::setprecision(2) << pair.second.timing.mat << " ms, cv::UMat " << pair.second.timing.umat
+               << " ms, max abs error UMat " << std::scientific << pair.second.maxAbsErrorUMat << std::defaultfloat << std::endl;
+    }
+
+    stream << std::left << std::setw(16) << "pyramid" << std::setw(28) << "method" << std::right << std::setw(6) << "sigma" << std::setw(12) << "ms" << std::setw(12) << "vs Mat"
+           << std::setw(12) << "vs UMat" << std::setw(14) << "max error" << std::setw(14) << "interior" << std::endl;
+    for (const Comparison& c : comparisons)
+    {
+        const Timing& timing = references.at(c.sigmaSize).timing;
+        stream << std::left << std::setw(16) << c.pyramid << std::setw(28) << APyramid::methodToString(c.method) << std::right << std::setw(6) << c.sigmaSize
+               << std::fixed << std::setprecision(2) << std::setw(12) << c.deviceMilliseconds << std::setw(11) << speedup(timing.mat, c.deviceMilliseconds) << "x"
+               << std::setw(11) << speedup(timing.umat, c.deviceMilliseconds) << "x" << std::scientific << std::setprecision(2) << std::setw(14) << c.maxAbsError
+               << std::setw(14) << c.maxAbsErrorInterior << std::defaultfloat << std::endl;
+    }
+}
+
+void OpenCVBaseline::writeJson(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    ASSERT(file.is_open(), "Could not open " << filename);
+
+    JsonWriter json(file);
+    json.beginObject();
+
+    json.key("downsampling").value(downsampling == PYR_DOWN ? "pyrDown" : "resizeArea");
+    json.key("tapiOpenCL").value(cv::ocl::useOpenCL());
+
+    json.key("baselines").beginArray();
+    for (const auto& pair : references)
+    {
+        json.beginObject();
+        json.key("sigmaSize").value(pair.first);
+        json.key("matMs").value(pair.second.timing.mat);
+        json.key("umatMs").value(pair.second.timing.umat);
+        json.key("maxAbsErrorUMat").value(pair.second.maxAbsErrorUMat);
+        json.endObject();
+    }
+    json.endArray();
+
+    json.key("methods").beginArray();
+    for (const Comparison& c : comparisons)
+    {
+        const Timing& timing = references.at(c.sigmaSize).timing;
+
+        json.beginObject();
+        json.key("pyramid").value(c.pyramid);
+        json.key("method").value(APyramid::methodToString(c.method));
+        json.key("sigmaSize").value(c.sigmaSize);
+        json.key("deviceMs").value(c.deviceMilliseconds);
+        json.key("speedupMat").value(speedup(timing.mat, c.deviceMilliseconds));
+        json.key("speedupUMat").value(speedup(timing.umat, c.deviceMilliseconds));
+        json.key("maxAbsError").value(c.maxAbsError);
+        json.key("maxAbsErrorInterior").value(c.maxAbsErrorInterior);
+        json.endObject();
+    }
+    json.endArray();
+
+    json.endObject();
+}
+
+double OpenCVBaseline::speedup(const double baselineMilliseconds, const double deviceMilliseconds)
+{
+    // A device time of 0 ms (below the timer resolution) gives no speedup
+    return deviceMilliseconds > 0.0 ? baselineMilliseconds / deviceMilliseconds : std::numeric_limits<double>::quiet_NaN();
+}
+
+const OpenCVBaseline::Reference& OpenCVBaseline::reference(const int sigmaSize)
+{
+    auto it = references.find(sigmaSize);
+    if (it != references.end())
+    {
+        return it->second;
+    }
+
+    cv::Mat Gx1, Gx2, Gy1, Gy2, Gx, Gy;
+    FilterBank::computeDerivativeKernels(sigmaSize, Gx1, Gx2, Gy1, Gy2, Gx, Gy);
+
+    Reference& ref = references[sigmaSize];
+
+    // Like startFilterTest(), only the derivatives are timed (the pyramid is built once beforehand)
+    std::vector<cv::Mat> levels;
+    buildPyramid(img, levels);
+
+    std::vector<cv::Mat> levelsGx, levelsGy;
+    derivatives(levels, levelsGx, levelsGy, sigmaSize, Gx1, Gx2, Gy1, Gy2);   // Warm-up
+
+    std::vector<double> times;
+    for (int i = 0; i < iterations; ++i)
+    {
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        derivatives(levels, levelsGx, levelsGy, sigmaSize, Gx1, Gx2, Gy1, Gy2);
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() / 1000.0);
+    }
+    ref.timing.mat = median(times);
+
+    ref.levels.images = levels;
+    ref.levels.Gx = levelsGx;
+    ref.levels.Gy = levelsGy;
+
+    // T-API: the same operations are dispatched to the OpenCL device of OpenCV (or run on the CPU if there is none)
+    cv::UMat imgUMat;
+    img.copyTo(imgUMat);
+    std::vector<cv::UMat> levelsUMat;
+    buildPyramid(imgUMat, levelsUMat);
+
+    std::vector<cv::UMat> levelsGxUMat, levelsGyUMat;
+    derivatives(levelsUMat, levelsGxUMat, levelsGyUMat, sigmaSize, Gx1, Gx2, Gy1, Gy2);   // Warm-up (includes the build of the OpenCL kernels)
+    cv::ocl::finish();
+
+    times.clear();
+    for (int i = 0; i < iterations; ++i)
+    {
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        derivatives(levelsUMat, levelsGxUMat, levelsGyUMat, sigmaSize, Gx1, Gx2, Gy1, Gy2);
+        cv::ocl::finish();
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() / 1000.0);
+    }
+    ref.timing.umat = median(times);
+
+    for (size_t i = 0; i < levelsGxUMat.size(); ++i)
+    {
+        cv::Mat resultGx, resultGy;
+        levelsGxUMat[i].copyTo(resultGx);
+        levelsGyUMat[i].copyTo(resultGy);
+        ref.maxAbsErrorUMat = std::max({ ref.maxAbsErrorUMat, HostPyramid::maxAbsError(levelsGx[i], resultGx, 0), HostPyramid::maxAbsError(levelsGy[i], resultGy, 0) });
+    }
+
+    return ref;
+}
+
+void OpenCVBaseline::buildPyramid(const cv::Mat& img, std::vector<cv::Mat>& levels) const
+{
+    HostPyramid::buildLevels(img, levels, numberOctaves, levelsPerOctave, downsampling == PYR_DOWN);
+}
+
+void OpenCVBaseline::buildPyramid(const cv::UMat& img, std::vector<cv::UMat>& levels) const
+{
+    HostPyramid::buildLevels(img, levels, numberOctaves, levelsPerOctave, downsampling == PYR_DOWN);
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+#include <opencv2/core.hpp>
+#include "APyramid.h"
+
+/**
+ * @brief The same pyramid and derivatives computed with OpenCV on the CPU (cv::Mat) and via the OpenCL T-API (cv::UMat) as baseline for the device methods
+ *
+ * The pyramid has the same structure as the device pyramids: the first level of every octave is downsampled from the last level of the previous octave and
+ * the other levels are copies. The derivatives are computed with cv::Scharr for sigma size 1 (same kernel as the device) and with cv::sepFilter2D and the
+ * kernels of the filter bank otherwise. The CPU results are the reference for the error of the device methods.
+ */
+class OpenCVBaseline
+{
+public:
+    enum Downsampling
+    {
+        RESIZE_AREA,    //!< cv::resize with INTER_AREA, i.e. the 2x2 average of fed_resize
+        PYR_DOWN        //!< cv::pyrDown (Gaussian smoothing before the subsampling, does not match the device pyramid)
+    };
+
+    struct Timing
+    {
+        double mat = 0.0;   //!< Median in milliseconds
+        double umat = 0.0;
+    };
+
+public:
+    explicit OpenCVBaseline(const cv::Mat& img, const int numberOctaves = 4, const int levelsPerOctave = 4, const Downsampling downsampling = RESIZE_AREA,
+                            const int iterations = 10);
+
+    /**
+     * @brief Compares the results of the last filter test with the CPU reference
+     * @param deviceMilliseconds median time of the method (startFilterTest())
+     */
+    void compare(const std::string& pyramidName, const APyramid::Method method, const int sigmaSize, const double deviceMilliseconds, const APyramid::Levels& levels);
+
+    void print(std::ostream& stream) const;
+    void writeJson(const std::string& filename) const;
+
+private:
+    struct Comparison
+    {
+        std::string pyramid;
+        APyramid::Method method;
+        int sigmaSize;
+        double deviceMilliseconds;
+        double maxAbsError;             //!< Over all levels including the border
+        double maxAbsErrorInterior;     //!< Without the border pixels of the filter (the border handling differs between some methods)
+    };
+
+    struct Reference
+    {
+        Timing timing;
+        APyramid::Levels levels;        //!< Result of the CPU implementation
+        double maxAbsErrorUMat = 0.0;   //!< Deviation of the T-API result from the CPU result
+    };
+
+    /**
+     * @brief Times both implementations for the sigma size (once, the results are cached)
+     */
+    const Reference& reference(const int sigmaSize);
+
+    void buildPyramid(const cv::Mat& img, std::vector<cv::Mat>& levels) const;
+    void buildPyramid(const cv::UMat& img, std::vector<cv::UMat>& levels) const;
+
+    /**
+     * @return NaN if the device time is not positive
+     */
+    static double speedup(const double baselineMilliseconds, const double deviceMilliseconds);
+
+private:
+    const cv::Mat img;
+    const int numberOctaves;
+    const int levelsPerOctave;
+    const Downsampling downsampling;
+    const int iterations;
+
+    std::map<int, Reference> references;
+    std::vector<Comparison> comparisons;
+};
@@ -0,0 +1,198 @@
+#include "ProgramCache.h"
+#include "KernelSources.h"
+#include "general.h"
+#include <iostream>
+#include <algorithm>
+
+ProgramCache::ProgramCache(const KernelRegistry::Storage storage)
+    : storage(storage)
+{}
+
+ProgramCache::~ProgramCache()
+{
+    // The build callback must not be called after the cache is destroyed
+    waitForBackgroundBuilds();
+}
+
+void ProgramCache::init(const cl::Context& context, const std::string& buildOptions)
+{
+    waitForBackgroundBuilds();
+
+    this->context = context;
+    this->buildOptions = buildOptions;
+
+    const size_t numberUnits = KernelSources::storages[storage].numberUnits;
+    programs.clear();
+    programs.resize(numberUnits);
+    status.assign(numberUnits, NOT_BUILT);
+    callbackData.resize(numberUnits);
+
+    unitReady.reset(new std::atomic<bool>[numberUnits]);
+    for (size_t unit = 0; unit < numberUnits; ++unit)
+    {
+        unitReady[unit] = true;
+    }
+
+    // The unit of every registry entry is resolved once so that filterKernel() does not need to search for the kernel name before every launch
+    const KernelRegistry::Kernel* registry = &KernelRegistry::kernels[storage][0][0][0];
+    const size_t numberEntries = KernelRegistry::NUMBER_MULTIPLICITIES * KernelRegistry::NUMBER_MEMORIES * KernelRegistry::NUMBER_SIZES;
+    registryUnits.resize(numberEntries);
+    for (size_t i = 0; i < numberEntries; ++i)
+    {
+        registryUnits[i] = KernelSources::findUnit(storage, registry[i].name);
+    }
+}
+
+void ProgramCache::build(const std::vector<const char*>& kernelNames)
+{
+    for (const char* name : kernelNames)
+    {
+        program(KernelSources::findUnit(storage, name));
+    }
+}
+
+void ProgramCache::buildInBackground()
+{
+    for (size_t unit = 0; unit < programs.size(); ++unit)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (status[unit] != NOT_BUILT)
+            {
+                continue;
+            }
+            status[unit] = BUILDING;
+            unitReady[unit] = false;
+        }
+
+        programs[unit] = cl::Program(context, KernelSources::unitSource(storage, unit));
+        callbackData[unit] = { this, unit };
+
+        // The mutex must not be locked here since some drivers call the callback before the build function returns
+        try
+        {
+            programs[unit].build(buildOptions.c_str(), buildFinished, &callbackData[unit]);
+        }
+        catch (const cl::BuildError& buildError)
+        {
+            printBuildLog(unit, buildError.getBuildLog());
+
+            std::lock_guard<std::mutex> lock(mutex);
+            status[unit] = FAILED;
+            unitReady[unit] = true;
+            buildDone.notify_all();
+        }
+    }
+}
+
+bool ProgramCache::ready(const char* name) const
+{
+    return unitReady[unitChecked(name)];
+}
+
+bool ProgramCache::ready(const KernelRegistry::Kernel& kernel) const
+{
+    const size_t entry = &kernel - &KernelRegistry::kernels[storage][0][0][0];
+    ASSERT(entry < registryUnits.size(), "The kernel " << kernel.name << " is not an entry of the registry of this storage type");
+
+    return unitReady[registryUnits[entry]];
+}
+
+cl::Kernel ProgramCache::kernel(const char* name)
+{
+    return cl::Kernel(program(unitChecked(name)), name);
+}
+
+std::vector<const char*> ProgramCache::kernelNames() const
+{
+    const KernelSources::StorageSources& sources = KernelSources::storages[storage];
+
+    std::vector<const char*> names;
+    for (size_t i = 0; i < sources.numberKernels; ++i)
+    {
+        names.push_back(sources.kernels[i].name);
+    }
+
+    return names;
+}
+
+void CL_CALLBACK ProgramCache::buildFinished(cl_program program, void* userData)
+{
+    const BuildCallbackData* data = static_cast<const BuildCallbackData*>(userData);
+
+    // The build is only successful if it succeeded for every device of the context
+    bool success = true;
+    const cl::Program builtProgram(program, true);
+    for (const auto& deviceStatus : builtProgram.getBuildInfo<CL_PROGRAM_BUILD_STATUS>())
+    {
+        success = success && deviceStatus.second == CL_BUILD_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> lock(data->cache->mutex);
+    data->cache->status[data->unit] = success ? BUILT : FAILED;
+    data->cache->unitReady[data->unit] = true;
+    data->cache->buildDone.notify_all();
+}
+
+const cl::Program& ProgramCache::program(const size_t unit)
+{
+    Status unitStatus;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        buildDone.wait(lock, [&]() { return status[unit] != BUILDING; });
+        unitStatus = status[unit];
+    }
+
+    if (unitStatus == NOT_BUILT)
+    {
+        cl::Program program(context, KernelSources::unitSource(storage, unit));
+
+        try
+        {
+            program.build(buildOptions.c_str());
+        }
+        catch (const cl::BuildError& buildError)
+        {
+            printBuildLog(unit, buildError.getBuildLog());
+            throw;
+        }
+
+        programs[unit] = program;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        status[unit] = BUILT;
+    }
+    else if (unitStatus == FAILED)
+    {
+        printBuildLog(unit, programs[unit].getBuildInfo<CL_PROGRAM_BUILD_LOG>());
+        ASSERT("The background build of the unit " << KernelSources::storages[storage].units[unit].name << " failed");
+    }
+
+    return programs[unit];
+}
+
+void ProgramCache::printBuildLog(const size_t unit, const cl::BuildLogType& buildLog) const
+{
+    std::cout << "Build of the unit " << KernelSources::storages[storage].units[unit].name << " failed, build info:" << std::endl;
+    for (const auto& b : buildLog)
+    {
+        std::cout << b.second << std::endl;
+    }
+}
+
+size_t ProgramCache::unitChecked(const char* name) const
+{
+    const size_t unit = KernelSources::findUnit(storage, name);
+    ASSERT(unit < status.size(), "The program cache is not initialized");
+
+    return unit;
+}
+
+void ProgramCache::waitForBackgroundBuilds()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    buildDone.wait(lock, [&]()
+    {
+        return std::none_of(status.begin(), status.end(), [](const Status unitStatus) { return unitStatus == BUILDING; });
+    });
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <condition_variable>
+#include "opencl_common.h"
+#include "KernelRegistry.h"
+
+/**
+ * @brief Programs of one storage type built from the embedded kernel sources (see KernelSources.h)
+ *
+ * Every compilation unit is built when one of its kernels is requested for the first time so that the build time is proportional to the number of
+ * variants which are actually used and not to the size of all generated kernels. Alternatively, the remaining units can be built in the background
+ * (buildInBackground()) while the kernels which are already built are used.
+ */
+class ProgramCache
+{
+public:
+    explicit ProgramCache(const KernelRegistry::Storage storage);
+    ~ProgramCache();
+
+    void init(const cl::Context& context, const std::string& buildOptions);
+
+    /**
+     * @brief Builds the units of the given kernels immediately (blocking)
+     */
+    void build(const std::vector<const char*>& kernelNames);
+
+    /**
+     * @brief Starts the build of all units which are not built yet. The function returns immediately and the driver notifies the cache via the build callback
+     */
+    void buildInBackground();
+
+    /**
+     * @brief Blocks until all units which are built in the background are finished (e.g. so that the build does not interfere with time measurements)
+     */
+    void waitForBackgroundBuilds();
+
+    /**
+     * @return false while the unit of the kernel is built in the background, i.e. true if the kernel can be requested without waiting for the driver
+     */
+    bool ready(const char* name) const;
+
+    /**
+     * @brief Same as ready(const char*) for an entry of KernelRegistry::kernels of the storage type (no lookup and no locking, safe to call before every launch)
+     */
+    bool ready(const KernelRegistry::Kernel& kernel) const;
+
+    /**
+     * @brief Creates the kernel and builds the program of its unit if necessary (or waits until the background build of the unit is finished)
+     */
+    cl::Kernel kernel(const char* name);
+
+    /**
+     * @return names of all kernels of the storage type (sorted)
+     */
+    std::vector<const char*> kernelNames() const;
+
+    KernelRegistry::Storage getStorage() const
+    {
+        return storage;
+    }
+
+private:
+    enum Status
+    {
+        NOT_BUILT,
+        BUILDING,
+        BUILT,
+        FAILED
+    };
+
+    struct BuildCallbackData
+    {
+        ProgramCache* cache;
+        size_t unit;
+    };
+
+    static void CL_CALLBACK buildFinished(cl_program program, void* userData);
+
+    const cl::Program& program(const size_t unit);
+    void printBuildLog(const size_t unit, const cl::BuildLogType& buildLog) const;
+    size_t unitChecked(const char* name) const;
+
+private:
+    const KernelRegistry::Storage storage;
+    cl::Context context;
+    std::string buildOptions;
+    std::vector<cl::Program> programs;  //!< Index is the unit, empty until the unit is used
+    std::vector<Status> status;
+    std::vector<BuildCallbackData> callbackData;
+    std::unique_ptr<std::atomic<bool>[]> unitReady;     //!< Index is the unit, false while the unit is built in the background (set by the build callback)
+    std::vector<size_t> registryUnits;                  //!< Unit of every entry of KernelRegistry::kernels[storage] (flattened)
+
+    std::mutex mutex;                   //!< Protects the status (the build callback is called from a driver thread)
+    std::condition_variable buildDone;
+};
@@ -3,6 +3,7 @@
 
 PyramidBuffer::PyramidBuffer(const cv::Mat& img)
     : APyramid(img),
+      programFilter(KernelFilterBuffer<cl::Buffer>::storage),
       kernelFilter(&opencl, &programFilter),
       kernelFilter2(&opencl, &programFilter)
 {}
@@ -10,23 +11,28 @@ PyramidBuffer::PyramidBuffer(const cv::Mat& img)
 PyramidBuffer::~PyramidBuffer()
 {}
 
-void PyramidBuffer::init()
+bool PyramidBuffer::init()
 {
     try
     {
         opencl.selectDevice();
         opencl.init();
+        filterBank.init(&opencl);
 
-        programFilter = cl::Program(opencl.getContext(), AKernel<KernelFilterBuffer<cl::Buffer>>::kernelSource());
-
+        // The programs are built from the embedded sources. The generic kernels are needed immediately, the specialized kernels (unrolled and predefined filters)
+        // follow in the background and are used as soon as they are ready (the generic kernels are used in the meantime)
 #ifdef DEBUG_INTEL
-        programFilter.build((opencl.getBuildOptions() + " -Werror -g -s kernels/filter_buffer.cl").c_str());
+        programFilter.init(opencl.getContext(), opencl.getBuildOptions() + " -Werror -g");
 #else
-        programFilter.build(opencl.getBuildOptions().c_str());
+        programFilter.init(opencl.getContext(), opencl.getBuildOptions());
 #endif
+        programFilter.build({ "fed_resize", "filter_single", "filter_single_local", "filter_double", "filter_double_local" });
+        programFilter.buildInBackground();
 
         createPyramid();
         opencl.getQueue().finish();
+
+        return true;
     }
     catch (const cl::BuildError& buildError)
     {
@@ -40,6 +46,8 @@ void PyramidBuffer::init()
     {
         std::cout << error.what() << " (" << error.err() << ")" << std::endl;
     }
+
+    return false;
 }
 
 long long PyramidBuffer::startFilterTest()
@@ -59,9 +67,18 @@ long long PyramidBuffer::startFilterTest()
         case SINGLE_LOCAL:
             calcDerivativesSingleLocal();
             break;
+        case SINGLE_SLIDING:
+            calcDerivativesSingleSliding();
+            break;
+        case SINGLE_LOCAL_PERSISTENT:
+            calcDerivativesSingleLocalPersistent();
+            break;
         case SINGLE_SEPARATION_LOCAL:
             calcDerivativesSingleSeparationLocal();
             break;
+        case SINGLE_SEPARATION_TRANSPOSED:
+            calcDerivativesSingleSeparationTransposed();
+            break;
         default:
             break;
     }
@@ -74,17 +91,61 @@ long long PyramidBuffer::startFilterTest()
     return diff;
 }
 
+bool PyramidBuffer::supports(const Method method) const
+{
+    switch (method)
+    {
+        case SINGLE:
+        case SINGLE_LOCAL:
+        case SINGLE_SLIDING:
+        case SINGLE_LOCAL_PERSISTENT:
+        case SINGLE_SEPARATION_LOCAL:
+        case SINGLE_SEPARATION_TRANSPOSED:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void PyramidBuffer::readImages()
 {
-    std::vector<cv::Mat> img = readImageStack(images);
-    std::vector<cv::Mat> imgGx = readImageStack(imagesGx);
-    std::vector<cv::Mat> imgGy = readImageStack(imagesGy);
+    const Levels levels = readLevels();
 
     cv::Mat testGx;
-    cv::sepFilter2D(img[0], testGx, CV_32FC1, Gx2, Gx1);
+    cv::sepFilter2D(levels.images[0], testGx, CV_32FC1, Gx2, Gx1);
 
     cv::Mat testGy;
-    cv::filter2D(img[0], testGy, CV_32FC1, Gy);
+    cv::filter2D(levels.images[0], testGy, CV_32FC1, Gy);
+}
+
+APyramid::Levels PyramidBuffer::readLevels()
+{
+    const std::vector<cv::Mat> stack = readImageStack(images);
+    const std::vector<cv::Mat> stackGx = readImageStack(imagesGx);
+    const std::vector<cv::Mat> stackGy = readImageStack(imagesGy);
+
+    // The levels of the stack only wrap the data of the whole pyramid (last element)
+    Levels levels;
+    for (size_t i = 0; i < locationLoopup.size(); ++i)
+    {
+        levels.images.push_back(stack[i].clone());
+        levels.Gx.push_back(stackGx[i].clone());
+        levels.Gy.push_back(stackGy[i].clone());
+    }
+
+    return levels;
+}
+
+APyramid::OctaveMemory PyramidBuffer::firstOctave()
+{
+    // The levels of the first octave are stored one after another at the beginning of the buffer
+    OctaveMemory octave;
+    octave.memory = images;
+    octave.cols = locationLoopup[0].imgWidth;
+    octave.rows = locationLoopup[0].imgHeight;
+    octave.depth = levelsPerOctave;
+
+    return octave;
 }
 
 std::string PyramidBuffer::name()
@@ -92,6 +153,11 @@ std::string PyramidBuffer::name()
     return "Buffer";
 }
 
+ProgramCache& PyramidBuffer::getProgramCache()
+{
+    return programFilter;
+}
+
 std::vector<cv::Mat> PyramidBuffer::readImageStack(const cl::Buffer& images)
 {
     cv::Mat pyramid(1, totalPixels, CV_32FC1);
@@ -184,8 +250,8 @@ void PyramidBuffer::createPyramid()
 
 void PyramidBuffer::calcDerivativesSingle()
 {
-    kernelFilter.setKernel1(Gx);
-    kernelFilter2.setKernel1(Gy);
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
@@ -199,8 +265,8 @@ void PyramidBuffer::calcDerivativesSingle()
 
 void PyramidBuffer::calcDerivativesSingleLocal()
 {
-    kernelFilter.setKernel1(Gx);
-    kernelFilter2.setKernel1(Gy);
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
@@ -212,10 +278,40 @@ void PyramidBuffer::calcDerivativesSingleLocal()
     }
 }
 
+void PyramidBuffer::calcDerivativesSingleSliding()
+{
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
+
+    kernelFilter.setBorder(cv::BORDER_DEFAULT);
+    kernelFilter2.setBorder(cv::BORDER_DEFAULT);
+
+    for (int o = 0; o < numberOctaves; ++o)
+    {
+        kernelFilter.runSingleSliding(images, imagesGx, bufferLocationLookup, o, locationLoopup);
+        kernelFilter2.runSingleSliding(images, imagesGy, bufferLocationLookup, o, locationLoopup);
+    }
+}
+
+void PyramidBuffer::calcDerivativesSingleLocalPersistent()
+{
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
+
+    kernelFilter.setBorder(cv::BORDER_DEFAULT);
+    kernelFilter2.setBorder(cv::BORDER_DEFAULT);
+
+    for (int o = 0; o < numberOctaves; ++o)
+    {
+        kernelFilter.runSingleLocalPersistent(images, imagesGx, bufferLocationLookup, o, locationLoopup);
+        kernelFilter2.runSingleLocalPersistent(images, imagesGy, bufferLocationLookup, o, locationLoopup);
+    }
+}
+
 void PyramidBuffer::calcDerivativesSingleSeparationLocal()
 {
-    kernelFilter.setKernelSeparation1(Gx1, Gx2);
-    kernelFilter2.setKernelSeparation1(Gy1, Gy2);
+    kernelFilter.setKernelSeparation1(derivativeFilters().Gx1, derivativeFilters().Gx2);
+    kernelFilter2.setKernelSeparation1(derivativeFilters().Gy1, derivativeFilters().Gy2);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
@@ -226,3 +322,18 @@ void PyramidBuffer::calcDerivativesSingleSeparationLocal()
         kernelFilter2.runSingleSeparationLocal(images, imagesGy, bufferLocationLookup, o, locationLoopup);
     }
 }
+
+void PyramidBuffer::calcDerivativesSingleSeparationTransposed()
+{
+    kernelFilter.setKernelSeparation1(derivativeFilters().Gx1, derivativeFilters().Gx2);
+    kernelFilter2.setKernelSeparation1(derivativeFilters().Gy1, derivativeFilters().Gy2);
+
+    kernelFilter.setBorder(cv::BORDER_DEFAULT);
+    kernelFilter2.setBorder(cv::BORDER_DEFAULT);
+
+    for (int o = 0; o < numberOctaves; ++o)
+    {
+        kernelFilter.runSingleSeparationTransposed(images, imagesGx, bufferLocationLookup, o, locationLoopup);
+        kernelFilter2.runSingleSeparationTransposed(images, imagesGy, bufferLocationLookup, o, locationLoopup);
+    }
+}
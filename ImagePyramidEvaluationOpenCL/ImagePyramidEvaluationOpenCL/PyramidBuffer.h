@@ -9,20 +9,27 @@ public:
     explicit PyramidBuffer(const cv::Mat& img);
     virtual ~PyramidBuffer();
 
-    virtual void init() override;
+    virtual bool init() override;
     virtual long long startFilterTest() override;
     virtual void readImages() override;
+    virtual Levels readLevels() override;
+    virtual OctaveMemory firstOctave() override;
     virtual std::string name() override;
+    virtual ProgramCache& getProgramCache() override;
+    virtual bool supports(const Method method) const override;
 
 private:
     std::vector<cv::Mat> readImageStack(const cl::Buffer& images);
     void createPyramid();
     void calcDerivativesSingle();
     void calcDerivativesSingleLocal();
+    void calcDerivativesSingleSliding();
+    void calcDerivativesSingleLocalPersistent();
     void calcDerivativesSingleSeparationLocal();
+    void calcDerivativesSingleSeparationTransposed();
 
 private:
-    cl::Program programFilter;
+    ProgramCache programFilter;
     KernelFilterBuffer<cl::Buffer> kernelFilter;
     KernelFilterBuffer<cl::Buffer> kernelFilter2;
     
@@ -0,0 +1,416 @@
+#include "PyramidCpu.h"
+#include "general.h"
+#include <opencv2/imgproc.hpp>
+#include <chrono>
+#include <map>
+#include <algorithm>
+#include <cmath>
+
+static const int tileCols = 256;    // Multiple of the vector width of every instruction set
+static const int tileRows = 32;     // The filter rows of a tile stay in the L1/L2 cache
+static const int minBandRows = 16;  // At least twice the largest filter apron so that a pass lags at most one band behind its input
+
+PyramidCpu::PyramidCpu(const cv::Mat& img, const Traversal traversal, const size_t numberThreads)
+    : APyramid(img),
+      pool(numberThreads),
+      isa(FilterCpu::bestIsa()),
+      traversal(traversal)
+{}
+
+PyramidCpu::~PyramidCpu()
+{}
+
+bool PyramidCpu::init()
+{
+    std::cout << "Used CPU: " << pool.size() << " threads, " << FilterCpu::isaToString(isa);
+    if (traversal == CACHE_BLOCKED)
+    {
+        // Every thread works on a vertical strip of whole tiles (see runBlocked()). A band of the strip holds the source rows and the outputs of all
+        // levels of the octave (Gx, Gy and the two intermediate images), the bands of the higher octaves are a quarter of the size of the previous one
+        const int tilesPerRow = (img.cols + tileCols - 1) / tileCols;
+        const int stripCols = (tilesPerRow + static_cast<int>(pool.size()) - 1) / static_cast<int>(pool.size()) * tileCols;
+        double octaves = 0.0;
+        for (int o = 0; o < numberOctaves; ++o)
+        {
+            octaves += std::pow(0.25, o);
+        }
+        const double bytesPerRow = stripCols * sizeof(float) * (1 + 4 * levelsPerOctave) * octaves;
+        bandRows = std::max(static_cast<int>(FilterCpu::cacheSizeL2() / bytesPerRow), minBandRows);
+
+        std::cout << ", cache-blocked in bands of " << bandRows << " rows of " << stripCols << " columns per thread (L2: " << FilterCpu::cacheSizeL2() / 1024 << " KiB)";
+    }
+    std::cout << std::endl;
+
+    createPyramid();
+
+    return true;
+}
+
+long long PyramidCpu::startFilterTest()
+{
+    long long diff = 0;
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    switch (settings.method)
+    {
+        case SINGLE_SEPARATION:
+            calcDerivativesSingleSeparation();
+            break;
+        case SINGLE:
+            calcDerivativesSingle();
+            break;
+        case DOUBLE:
+            calcDerivativesDouble();
+            break;
+        case DOUBLE_SEPARATION:
+            calcDerivativesDoubleSeparation();
+            break;
+        default:
+            break;
+    }
+
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
+
+    return diff;
+}
+
+bool PyramidCpu::supports(const Method method) const
+{
+    switch (method)
+    {
+        case SINGLE_SEPARATION:
+        case SINGLE:
+        case DOUBLE:
+        case DOUBLE_SEPARATION:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool PyramidCpu::usesOpenCL() const
+{
+    return false;
+}
+
+void PyramidCpu::readImages()
+{
+    const Levels levels = readLevels();
+
+    cv::Mat testGx;
+    cv::sepFilter2D(levels.images[0], testGx, CV_32FC1, Gx2, Gx1);
+
+    cv::Mat testGy;
+    cv::filter2D(levels.images[0], testGy, CV_32FC1, Gy);
+}
+
+APyramid::Levels PyramidCpu::readLevels()
+{
+    Levels levels;
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        levels.images.push_back(images[i].clone());
+        levels.Gx.push_back(imagesGx[i].clone());
+        levels.Gy.push_back(imagesGy[i].clone());
+    }
+
+    return levels;
+}
+
+APyramid::OctaveMemory PyramidCpu::firstOctave()
+{
+    OctaveMemory octave;
+    octave.cols = images[0].cols;
+    octave.rows = images[0].rows;
+    octave.depth = levelsPerOctave;
+
+    return octave;
+}
+
+std::string PyramidCpu::name()
+{
+    return traversal == CACHE_BLOCKED ? "CpuBlocked" : "Cpu";
+}
+
+ProgramCache& PyramidCpu::getProgramCache()
+{
+    ASSERT("The CPU pyramid has no OpenCL programs");
+}
+
+void PyramidCpu::createPyramid()
+{
+    ASSERT(img.type() == CV_32FC1, "Only float images are supported");
+
+    images.resize(pyramidSize);
+    imagesGx.resize(pyramidSize);
+    imagesGy.resize(pyramidSize);
+    imagesTmp.resize(pyramidSize);
+    imagesTmp2.resize(pyramidSize);
+
+    // The first level is the input image. The other levels of an octave are copies, they share the data since the images are only read
+    images[0] = img;
+    for (size_t i = 1; i < images.size(); ++i)
+    {
+        if (i % levelsPerOctave == 0)
+        {
+            images[i].create(images[i - 1].rows / 2, images[i - 1].cols / 2, CV_32FC1);
+        }
+        else
+        {
+            images[i] = images[i - 1];
+        }
+    }
+    halfsample();
+
+    // The outputs are allocated once so that the filter tests only measure the filters
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        imagesGx[i].create(images[i].size(), CV_32FC1);
+        imagesGy[i].create(images[i].size(), CV_32FC1);
+        imagesTmp[i].create(images[i].size(), CV_32FC1);
+        imagesTmp2[i].create(images[i].size(), CV_32FC1);
+    }
+}
+
+void PyramidCpu::halfsample()
+{
+    // One parallel loop per octave since every octave is downsampled from the previous one
+    for (size_t i = levelsPerOctave; i < images.size(); i += levelsPerOctave)
+    {
+        const cv::Mat& src = images[i - 1];
+        cv::Mat& dst = images[i];
+
+        const std::vector<cv::Rect> t = tiles(dst.size());
+        pool.parallelFor(t.size(), [&](const size_t j) { FilterCpu::halfsample(isa, src, dst, t[j]); });
+    }
+}
+
+void PyramidCpu::run(const std::vector<std::vector<Pass>>& stages)
+{
+    if (traversal == CACHE_BLOCKED)
+    {
+        std::vector<Pass> passes;
+        for (const std::vector<Pass>& stage : stages)
+        {
+            passes.insert(passes.end(), stage.begin(), stage.end());
+        }
+
+        runBlocked(passes);
+    }
+    else
+    {
+        // The halfsampling is part of the measurement like in the cache-blocked traversal
+        halfsample();
+        for (const std::vector<Pass>& stage : stages)
+        {
+            runPasses(stage);
+        }
+    }
+}
+
+void PyramidCpu::runPasses(const std::vector<Pass>& passes)
+{
+    struct Task
+    {
+        const Pass* pass;
+        cv::Rect tile;
+    };
+
+    std::vector<Task> tasks;
+    for (const Pass& pass : passes)
+    {
+        for (const cv::Rect& tile : tiles(pass.src->size()))
+        {
+            tasks.push_back({ &pass, tile });
+        }
+    }
+
+    pool.parallelFor(tasks.size(), [&](const size_t i)
+    {
+        const Pass& pass = *tasks[i].pass;
+        FilterCpu::filter(isa, *pass.src, *pass.kernel1, pass.kernel2, *pass.dst1, pass.dst2, tasks[i].tile);
+    });
+}
+
+void PyramidCpu::runBlocked(const std::vector<Pass>& passes)
+{
+    struct Node
+    {
+        const cv::Mat* src;
+        cv::Mat* dst;
+        const Pass* pass;   // nullptr for the halfsampling of an octave
+        int producer;       // Node which writes src (-1 for the input image)
+        int apron;          // Rows of src below an output row which are read
+        int scale;          // Rows of src per output row
+        int band;           // Rows per step (proportional to the level size so that all octaves advance at the same pace through the image)
+        int done;
+        int target;
+    };
+
+    // The levels of an octave share their data, so the producer of an image is found via its data
+    std::vector<Node> nodes;
+    std::map<const unsigned char*, int> producers;
+    auto producer = [&](const cv::Mat& src)
+    {
+        const auto it = producers.find(src.data);
+        return it == producers.end() ? -1 : it->second;
+    };
+    auto band = [&](const cv::Mat& dst)
+    {
+        return std::max(bandRows * dst.rows / img.rows, 1);
+    };
+
+    for (size_t i = levelsPerOctave; i < images.size(); i += levelsPerOctave)
+    {
+        nodes.push_back({ &images[i - 1], &images[i], nullptr, producer(images[i - 1]), 0, 2, band(images[i]), 0, 0 });
+        producers[images[i].data] = static_cast<int>(nodes.size()) - 1;
+    }
+
+    for (const Pass& pass : passes)
+    {
+        nodes.push_back({ pass.src, pass.dst1, &pass, producer(*pass.src), pass.kernel1->rows / 2, 1, band(*pass.dst1), 0, 0 });
+        producers[pass.dst1->data] = static_cast<int>(nodes.size()) - 1;
+        if (pass.dst2)
+        {
+            producers[pass.dst2->data] = static_cast<int>(nodes.size()) - 1;
+        }
+    }
+
+    struct Task
+    {
+        const Node* node;
+        cv::Rect tile;
+        float position;     // Horizontal centre relative to the width of the level
+    };
+
+    std::vector<int> snapshot(nodes.size());
+    std::vector<Task> tasks;
+    while (true)
+    {
+        // The nodes only read rows which were finished in the previous steps
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            snapshot[i] = nodes[i].done;
+        }
+
+        tasks.clear();
+        bool finished = true;
+        for (Node& node : nodes)
+        {
+            if (node.done == node.dst->rows)
+            {
+                continue;
+            }
+            finished = false;
+
+            int available = node.dst->rows;
+            if (node.producer >= 0 && snapshot[node.producer] < node.src->rows)
+            {
+                available = std::max(snapshot[node.producer] - node.apron, 0) / node.scale;
+            }
+            node.target = std::min(node.done + node.band, available);
+
+            for (int x = 0; x < node.dst->cols && node.target > node.done; x += tileCols)
+            {
+                const int width = std::min(tileCols, node.dst->cols - x);
+                tasks.push_back({ &node, cv::Rect(x, node.done, width, node.target - node.done), (x + width / 2.0f) / node.dst->cols });
+            }
+        }
+
+        if (finished)
+        {
+            break;
+        }
+        ASSERT(!tasks.empty(), "No node of the cache-blocked traversal can advance");
+
+        // The thread pool hands out contiguous blocks, so every thread works on the same part of the image in all levels and steps
+        std::stable_sort(tasks.begin(), tasks.end(), [](const Task& a, const Task& b) { return a.position < b.position; });
+
+        pool.parallelFor(tasks.size(), [&](const size_t i)
+        {
+            const Node& node = *tasks[i].node;
+            if (node.pass)
+            {
+                FilterCpu::filter(isa, *node.src, *node.pass->kernel1, node.pass->kernel2, *node.pass->dst1, node.pass->dst2, tasks[i].tile);
+            }
+            else
+            {
+                FilterCpu::halfsample(isa, *node.src, *node.dst, tasks[i].tile);
+            }
+        });
+
+        for (Node& node : nodes)
+        {
+            node.done = node.target;
+        }
+    }
+}
+
+std::vector<cv::Rect> PyramidCpu::tiles(const cv::Size& size) const
+{
+    std::vector<cv::Rect> t;
+    for (int y = 0; y < size.height; y += tileRows)
+    {
+        for (int x = 0; x < size.width; x += tileCols)
+        {
+            t.push_back(cv::Rect(x, y, std::min(tileCols, size.width - x), std::min(tileRows, size.height - y)));
+        }
+    }
+
+    return t;
+}
+
+void PyramidCpu::calcDerivativesSingle()
+{
+    // Gx and Gy in separate passes like the two launches of the single filter kernels
+    std::vector<Pass> passesGx, passesGy;
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        passesGx.push_back({ &images[i], &Gx, nullptr, &imagesGx[i], nullptr });
+        passesGy.push_back({ &images[i], &Gy, nullptr, &imagesGy[i], nullptr });
+    }
+
+    run({ passesGx, passesGy });
+}
+
+void PyramidCpu::calcDerivativesSingleSeparation()
+{
+    // The second pass needs the neighbouring rows of the first pass, hence one parallel loop per pass
+    std::vector<Pass> passes1, passes2;
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        passes1.push_back({ &images[i], &Gx1, nullptr, &imagesTmp[i], nullptr });
+        passes1.push_back({ &images[i], &Gy1, nullptr, &imagesTmp2[i], nullptr });
+        passes2.push_back({ &imagesTmp[i], &Gx2, nullptr, &imagesGx[i], nullptr });
+        passes2.push_back({ &imagesTmp2[i], &Gy2, nullptr, &imagesGy[i], nullptr });
+    }
+
+    run({ passes1, passes2 });
+}
+
+void PyramidCpu::calcDerivativesDouble()
+{
+    std::vector<Pass> passes;
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        passes.push_back({ &images[i], &Gx, &Gy, &imagesGx[i], &imagesGy[i] });
+    }
+
+    run({ passes });
+}
+
+void PyramidCpu::calcDerivativesDoubleSeparation()
+{
+    // Both first passes read the image once, like the double kernel of the first step on the device
+    std::vector<Pass> passes1, passes2;
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        passes1.push_back({ &images[i], &Gx1, &Gy1, &imagesTmp[i], &imagesTmp2[i] });
+        passes2.push_back({ &imagesTmp[i], &Gx2, nullptr, &imagesGx[i], nullptr });
+        passes2.push_back({ &imagesTmp2[i], &Gy2, nullptr, &imagesGy[i], nullptr });
+    }
+
+    run({ passes1, passes2 });
+}
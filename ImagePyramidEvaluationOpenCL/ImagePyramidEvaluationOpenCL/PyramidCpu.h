@@ -0,0 +1,101 @@
+#pragma once
+
+#include "APyramid.h"
+#include "FilterCpu.h"
+#include "ThreadPool.h"
+
+/**
+ * @brief Pyramid computed natively on the CPU with SIMD kernels (see FilterCpu.h) in tiles distributed over a work-stealing thread pool
+ *
+ * Used as fallback if there is no OpenCL device and as baseline for the device pyramids. The pyramid has the same structure and only the base methods
+ * (SINGLE, SINGLE_SEPARATION, DOUBLE and DOUBLE_SEPARATION) are supported since the CPU has no local memory and no unrolled kernels. Their outputs are
+ * bit-identical with the generic OpenCL kernels of these methods if the device contracts the filter sums to FMAs (see FilterCpu.h). This does not hold
+ * for the predefined kernels which group equal taps and therefore sum in a different order (the accuracy validation reports the ULP difference to the
+ * image pyramid). The tiles of all levels are processed in one parallel loop per pass so that the small levels of the higher octaves don't leave threads
+ * idle.
+ *
+ * With the cache-blocked traversal, the pyramid is not processed pass by pass but in bands of rows which flow through the halfsampling and all filter
+ * passes of all levels before the next band is read (see runBlocked()). Every thread works on its own vertical strip of the image and the band height
+ * is chosen so that the band of the strip fits in the L2 cache. Since every pass only lags behind its input by the filter apron, the rows of the
+ * intermediate images are still in the cache when they are read again. Both traversals compute the halfsampling of the octaves in every filter test so
+ * that their times are comparable.
+ */
+class PyramidCpu : public APyramid
+{
+public:
+    enum Traversal
+    {
+        STREAMED,       //!< One parallel loop over the whole pyramid per pass
+        CACHE_BLOCKED   //!< Bands of rows sized to the L2 cache through all passes and octaves
+    };
+
+    /**
+     * @param numberThreads total number of threads (0 = number of hardware threads)
+     */
+    explicit PyramidCpu(const cv::Mat& img, const Traversal traversal = STREAMED, const size_t numberThreads = 0);
+    virtual ~PyramidCpu();
+
+    virtual bool init() override;
+    virtual long long startFilterTest() override;
+    virtual void readImages() override;
+    virtual Levels readLevels() override;
+
+    /**
+     * @brief The CPU pyramid has no device memory (the returned memory object is empty)
+     */
+    virtual OctaveMemory firstOctave() override;
+    virtual std::string name() override;
+    virtual ProgramCache& getProgramCache() override;
+    virtual bool supports(const Method method) const override;
+    virtual bool usesOpenCL() const override;
+
+private:
+    /**
+     * @brief One filter pass over one level (dst2 and kernel2 are only set for the double filters)
+     */
+    struct Pass
+    {
+        const cv::Mat* src;
+        const cv::Mat* kernel1;
+        const cv::Mat* kernel2;
+        cv::Mat* dst1;
+        cv::Mat* dst2;
+    };
+
+    void createPyramid();
+
+    /**
+     * @brief Downsamples the first level of every octave from the last level of the previous octave (streamed traversal)
+     */
+    void halfsample();
+
+    /**
+     * @brief Runs the stages with the selected traversal (the passes of a stage only read the input or the outputs of previous stages)
+     */
+    void run(const std::vector<std::vector<Pass>>& stages);
+    void runPasses(const std::vector<Pass>& passes);
+
+    /**
+     * @brief Cache-blocked traversal: the halfsampling of the octaves and the passes are nodes of a data flow graph and advance by at most one band
+     * per step. A node only processes the rows whose apron is already computed by its producer, so all tiles of a step are independent
+     */
+    void runBlocked(const std::vector<Pass>& passes);
+    std::vector<cv::Rect> tiles(const cv::Size& size) const;
+
+    void calcDerivativesSingle();
+    void calcDerivativesSingleSeparation();
+    void calcDerivativesDouble();
+    void calcDerivativesDoubleSeparation();
+
+private:
+    ThreadPool pool;
+    FilterCpu::Isa isa;
+    Traversal traversal;
+    int bandRows = 0;
+
+    std::vector<cv::Mat> images;
+    std::vector<cv::Mat> imagesGx;
+    std::vector<cv::Mat> imagesGy;
+    std::vector<cv::Mat> imagesTmp;     //!< Results of the first separation pass
+    std::vector<cv::Mat> imagesTmp2;
+};
@@ -1,8 +1,10 @@
 #include "PyramidCubes.h"
 #include <opencv2/imgproc.hpp>
+#include "Tracer.h"
 
 PyramidCubes::PyramidCubes(const cv::Mat& img)
     : APyramid(img),
+      programFilter(KernelFilterCubes::storage),
       kernelFilter(&opencl, &programFilter),
       kernelFilter2(&opencl, &programFilter)
 {}
@@ -10,7 +12,7 @@ PyramidCubes::PyramidCubes(const cv::Mat& img)
 PyramidCubes::~PyramidCubes()
 {}
 
-void PyramidCubes::init()
+bool PyramidCubes::init()
 {
     try
     {
@@ -18,12 +20,18 @@ void PyramidCubes::init()
 
         opencl.init();
 
-        programFilter = cl::Program(opencl.getContext(), AKernel<KernelFilterCubes>::kernelSource());
-        programFilter.build(opencl.getBuildOptions().c_str());
-        //programFilter.build((opencl.getBuildOptions() + " -Werror -g -s kernels/filter.cl").c_str());
+        filterBank.init(&opencl);
+
+        // The programs are built from the embedded sources. The generic kernels are needed immediately, the specialized kernels (unrolled and predefined filters)
+        // follow in the background and are used as soon as they are ready (the generic kernels are used in the meantime)
+        programFilter.init(opencl.getContext(), opencl.getBuildOptions());
+        programFilter.build({ "fed_resize", "filter_single", "filter_single_local", "filter_double", "filter_double_local" });
+        programFilter.buildInBackground();
 
         createPyramid();
         opencl.getQueue().finish();
+
+        return true;
     }
     catch (const cl::BuildError& buildError)
     {
@@ -37,6 +45,8 @@ void PyramidCubes::init()
     {
         std::cout << error.what() << " (" << error.err() << ")" << std::endl;
     }
+
+    return false;
 }
 
 long long PyramidCubes::startFilterTest()
@@ -68,29 +78,55 @@ long long PyramidCubes::startFilterTest()
     return diff;
 }
 
+bool PyramidCubes::supports(const Method method) const
+{
+    switch (method)
+    {
+        case SINGLE_SEPARATION:
+        case SINGLE:
+        case SINGLE_LOCAL:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void PyramidCubes::readImages()
 {
-    std::vector<cv::Mat> img(pyramidSize);
-    std::vector<cv::Mat> imgGx(pyramidSize);
-    std::vector<cv::Mat> imgGy(pyramidSize);
+    const Levels levels = readLevels();
+
+    cv::Mat testGx;
+    cv::sepFilter2D(levels.images[0], testGx, CV_32FC1, Gx2, Gx1);
 
-    int i = 0;
+    cv::Mat testGy;
+    cv::filter2D(levels.images[0], testGy, CV_32FC1, Gy);
+}
+
+APyramid::Levels PyramidCubes::readLevels()
+{
+    Levels levels;
     for (size_t o = 0; o < numberOctaves; ++o)
     {
         for (size_t l = 0; l < levelsPerOctave; ++l)
         {
-            img[i] = opencl.copyImageFromDevice(*images[o], l);
-            imgGx[i] = opencl.copyImageFromDevice(*imagesGx[o], l);
-            imgGy[i] = opencl.copyImageFromDevice(*imagesGy[o], l);
-            ++i;
+            levels.images.push_back(opencl.copyImageFromDevice(*images[o], l));
+            levels.Gx.push_back(opencl.copyImageFromDevice(*imagesGx[o], l));
+            levels.Gy.push_back(opencl.copyImageFromDevice(*imagesGy[o], l));
         }
     }
 
-    cv::Mat testGx;
-    cv::sepFilter2D(img[0], testGx, CV_32FC1, Gx2, Gx1);
+    return levels;
+}
 
-    cv::Mat testGy;
-    cv::filter2D(img[0], testGy, CV_32FC1, Gy);
+APyramid::OctaveMemory PyramidCubes::firstOctave()
+{
+    OctaveMemory octave;
+    octave.memory = *images[0];
+    octave.cols = img.cols;
+    octave.rows = img.rows;
+    octave.depth = levelsPerOctave;
+
+    return octave;
 }
 
 std::string PyramidCubes::name()
@@ -98,6 +134,11 @@ std::string PyramidCubes::name()
     return "Cube";
 }
 
+ProgramCache& PyramidCubes::getProgramCache()
+{
+    return programFilter;
+}
+
 void PyramidCubes::createPyramid()
 {
     images.resize(numberOctaves);
@@ -115,6 +156,10 @@ void PyramidCubes::createPyramid()
     std::array<size_t, 3> origin = { 0, 0, 0 };
     std::array<size_t, 3> imgSize = { cols, rows, 1 };
     opencl.getQueue().enqueueWriteImage(*images[0], CL_NON_BLOCKING, origin, imgSize, img.cols * sizeof(float), 0, img.data, nullptr, &lastEvent);
+    if (Tracer* tracer = opencl.getTracer())
+    {
+        tracer->record("write_image", img.cols, lastEvent);
+    }
 
     for (size_t i = 0; i < images.size(); ++i)
     {
@@ -152,8 +197,8 @@ void PyramidCubes::createPyramid()
 
 void PyramidCubes::calcDerivativesSingleSeparation()
 {
-    kernelFilter.setKernelSeparation1(Gx1, Gx2);
-    kernelFilter2.setKernelSeparation1(Gy1, Gy2);
+    kernelFilter.setKernelSeparation1(derivativeFilters().Gx1, derivativeFilters().Gx2);
+    kernelFilter2.setKernelSeparation1(derivativeFilters().Gy1, derivativeFilters().Gy2);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
@@ -167,8 +212,8 @@ void PyramidCubes::calcDerivativesSingleSeparation()
 
 void PyramidCubes::calcDerivativesSingle()
 {
-    kernelFilter.setKernel1(Gx);
-    kernelFilter2.setKernel1(Gy);
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
@@ -182,8 +227,8 @@ void PyramidCubes::calcDerivativesSingle()
 
 void PyramidCubes::calcDerivativesSingleLocal()
 {
-    kernelFilter.setKernel1(Gx);
-    kernelFilter2.setKernel1(Gy);
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
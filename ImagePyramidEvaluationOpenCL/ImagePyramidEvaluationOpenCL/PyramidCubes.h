@@ -9,10 +9,14 @@ public:
     explicit PyramidCubes(const cv::Mat& img);
     virtual ~PyramidCubes();
 
-    virtual void init() override;
+    virtual bool init() override;
     virtual long long startFilterTest() override;
     virtual void readImages() override;
+    virtual Levels readLevels() override;
+    virtual OctaveMemory firstOctave() override;
     virtual std::string name() override;
+    virtual ProgramCache& getProgramCache() override;
+    virtual bool supports(const Method method) const override;
 
 private:
     void createPyramid();
@@ -21,7 +25,7 @@ private:
     void calcDerivativesSingleLocal();
 
 private:
-    cl::Program programFilter;
+    ProgramCache programFilter;
     KernelFilterCubes kernelFilter;
     KernelFilterCubes kernelFilter2;
 
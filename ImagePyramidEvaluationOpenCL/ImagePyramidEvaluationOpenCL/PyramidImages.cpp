@@ -1,8 +1,10 @@
 #include "PyramidImages.h"
 #include <opencv2/imgproc.hpp>
+#include "Tracer.h"
 
 PyramidImages::PyramidImages(const cv::Mat& img)
     : APyramid(img),
+      programFilter(KernelFilterImages::storage),
       kernelFilter(&opencl, &programFilter),
       kernelFilter2(&opencl, &programFilter)
 {}
@@ -10,23 +12,28 @@ PyramidImages::PyramidImages(const cv::Mat& img)
 PyramidImages::~PyramidImages()
 {}
 
-void PyramidImages::init()
+bool PyramidImages::init()
 {
     try
     {
         opencl.selectDevice();
         opencl.init();
+        filterBank.init(&opencl);
 
-        programFilter = cl::Program(opencl.getContext(), AKernel<KernelFilterImages>::kernelSource());
-
+        // The programs are built from the embedded sources. The generic kernels are needed immediately, the specialized kernels (unrolled and predefined filters)
+        // follow in the background and are used as soon as they are ready (the generic kernels are used in the meantime)
 #ifdef DEBUG_INTEL
-        programFilter.build((opencl.getBuildOptions() + " -Werror -g -s kernels/filter_images.cl").c_str());
+        programFilter.init(opencl.getContext(), opencl.getBuildOptions() + " -Werror -g");
 #else
-        programFilter.build(opencl.getBuildOptions().c_str());
+        programFilter.init(opencl.getContext(), opencl.getBuildOptions());
 #endif
+        programFilter.build({ "fed_resize", "filter_single", "filter_single_local", "filter_double", "filter_double_local" });
+        programFilter.buildInBackground();
 
         createPyramid();
         opencl.getQueue().finish();
+
+        return true;
     }
     catch (const cl::BuildError& buildError)
     {
@@ -40,6 +47,8 @@ void PyramidImages::init()
     {
         std::cout << error.what() << " (" << error.err() << ")" << std::endl;
     }
+
+    return false;
 }
 
 long long PyramidImages::startFilterTest()
@@ -62,12 +71,18 @@ long long PyramidImages::startFilterTest()
         case DOUBLE_LOCAL:
             calcDerivativesDoubleLocal();
             break;
+        case DOUBLE_WINOGRAD:
+            calcDerivativesDoubleWinograd();
+            break;
         case DOUBLE_SEPARATION:
             calcDerivativesDoubleSeparation();
             break;
         case SINGLE_LOCAL:
             calcDerivativesSingleLocal();
             break;
+        case SINGLE_SLIDING:
+            calcDerivativesSingleSliding();
+            break;
         case SINGLE_SEPARATION_LOCAL:
             calcDerivativesSingleSeparationLocal();
             break;
@@ -83,6 +98,12 @@ long long PyramidImages::startFilterTest()
         case DOUBLE_PREDEFINED_LOCAL:
             calcDerivativesDoublePredefinedLocal();
             break;
+        case MULTI_SIGMA_LOCAL:
+            calcDerivativesMultiSigmaLocal();
+            break;
+        case SINGLE_DECOMPOSED:
+            calcDerivativesSingleDecomposed();
+            break;
         default:
             break;
     }
@@ -95,24 +116,63 @@ long long PyramidImages::startFilterTest()
     return diff;
 }
 
-void PyramidImages::readImages()
+bool PyramidImages::supports(const Method method) const
 {
-    std::vector<cv::Mat> img(pyramidSize);
-    std::vector<cv::Mat> imgGx(pyramidSize);
-    std::vector<cv::Mat> imgGy(pyramidSize);
-
-    for (size_t i = 0; i < img.size(); ++i)
+    switch (method)
     {
-        img[i] = opencl.copyImageFromDevice(*images[i]);
-        imgGx[i] = opencl.copyImageFromDevice(*imagesGx[i]);
-        imgGy[i] = opencl.copyImageFromDevice(*imagesGy[i]);
+        case SINGLE_SEPARATION:
+        case SINGLE:
+        case DOUBLE:
+        case DOUBLE_LOCAL:
+        case DOUBLE_WINOGRAD:
+        case DOUBLE_SEPARATION:
+        case SINGLE_LOCAL:
+        case SINGLE_SLIDING:
+        case SINGLE_SEPARATION_LOCAL:
+        case SINGLE_PREDEFINED:
+        case DOUBLE_PREDEFINED:
+        case SINGLE_PREDEFINED_LOCAL:
+        case DOUBLE_PREDEFINED_LOCAL:
+        case MULTI_SIGMA_LOCAL:
+        case SINGLE_DECOMPOSED:
+            return true;
+        default:
+            return false;
     }
+}
+
+void PyramidImages::readImages()
+{
+    const Levels levels = readLevels();
 
     cv::Mat testGx;
-    cv::sepFilter2D(img[0], testGx, CV_32FC1, Gx2, Gx1);
+    cv::sepFilter2D(levels.images[0], testGx, CV_32FC1, Gx2, Gx1);
 
     cv::Mat testGy;
-    cv::filter2D(img[0], testGy, CV_32FC1, Gy);
+    cv::filter2D(levels.images[0], testGy, CV_32FC1, Gy);
+}
+
+APyramid::Levels PyramidImages::readLevels()
+{
+    Levels levels;
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        levels.images.push_back(opencl.copyImageFromDevice(*images[i]));
+        levels.Gx.push_back(opencl.copyImageFromDevice(*imagesGx[i]));
+        levels.Gy.push_back(opencl.copyImageFromDevice(*imagesGy[i]));
+    }
+
+    return levels;
+}
+
+APyramid::OctaveMemory PyramidImages::firstOctave()
+{
+    OctaveMemory octave;
+    octave.memory = *images[0];
+    octave.cols = images[0].cols;
+    octave.rows = images[0].rows;
+
+    return octave;
 }
 
 std::string PyramidImages::name()
@@ -120,30 +180,44 @@ std::string PyramidImages::name()
     return "Image";
 }
 
+ProgramCache& PyramidImages::getProgramCache()
+{
+    return programFilter;
+}
+
 void PyramidImages::createPyramid()
 {
     images.resize(pyramidSize);
     imagesGx.resize(pyramidSize);
     imagesGy.resize(pyramidSize);
+    imagesGxMultiSigma.resize(pyramidSize);
+    imagesGyMultiSigma.resize(pyramidSize);
 
-    // Allocate global memory on the device
-    images[0] = std::make_shared<cl::Image2D>(opencl.getContext(), CL_MEM_READ_ONLY, cl::ImageFormat(CL_R, CL_FLOAT), img.cols, img.rows);
+    // Allocate global memory on the device. The properties of every level are stored once so that the kernels don't need to query them
+    images[0] = ImageLevel(opencl.getContext(), CL_MEM_READ_ONLY, img.cols, img.rows);
 
     // Copy the data to the GPU
     cl::Event lastEvent;
     std::array<size_t, 3> origin = { 0, 0, 0 };
     std::array<size_t, 3> imgSize = { static_cast<size_t>(img.cols), static_cast<size_t>(img.rows), 1 };
     opencl.getQueue().enqueueWriteImage(*images[0], CL_NON_BLOCKING, origin, imgSize, img.cols * sizeof(float), 0, img.data, nullptr, &lastEvent);
+    if (Tracer* tracer = opencl.getTracer())
+    {
+        tracer->record("write_image", img.cols, lastEvent);
+    }
 
     for (size_t i = 1; i < images.size(); ++i)
     {
         if (i % 4 == 0)
         {
-            lastEvent = kernelFilter.runHalfsampleImage(*images[i - 1], images[i]);
+            lastEvent = kernelFilter.runHalfsampleImage(images[i - 1], images[i]);
         }
         else
         {
-            lastEvent = opencl.copyImageOnDevice(*images[i - 1], images[i], lastEvent);
+            SPImage2D imgCopy;
+            lastEvent = opencl.copyImageOnDevice(*images[i - 1], imgCopy, lastEvent);
+            // The copy is a read-write image of the same size, no need to query its properties again
+            images[i] = ImageLevel(imgCopy, CL_MEM_READ_WRITE, images[i - 1].cols, images[i - 1].rows);
             kernelFilter.addEvent(lastEvent);
         }
     }
@@ -151,61 +225,108 @@ void PyramidImages::createPyramid()
 
 void PyramidImages::calcDerivativesSingleSeparation()
 {
-    kernelFilter.setKernelSeparation1(Gx1, Gx2);
-    kernelFilter2.setKernelSeparation1(Gy1, Gy2);
+    kernelFilter.setKernelSeparation1(derivativeFilters().Gx1, derivativeFilters().Gx2);
+    kernelFilter2.setKernelSeparation1(derivativeFilters().Gy1, derivativeFilters().Gy2);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runSingleSeparation(*images[i], imagesGx[i]);
-        kernelFilter2.runSingleSeparation(*images[i], imagesGy[i]);
+        kernelFilter.runSingleSeparation(images[i], imagesGx[i]);
+        kernelFilter2.runSingleSeparation(images[i], imagesGy[i]);
     }
 }
 
 void PyramidImages::calcDerivativesSingleSeparationLocal()
 {
-    kernelFilter.setKernelSeparation1(Gx1, Gx2);
-    kernelFilter2.setKernelSeparation1(Gy1, Gy2);
+    kernelFilter.setKernelSeparation1(derivativeFilters().Gx1, derivativeFilters().Gx2);
+    kernelFilter2.setKernelSeparation1(derivativeFilters().Gy1, derivativeFilters().Gy2);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runSingleSeparationLocal(*images[i], imagesGx[i]);
-        kernelFilter2.runSingleSeparationLocal(*images[i], imagesGy[i]);
+        kernelFilter.runSingleSeparationLocal(images[i], imagesGx[i]);
+        kernelFilter2.runSingleSeparationLocal(images[i], imagesGy[i]);
     }
 }
 
 void PyramidImages::calcDerivativesSingle()
 {
-    kernelFilter.setKernel1(Gx);
-    kernelFilter2.setKernel1(Gy);
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runSingle(*images[i], imagesGx[i]);
-        kernelFilter2.runSingle(*images[i], imagesGy[i]);
+        kernelFilter.runSingle(images[i], imagesGx[i]);
+        kernelFilter2.runSingle(images[i], imagesGy[i]);
     }
 }
 
 void PyramidImages::calcDerivativesSingleLocal()
 {
-    kernelFilter.setKernel1(Gx);
-    kernelFilter2.setKernel1(Gy);
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
+
+    kernelFilter.setBorder(cv::BORDER_DEFAULT);
+    kernelFilter2.setBorder(cv::BORDER_DEFAULT);
+
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        kernelFilter.runSingleLocal(images[i], imagesGx[i]);
+        kernelFilter2.runSingleLocal(images[i], imagesGy[i]);
+    }
+}
+
+void PyramidImages::calcDerivativesSingleDecomposed()
+{
+    // The SVD and the transfer of the decomposed filters are only necessary when the filters change
+    if (decompositionSigmaSize != settings.sigmaSize)
+    {
+        kernelFilter.setDecomposition(FilterDecomposition(derivativeFilters().Gx.kernel));
+        kernelFilter2.setDecomposition(FilterDecomposition(derivativeFilters().Gy.kernel));
+        decompositionSigmaSize = settings.sigmaSize;
+    }
+
+    kernelFilter.setBorder(cv::BORDER_DEFAULT);
+    kernelFilter2.setBorder(cv::BORDER_DEFAULT);
+
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        kernelFilter.runDecomposed(images[i], imagesGx[i]);
+        kernelFilter2.runDecomposed(images[i], imagesGy[i]);
+    }
+}
+
+cv::Mat PyramidImages::filterDecomposed(const FilterDecomposition& decomposition)
+{
+    kernelFilter.setDecomposition(decomposition);
+    kernelFilter.setBorder(cv::BORDER_DEFAULT);
+    decompositionSigmaSize = 0;     // The derivative filters must be set again by the next filter test
+
+    ImageLevel imgDst;
+    kernelFilter.runDecomposed(images[0], imgDst);
+
+    return opencl.copyImageFromDevice(*imgDst);
+}
+
+void PyramidImages::calcDerivativesSingleSliding()
+{
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runSingleLocal(*images[i], imagesGx[i]);
-        kernelFilter2.runSingleLocal(*images[i], imagesGy[i]);
+        kernelFilter.runSingleSliding(images[i], imagesGx[i]);
+        kernelFilter2.runSingleSliding(images[i], imagesGy[i]);
     }
 }
 
@@ -216,21 +337,21 @@ void PyramidImages::calcDerivativesSinglePredefined()
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runSinglePredefined(*images[i], imagesGx[i], "Gx", std::to_string(Gx.rows) + "x" + std::to_string(Gx.cols));
-        kernelFilter2.runSinglePredefined(*images[i], imagesGy[i], "Gy", std::to_string(Gy.rows) + "x" + std::to_string(Gy.cols));
+        kernelFilter.runSinglePredefined(images[i], imagesGx[i], KernelRegistry::GX, Gx.size());
+        kernelFilter2.runSinglePredefined(images[i], imagesGy[i], KernelRegistry::GY, Gy.size());
     }
 }
 
 void PyramidImages::calcDerivativesDoubleLocal()
 {
-    kernelFilter.setKernel1(Gx);
-    kernelFilter.setKernel2(Gy);
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter.setKernel2(derivativeFilters().Gy);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runDoubleLocal(*images[i], imagesGx[i], imagesGy[i]);
+        kernelFilter.runDoubleLocal(images[i], imagesGx[i], imagesGy[i]);
     }
 }
 
@@ -241,34 +362,47 @@ void PyramidImages::calcDerivativesSinglePredefinedLocal()
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runSinglePredefinedLocal(*images[i], imagesGx[i], "Gx", std::to_string(Gx.rows) + "x" + std::to_string(Gx.cols));
-        kernelFilter2.runSinglePredefinedLocal(*images[i], imagesGy[i], "Gy", std::to_string(Gy.rows) + "x" + std::to_string(Gy.cols));
+        kernelFilter.runSinglePredefinedLocal(images[i], imagesGx[i], KernelRegistry::GX, Gx.size());
+        kernelFilter2.runSinglePredefinedLocal(images[i], imagesGy[i], KernelRegistry::GY, Gy.size());
     }
 }
 
 void PyramidImages::calcDerivativesDouble()
 {
-    kernelFilter.setKernel1(Gx);
-    kernelFilter.setKernel2(Gy);
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter.setKernel2(derivativeFilters().Gy);
+
+    kernelFilter.setBorder(cv::BORDER_DEFAULT);
+
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        kernelFilter.runDouble(images[i], imagesGx[i], imagesGy[i]);
+    }
+}
+
+void PyramidImages::calcDerivativesDoubleWinograd()
+{
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter.setKernel2(derivativeFilters().Gy);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runDouble(*images[i], imagesGx[i], imagesGy[i]);
+        kernelFilter.runDoubleWinograd(images[i], imagesGx[i], imagesGy[i]);
     }
 }
 
 void PyramidImages::calcDerivativesDoubleSeparation()
 {
-    kernelFilter.setKernelSeparation1(Gx1, Gx2);
-    kernelFilter.setKernelSeparation2(Gy1, Gy2);
+    kernelFilter.setKernelSeparation1(derivativeFilters().Gx1, derivativeFilters().Gx2);
+    kernelFilter.setKernelSeparation2(derivativeFilters().Gy1, derivativeFilters().Gy2);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runDoubleSeparation(*images[i], imagesGx[i], imagesGy[i]);
+        kernelFilter.runDoubleSeparation(images[i], imagesGx[i], imagesGy[i]);
     }
 }
 
@@ -278,7 +412,7 @@ void PyramidImages::calcDerivativesDoublePredefined()
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runDoublePredefined(*images[i], imagesGx[i], imagesGy[i], "GxGy", std::to_string(Gx.rows) + "x" + std::to_string(Gx.cols));
+        kernelFilter.runDoublePredefined(images[i], imagesGx[i], imagesGy[i], Gx.size());
     }
 }
 
@@ -288,6 +422,22 @@ void PyramidImages::calcDerivativesDoublePredefinedLocal()
 
     for (size_t i = 0; i < images.size(); ++i)
     {
-        kernelFilter.runDoublePredefinedLocal(*images[i], imagesGx[i], imagesGy[i], "GxGy", std::to_string(Gx.rows) + "x" + std::to_string(Gx.cols));
+        kernelFilter.runDoublePredefinedLocal(images[i], imagesGx[i], imagesGy[i], Gx.size());
+    }
+}
+
+void PyramidImages::calcDerivativesMultiSigmaLocal()
+{
+    kernelFilter.setSmoothingCoefficients(filterBank.getSmoothingCoefficients());
+
+    kernelFilter.setBorder(cv::BORDER_DEFAULT);
+
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        kernelFilter.runDerivativesMultiSigmaLocal(images[i], imagesGxMultiSigma[i], imagesGyMultiSigma[i]);
+
+        // The responses of the current sigma size are the regular output (e.g. for readImages())
+        imagesGx[i] = imagesGxMultiSigma[i][settings.sigmaSize - 1];
+        imagesGy[i] = imagesGyMultiSigma[i][settings.sigmaSize - 1];
     }
 }
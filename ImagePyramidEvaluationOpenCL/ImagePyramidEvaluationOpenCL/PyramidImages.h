@@ -8,10 +8,19 @@ public:
     explicit PyramidImages(const cv::Mat& img);
     virtual ~PyramidImages();
     
-    virtual void init() override;
+    virtual bool init() override;
     virtual long long startFilterTest() override;
     virtual void readImages() override;
+    virtual Levels readLevels() override;
+    virtual OctaveMemory firstOctave() override;
     virtual std::string name() override;
+    virtual ProgramCache& getProgramCache() override;
+    virtual bool supports(const Method method) const override;
+
+    /**
+     * @brief Filters the first level with the strategy of the decomposition (border BORDER_DEFAULT, init() must have been called)
+     */
+    cv::Mat filterDecomposed(const FilterDecomposition& decomposition);
 
 private:
     void createPyramid();
@@ -19,20 +28,27 @@ private:
     void calcDerivativesSingleSeparationLocal();
     void calcDerivativesSingle();
     void calcDerivativesSingleLocal();
+    void calcDerivativesSingleDecomposed();
+    void calcDerivativesSingleSliding();
     void calcDerivativesSinglePredefined();
     void calcDerivativesSinglePredefinedLocal();
     void calcDerivativesDouble();
     void calcDerivativesDoubleLocal();
+    void calcDerivativesDoubleWinograd();
     void calcDerivativesDoubleSeparation();
     void calcDerivativesDoublePredefined();
     void calcDerivativesDoublePredefinedLocal();
+    void calcDerivativesMultiSigmaLocal();
 
 private:
-    cl::Program programFilter;
+    ProgramCache programFilter;
     KernelFilterImages kernelFilter;
     KernelFilterImages kernelFilter2;
 
-    std::vector<SPImage2D> images;
-    std::vector<SPImage2D> imagesGx;
-    std::vector<SPImage2D> imagesGy;
+    std::vector<ImageLevel> images;
+    std::vector<ImageLevel> imagesGx;
+    std::vector<ImageLevel> imagesGy;
+    std::vector<std::array<ImageLevel, 4>> imagesGxMultiSigma;   // Index is level, sigmaSize - 1
+    std::vector<std::array<ImageLevel, 4>> imagesGyMultiSigma;
+    int decompositionSigmaSize = 0;     // Sigma size of the filters set in the decompositions (0 = not set yet)
 };
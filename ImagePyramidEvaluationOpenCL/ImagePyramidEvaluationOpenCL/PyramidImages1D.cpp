@@ -3,6 +3,7 @@
 
 PyramidImages1D::PyramidImages1D(const cv::Mat& img)
     : APyramid(img),
+    programFilter(KernelFilterBuffer<cl::Image1DBuffer>::storage),
     kernelFilter(&opencl, &programFilter),
     kernelFilter2(&opencl, &programFilter)
 {}
@@ -10,23 +11,28 @@ PyramidImages1D::PyramidImages1D(const cv::Mat& img)
 PyramidImages1D::~PyramidImages1D()
 {}
 
-void PyramidImages1D::init()
+bool PyramidImages1D::init()
 {
     try
     {
         opencl.selectDevice();
         opencl.init();
+        filterBank.init(&opencl);
 
-        programFilter = cl::Program(opencl.getContext(), AKernel<KernelFilterBuffer<cl::Image1DBuffer>>::kernelSource());
-
+        // The programs are built from the embedded sources. The generic kernels are needed immediately, the specialized kernels (unrolled and predefined filters)
+        // follow in the background and are used as soon as they are ready (the generic kernels are used in the meantime)
 #ifdef DEBUG_INTEL
-        programFilter.build((opencl.getBuildOptions() + " -Werror -g -s kernels/filter_buffer.cl").c_str());
+        programFilter.init(opencl.getContext(), opencl.getBuildOptions() + " -Werror -g");
 #else
-        programFilter.build(opencl.getBuildOptions().c_str());
+        programFilter.init(opencl.getContext(), opencl.getBuildOptions());
 #endif
+        programFilter.build({ "fed_resize", "filter_single", "filter_single_local", "filter_double", "filter_double_local" });
+        programFilter.buildInBackground();
 
         createPyramid();
         opencl.getQueue().finish();
+
+        return true;
     }
     catch (const cl::BuildError& buildError)
     {
@@ -40,6 +46,8 @@ void PyramidImages1D::init()
     {
         std::cout << error.what() << " (" << error.err() << ")" << std::endl;
     }
+
+    return false;
 }
 
 long long PyramidImages1D::startFilterTest()
@@ -59,6 +67,9 @@ long long PyramidImages1D::startFilterTest()
         case SINGLE_LOCAL:
             calcDerivativesSingleLocal();
             break;
+        case SINGLE_LOCAL_PERSISTENT:
+            calcDerivativesSingleLocalPersistent();
+            break;
         case SINGLE_SEPARATION_LOCAL:
             calcDerivativesSingleSeparationLocal();
             break;
@@ -74,17 +85,59 @@ long long PyramidImages1D::startFilterTest()
     return diff;
 }
 
+bool PyramidImages1D::supports(const Method method) const
+{
+    switch (method)
+    {
+        case SINGLE:
+        case SINGLE_LOCAL:
+        case SINGLE_LOCAL_PERSISTENT:
+        case SINGLE_SEPARATION_LOCAL:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void PyramidImages1D::readImages()
 {
-    std::vector<cv::Mat> img = readImageStack(image);
-    std::vector<cv::Mat> imgGx = readImageStack(imageGx);
-    std::vector<cv::Mat> imgGy = readImageStack(imageGy);
+    const Levels levels = readLevels();
 
     cv::Mat testGx;
-    cv::sepFilter2D(img[0], testGx, CV_32FC1, Gx2, Gx1);
+    cv::sepFilter2D(levels.images[0], testGx, CV_32FC1, Gx2, Gx1);
 
     cv::Mat testGy;
-    cv::filter2D(img[0], testGy, CV_32FC1, Gy);
+    cv::filter2D(levels.images[0], testGy, CV_32FC1, Gy);
+}
+
+APyramid::Levels PyramidImages1D::readLevels()
+{
+    const std::vector<cv::Mat> stack = readImageStack(image);
+    const std::vector<cv::Mat> stackGx = readImageStack(imageGx);
+    const std::vector<cv::Mat> stackGy = readImageStack(imageGy);
+
+    // The levels of the stack only wrap the data of the whole pyramid (last element)
+    Levels levels;
+    for (size_t i = 0; i < locationLoopup.size(); ++i)
+    {
+        levels.images.push_back(stack[i].clone());
+        levels.Gx.push_back(stackGx[i].clone());
+        levels.Gy.push_back(stackGy[i].clone());
+    }
+
+    return levels;
+}
+
+APyramid::OctaveMemory PyramidImages1D::firstOctave()
+{
+    // The levels of the first octave are stored one after another at the beginning of the image
+    OctaveMemory octave;
+    octave.memory = image;
+    octave.cols = locationLoopup[0].imgWidth;
+    octave.rows = locationLoopup[0].imgHeight;
+    octave.depth = levelsPerOctave;
+
+    return octave;
 }
 
 std::string PyramidImages1D::name()
@@ -92,6 +145,11 @@ std::string PyramidImages1D::name()
     return "Image1DBuffer";
 }
 
+ProgramCache& PyramidImages1D::getProgramCache()
+{
+    return programFilter;
+}
+
 std::vector<cv::Mat> PyramidImages1D::readImageStack(const cl::Image1DBuffer& images)
 {
     cv::Mat pyramid(1, totalPixels, CV_32FC1);
@@ -171,8 +229,8 @@ void PyramidImages1D::createPyramid()
 
 void PyramidImages1D::calcDerivativesSingle()
 {
-    kernelFilter.setKernel1(Gx);
-    kernelFilter2.setKernel1(Gy);
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
@@ -186,8 +244,8 @@ void PyramidImages1D::calcDerivativesSingle()
 
 void PyramidImages1D::calcDerivativesSingleLocal()
 {
-    kernelFilter.setKernel1(Gx);
-    kernelFilter2.setKernel1(Gy);
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
@@ -199,10 +257,25 @@ void PyramidImages1D::calcDerivativesSingleLocal()
     }
 }
 
+void PyramidImages1D::calcDerivativesSingleLocalPersistent()
+{
+    kernelFilter.setKernel1(derivativeFilters().Gx);
+    kernelFilter2.setKernel1(derivativeFilters().Gy);
+
+    kernelFilter.setBorder(cv::BORDER_DEFAULT);
+    kernelFilter2.setBorder(cv::BORDER_DEFAULT);
+
+    for (int o = 0; o < numberOctaves; ++o)
+    {
+        kernelFilter.runSingleLocalPersistent(bufferImages, bufferImagesGx, bufferLocationLookup, o, locationLoopup);
+        kernelFilter2.runSingleLocalPersistent(bufferImages, bufferImagesGy, bufferLocationLookup, o, locationLoopup);
+    }
+}
+
 void PyramidImages1D::calcDerivativesSingleSeparationLocal()
 {
-    kernelFilter.setKernelSeparation1(Gx1, Gx2);
-    kernelFilter2.setKernelSeparation1(Gy1, Gy2);
+    kernelFilter.setKernelSeparation1(derivativeFilters().Gx1, derivativeFilters().Gx2);
+    kernelFilter2.setKernelSeparation1(derivativeFilters().Gy1, derivativeFilters().Gy2);
 
     kernelFilter.setBorder(cv::BORDER_DEFAULT);
     kernelFilter2.setBorder(cv::BORDER_DEFAULT);
@@ -9,20 +9,25 @@ public:
     explicit PyramidImages1D(const cv::Mat& img);
     virtual ~PyramidImages1D();
 
-    virtual void init() override;
+    virtual bool init() override;
     virtual long long startFilterTest() override;
     virtual void readImages() override;
+    virtual Levels readLevels() override;
+    virtual OctaveMemory firstOctave() override;
     virtual std::string name() override;
+    virtual ProgramCache& getProgramCache() override;
+    virtual bool supports(const Method method) const override;
 
 private:
     std::vector<cv::Mat> readImageStack(const cl::Image1DBuffer& images);
     void createPyramid();
     void calcDerivativesSingle();
     void calcDerivativesSingleLocal();
+    void calcDerivativesSingleLocalPersistent();
     void calcDerivativesSingleSeparationLocal();
 
 private:
-    cl::Program programFilter;
+    ProgramCache programFilter;
     KernelFilterBuffer<cl::Image1DBuffer> kernelFilter;
     KernelFilterBuffer<cl::Image1DBuffer> kernelFilter2;
     
@@ -0,0 +1,284 @@
+#include "Roofline.h"
+#include "AOpenCLInterface.h"
+#include "KernelSources.h"
+#include "JsonWriter.h"
+#include "general.h"
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+
+static const int fmaChains = 4 * 4;     // 4 chains with float4 vectors
+static const int repetitionsPeaks = 5;  // The best of several runs is used
+
+static double kernelSeconds(const cl::Event& event)
+{
+    event.wait();
+    const cl_ulong start = event.getProfilingInfo<CL_PROFILING_COMMAND_START>();
+    const cl_ulong end = event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+
+    return (end - start) * 1e-9;
+}
+
+static double storageOverhead(const KernelRegistry::Storage storage, const double outputPixels)
+{
+    const bool lookup = storage == KernelRegistry::BUFFER || storage == KernelRegistry::IMAGE1D;
+    return lookup ? outputPixels * sizeof(Lookup) : 0.0;
+}
+
+KernelCost CostModel::filter(const KernelRegistry::Storage storage, const size_t cols, const size_t rows, const size_t depth, const int taps, const int outputs)
+{
+    const double pixels = static_cast<double>(cols) * rows * depth;
+
+    KernelCost cost;
+    cost.bytesRead = pixels * taps * sizeof(float) + storageOverhead(storage, pixels);
+    cost.bytesWritten = pixels * outputs * sizeof(float);
+    cost.flops = 2.0 * pixels * taps * outputs;
+
+    return cost;
+}
+
+KernelCost CostModel::filterLocal(const KernelRegistry::Storage storage, const size_t cols, const size_t rows, const size_t depth, const int filterRows, const int filterCols,
+                                  const int outputs, const size_t localCols, const size_t localRows)
+{
+    const double pixels = static_cast<double>(cols) * rows * depth;
+    const double groups = static_cast<double>((cols + localCols - 1) / localCols) * ((rows + localRows - 1) / localRows) * depth;
+    const double tile = static_cast<double>(localCols + filterCols - 1) * (localRows + filterRows - 1);
+
+    KernelCost cost;
+    cost.bytesRead = groups * tile * sizeof(float) + storageOverhead(storage, pixels);
+    cost.bytesWritten = pixels * outputs * sizeof(float);
+    cost.flops = 2.0 * pixels * filterRows * filterCols * outputs;
+
+    return cost;
+}
+
+KernelCost CostModel::filterSliding(const KernelRegistry::Storage storage, const size_t cols, const size_t rows, const size_t depth, const int filterRows, const int filterCols,
+                                    const size_t stripWidth, const size_t chunkRows)
+{
+    const double pixels = static_cast<double>(cols) * rows * depth;
+    const double groups = static_cast<double>((cols + stripWidth - 1) / stripWidth) * ((rows + chunkRows - 1) / chunkRows) * depth;
+    const double strip = static_cast<double>(stripWidth + filterCols - 1) * (chunkRows + filterRows - 1);
+
+    KernelCost cost;
+    cost.bytesRead = groups * strip * sizeof(float) + storageOverhead(storage, pixels);
+    cost.bytesWritten = pixels * sizeof(float);
+    cost.flops = 2.0 * pixels * filterRows * filterCols;
+
+    return cost;
+}
+
+KernelCost CostModel::filterWinograd(const KernelRegistry::Storage storage, const size_t cols, const size_t rows, const int r, const int outputs)
+{
+    const double pixels = static_cast<double>(cols) * rows;
+    const double tiles = static_cast<double>((cols + 1) / 2) * ((rows + 1) / 2);
+    const double n = r + 1;
+
+    // Operations of the explicit 1D transforms of n values in filter_images_winograd.cl (additions, subtractions and multiplications with constants)
+    const double opsInput = r == 3 ? 4.0 : 19.0;
+    const double opsOutput = r == 3 ? 4.0 : 9.0;
+
+    // Input transform Bt * d * B (n columns and n rows), element-wise product and output transform At * m * A (n columns and 2 rows) per output
+    const double flopsInput = 2.0 * n * opsInput;
+    const double flopsOutput = n * n + (n + 2.0) * opsOutput;
+
+    KernelCost cost;
+    cost.bytesRead = tiles * n * n * sizeof(float) + storageOverhead(storage, pixels);
+    cost.bytesWritten = pixels * outputs * sizeof(float);
+    cost.flops = tiles * (flopsInput + outputs * flopsOutput);
+
+    return cost;
+}
+
+KernelCost CostModel::pointwise(const KernelRegistry::Storage storage, const size_t pixels, const int readsPerPixel, const int writesPerPixel, const double flopsPerPixel)
+{
+    KernelCost cost;
+    cost.bytesRead = static_cast<double>(pixels) * readsPerPixel * sizeof(float) + storageOverhead(storage, static_cast<double>(pixels));
+    cost.bytesWritten = static_cast<double>(pixels) * writesPerPixel * sizeof(float);
+    cost.flops = pixels * flopsPerPixel;
+
+    return cost;
+}
+
+void Roofline::measurePeaks(const cl::Context& context, const cl::Device& device, cl::CommandQueue& queue)
+{
+    // The peak kernels are embedded with the buffer kernels (kernels/filter_roofline.cl)
+    const size_t unit = KernelSources::findUnit(KernelRegistry::BUFFER, "roofline_copy");
+    cl::Program program(context, KernelSources::unitSource(KernelRegistry::BUFFER, unit));
+    program.build(std::vector<cl::Device>(1, device));
+
+    // Copy: large enough that the caches don't matter
+    cl_ulong maxAlloc = 0;
+    device.getInfo(CL_DEVICE_MAX_MEM_ALLOC_SIZE, &maxAlloc);
+    const size_t bytesCopy = static_cast<size_t>(std::min<cl_ulong>(64 * 1024 * 1024, maxAlloc / 2)) / (16 * 256) * (16 * 256);
+
+    cl::Buffer src(context, CL_MEM_READ_ONLY, bytesCopy);
+    cl::Buffer dst(context, CL_MEM_WRITE_ONLY, bytesCopy);
+    queue.enqueueFillBuffer(src, 0.0f, 0, bytesCopy);
+
+    cl::Kernel kernelCopy(program, "roofline_copy");
+    kernelCopy.setArg(0, src);
+    kernelCopy.setArg(1, dst);
+
+    double bestCopy = 0.0;
+    for (int i = 0; i < repetitionsPeaks; ++i)
+    {
+        cl::Event event;
+        queue.enqueueNDRangeKernel(kernelCopy, cl::NullRange, cl::NDRange(bytesCopy / 16), cl::NullRange, nullptr, &event);
+        bestCopy = std::max(bestCopy, 2.0 * bytesCopy / kernelSeconds(event));
+    }
+
+    // FMA: enough work-items to fill every compute unit
+    const size_t workItems = 1 << 20;
+    const int iterations = 256;
+    cl::Buffer result(context, CL_MEM_WRITE_ONLY, sizeof(float) * workItems);
+
+    cl::Kernel kernelFma(program, "roofline_fma");
+    kernelFma.setArg(0, result);
+    kernelFma.setArg(1, 0.999f);
+    kernelFma.setArg(2, 0.001f);
+    kernelFma.setArg(3, iterations);
+
+    double bestFma = 0.0;
+    for (int i = 0; i < repetitionsPeaks; ++i)
+    {
+        cl::Event event;
+        queue.enqueueNDRangeKernel(kernelFma, cl::NullRange, cl::NDRange(workItems), cl::NullRange, nullptr, &event);
+        bestFma = std::max(bestFma, 2.0 * fmaChains * iterations * workItems / kernelSeconds(event));
+    }
+
+    peaks.bandwidth = bestCopy;
+    peaks.flops = bestFma;
+}
+
+void Roofline::setLabel(const std::string& label)
+{
+    this->label = label;
+}
+
+void Roofline::record(const char* kernelName, const KernelCost& cost, const cl::Event& event)
+{
+    if (label.empty())
+    {
+        return;
+    }
+
+    pending.push_back({ label, kernelName, cost, event });
+}
+
+void Roofline::collect()
+{
+    for (const Launch& launch : pending)
+    {
+        if (totals.find(launch.label) == totals.end())
+        {
+            labels.push_back(launch.label);
+        }
+
+        const double seconds = kernelSeconds(launch.event);
+        for (Totals* t : { &totals[launch.label], &totalsKernels[launch.kernelName] })
+        {
+            t->launches++;
+            t->cost.bytesRead += launch.cost.bytesRead;
+            t->cost.bytesWritten += launch.cost.bytesWritten;
+            t->cost.flops += launch.cost.flops;
+            t->seconds += seconds;
+        }
+    }
+
+    pending.clear();
+}
+
+void Roofline::print(std::ostream& stream) const
+{
+    stream << "--- Roofline (peaks: " << std::fixed << std::setprecision(1) << peaks.bandwidth * 1e-9 << " GB/s, " << peaks.flops * 1e-9 << " GFLOP/s) ---" << std::endl;
+    stream << std::left << std::setw(40) << "label" << std::right
+           << std::setw(9) << "launches" << std::setw(11) << "time [ms]" << std::setw(10) << "GB/s" << std::setw(9) << "% peak"
+           << std::setw(10) << "GFLOP/s" << std::setw(9) << "% peak" << std::setw(11) << "FLOP/byte" << std::setw(10) << "% roof" << "  bound" << std::endl;
+
+    const double ridge = peaks.flops / peaks.bandwidth;
+    for (const std::string& l : labels)
+    {
+        const Totals& t = totals.at(l);
+        const double bytes = t.cost.bytesRead + t.cost.bytesWritten;
+        const double bandwidth = bytes / t.seconds;
+        const double flops = t.cost.flops / t.seconds;
+        const double intensity = t.cost.flops / bytes;
+
+        stream << std::left << std::setw(40) << l << std::right
+               << std::setw(9) << t.launches << std::setw(11) << std::setprecision(3) << t.seconds * 1e3
+               << std::setprecision(1) << std::setw(10) << bandwidth * 1e-9 << std::setw(9) << 100.0 * bandwidth / peaks.bandwidth
+               << std::setw(10) << flops * 1e-9 << std::setw(9) << 100.0 * flops / peaks.flops
+               << std::setprecision(2) << std::setw(11) << intensity << std::setprecision(1) << std::setw(10) << 100.0 * fractionOfRoof(t)
+               << "  " << (intensity < ridge ? "memory" : "compute") << std::endl;
+    }
+
+    stream << std::defaultfloat;
+}
+
+void Roofline::writeJson(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    ASSERT(file.is_open(), "Could not open " << filename);
+
+    JsonWriter json(file);
+    json.beginObject();
+
+    json.key("peaks").beginObject();
+    json.key("bandwidth").value(peaks.bandwidth);
+    json.key("flops").value(peaks.flops);
+    json.endObject();
+
+    json.key("labels").beginArray();
+    for (const std::string& l : labels)
+    {
+        json.beginObject();
+        json.key("label").value(l);
+        writeTotals(json, totals.at(l));
+        json.endObject();
+    }
+    json.endArray();
+
+    json.key("kernels").beginArray();
+    for (const auto& kernel : totalsKernels)
+    {
+        json.beginObject();
+        json.key("name").value(kernel.first);
+        writeTotals(json, kernel.second);
+        json.endObject();
+    }
+    json.endArray();
+
+    json.endObject();
+}
+
+double Roofline::fractionOfRoof(const Totals& totals) const
+{
+    const double bytes = totals.cost.bytesRead + totals.cost.bytesWritten;
+    if (totals.cost.flops <= 0.0)
+    {
+        // Pure data movement (e.g. copies) is only limited by the memory roof
+        return bytes / totals.seconds / peaks.bandwidth;
+    }
+
+    const double intensity = totals.cost.flops / bytes;
+    const double attainable = std::min(peaks.flops, intensity * peaks.bandwidth);
+
+    return totals.cost.flops / totals.seconds / attainable;
+}
+
+void Roofline::writeTotals(JsonWriter& json, const Totals& totals) const
+{
+    const double bytes = totals.cost.bytesRead + totals.cost.bytesWritten;
+    const double intensity = totals.cost.flops / bytes;
+
+    json.key("launches").value(totals.launches);
+    json.key("seconds").value(totals.seconds);
+    json.key("bytesRead").value(totals.cost.bytesRead);
+    json.key("bytesWritten").value(totals.cost.bytesWritten);
+    json.key("flops").value(totals.cost.flops);
+    json.key("bandwidth").value(bytes / totals.seconds);
+    json.key("flopRate").value(totals.cost.flops / totals.seconds);
+    json.key("intensity").value(intensity);
+    json.key("fractionOfRoof").value(fractionOfRoof(totals));
+    json.key("bound").value(intensity < peaks.flops / peaks.bandwidth ? "memory" : "compute");
+}
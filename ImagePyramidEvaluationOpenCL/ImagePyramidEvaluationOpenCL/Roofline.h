@@ -0,0 +1,135 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+#include "opencl_common.h"
+#include "KernelRegistry.h"
+
+class JsonWriter;
+
+/**
+ * @brief Analytic global memory traffic and arithmetic of one kernel launch
+ */
+struct KernelCost
+{
+    double bytesRead = 0.0;     //!< Requested global memory reads (image reads included), cache hits are not subtracted
+    double bytesWritten = 0.0;
+    double flops = 0.0;         //!< An FMA counts as 2 operations
+};
+
+/**
+ * @brief Cost models of the launchers, derived from the filter size, the work-group tile including the apron and the storage type
+ *
+ * Every model counts float pixels. For the buffer and image1D storage types, each output pixel additionally reads its lookup entry (the lookups of the
+ * filter taps hit the constant cache).
+ */
+namespace CostModel
+{
+    /**
+     * @brief Every work-item reads all taps from global memory and writes one value per output image
+     * @param depth number of images processed by the launch (levels of an octave for the cubes and the buffers)
+     */
+    KernelCost filter(const KernelRegistry::Storage storage, const size_t cols, const size_t rows, const size_t depth, const int taps, const int outputs = 1);
+
+    /**
+     * @brief Every work-group reads its tile including the apron once into local memory
+     */
+    KernelCost filterLocal(const KernelRegistry::Storage storage, const size_t cols, const size_t rows, const size_t depth, const int filterRows, const int filterCols,
+                           const int outputs, const size_t localCols, const size_t localRows);
+
+    /**
+     * @brief Every work-group reads its strip including the apron and the warm-up rows once
+     */
+    KernelCost filterSliding(const KernelRegistry::Storage storage, const size_t cols, const size_t rows, const size_t depth, const int filterRows, const int filterCols,
+                             const size_t stripWidth, const size_t chunkRows);
+
+    /**
+     * @brief Winograd F(2x2, rxr): every work-item reads an (r + 1)x(r + 1) input tile and writes 2x2 pixels per output image
+     *
+     * The transforms are counted with the operations of the explicit addition and subtraction sequences of the kernels (only r = 3 and r = 5 exist).
+     */
+    KernelCost filterWinograd(const KernelRegistry::Storage storage, const size_t cols, const size_t rows, const int r, const int outputs);
+
+    /**
+     * @brief Kernels which read a fixed number of pixels per output pixel (e.g. resizing or adding images)
+     */
+    KernelCost pointwise(const KernelRegistry::Storage storage, const size_t pixels, const int readsPerPixel, const int writesPerPixel, const double flopsPerPixel);
+}
+
+/**
+ * @brief Achieved bandwidth and arithmetic throughput of the launches compared with the measured peaks of the device (roofline model)
+ *
+ * The kernels record every launch together with its modelled costs when a roofline is attached to the OpenCL interface (which enables profiling in
+ * the queues). The launches are accumulated per label (e.g. method and sigma size) so that each method shows how close it gets to the memory or compute roof.
+ * The peaks are measured with a STREAM-like copy kernel and an FMA throughput kernel.
+ *
+ * Note that the requested bytes include cache hits; the kernels which read every tap from global memory can therefore exceed the bandwidth peak.
+ */
+class Roofline
+{
+public:
+    struct Peaks
+    {
+        double bandwidth = 0.0;    //!< Bytes per second
+        double flops = 0.0;        //!< Operations per second
+    };
+
+public:
+    /**
+     * @brief Measures the peaks of the device (the queue must have profiling enabled)
+     */
+    void measurePeaks(const cl::Context& context, const cl::Device& device, cl::CommandQueue& queue);
+
+    bool hasPeaks() const
+    {
+        return peaks.bandwidth > 0.0;
+    }
+
+    /**
+     * @brief Subsequent launches are accumulated under this label. Launches are ignored while the label is empty
+     */
+    void setLabel(const std::string& label);
+
+    void record(const char* kernelName, const KernelCost& cost, const cl::Event& event);
+
+    /**
+     * @brief Reads the profiling information of the recorded launches (waits until they are finished)
+     */
+    void collect();
+
+    void print(std::ostream& stream) const;
+    void writeJson(const std::string& filename) const;
+
+private:
+    struct Launch
+    {
+        std::string label;
+        std::string kernelName;
+        KernelCost cost;
+        cl::Event event;
+    };
+
+    struct Totals
+    {
+        size_t launches = 0;
+        KernelCost cost;
+        double seconds = 0.0;
+    };
+
+    /**
+     * @brief Fraction of the attainable performance (minimum of the compute roof and the memory roof at the arithmetic intensity of the launches)
+     */
+    double fractionOfRoof(const Totals& totals) const;
+
+    void writeTotals(JsonWriter& json, const Totals& totals) const;
+
+private:
+    Peaks peaks;
+    std::string label;
+    std::vector<Launch> pending;
+    std::vector<std::string> labels;    //!< Labels in the order of their first launch
+    std::map<std::string, Totals> totals;
+    std::map<std::string, Totals> totalsKernels;    //!< Same launches accumulated per kernel (all labels)
+};
@@ -0,0 +1,411 @@
+#include "ScalingStudy.h"
+#include "JsonWriter.h"
+#include "general.h"
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <map>
+
+ScalingStudy::ScalingStudy(const std::vector<cv::Size>& sizes, const int iterations, const int sigmaSize, const double cliffThreshold)
+    : sizes(sizes),
+      iterations(iterations),
+      sigmaSize(sigmaSize),
+      cliffThreshold(cliffThreshold)
+{}
+
+std::vector<cv::Size> ScalingStudy::defaultSizes()
+{
+    return {
+        cv::Size(256, 256), cv::Size(257, 257), cv::Size(384, 384), cv::Size(512, 512), cv::Size(640, 480), cv::Size(1000, 1000), cv::Size(1024, 1024),
+        cv::Size(1920, 1080), cv::Size(2048, 2048), cv::Size(2049, 1537), cv::Size(3000, 3000), cv::Size(3840, 2160), cv::Size(4096, 4096), cv::Size(6001, 6001),
+        cv::Size(8192, 8192), cv::Size(12288, 12288), cv::Size(16384, 16384)
+    };
+}
+
+cv::Mat ScalingStudy::syntheticImage(const cv::Size& size)
+{
+    // Deterministic noise so that every run filters the same images
+    cv::Mat img(size, CV_32FC1);
+    cv::RNG rng(static_cast<uint64_t>(size.width) * 65536 + size.height);
+    rng.fill(img, cv::RNG::UNIFORM, 0.0f, 1.0f);
+
+    return img;
+}
+
+void ScalingStudy::run(const std::vector<PyramidFactory>& factories, const std::vector<APyramid::Method>& methods)
+{
+    OpenCLInterface probe;
+    try
+    {
+        probe.selectDevice();
+        const cl::Device& device = probe.getDevice();
+        device.getInfo(CL_DEVICE_NAME, &limits.name);
+        device.getInfo(CL_DEVICE_GLOBAL_MEM_SIZE, &limits.globalMemory);
+        device.getInfo(CL_DEVICE_MAX_MEM_ALLOC_SIZE, &limits.maxAlloc);
+        device.getInfo(CL_DEVICE_GLOBAL_MEM_CACHE_SIZE, &limits.globalCache);
+        device.getInfo(CL_DEVICE_LOCAL_MEM_SIZE, &limits.localMemory);
+        device.getInfo(CL_DEVICE_IMAGE2D_MAX_WIDTH, &limits.image2DMaxWidth);
+        device.getInfo(CL_DEVICE_IMAGE2D_MAX_HEIGHT, &limits.image2DMaxHeight);
+        device.getInfo(CL_DEVICE_IMAGE_MAX_BUFFER_SIZE, &limits.imageMaxBufferSize);
+    }
+    catch (const cl::Error& error)
+    {
+        std::cout << "Scaling study skipped: " << error.what() << " (" << error.err() << ")" << std::endl;
+        return;
+    }
+
+    for (const cv::Size& size : sizes)
+    {
+        const cv::Mat img = syntheticImage(size);
+
+        for (const PyramidFactory& factory : factories)
+        {
+            std::unique_ptr<APyramid> pyramid = factory(img);
+
+            Result result;
+            result.pyramid = pyramid->name();
+            result.size = size;
+            result.skipped = exceededLimit(pyramid->getProgramCache().getStorage(), size, pyramid->getNumberOctaves(), pyramid->getLevelsPerOctave());
+
+            if (result.skipped.empty())
+            {
+                if (pyramid->init())
+                {
+                    pyramid->waitForKernels();
+                }
+                else
+                {
+                    result.skipped = "initialization failed";
+                }
+            }
+
+            for (APyramid::Method method : methods)
+            {
+                if (!pyramid->supports(method))
+                {
+                    continue;
+                }
+
+                result.method = method;
+                if (!result.skipped.empty())
+                {
+                    results.push_back(result);
+                    continue;
+                }
+
+                APyramid::Settings settings;
+                settings.method = method;
+                settings.sigmaSize = sigmaSize;
+                pyramid->setSettings(settings);
+
+                Result measured = result;
+                try
+                {
+                    // Warm-up (the first launches are slower due to lazy initializations in the driver)
+                    pyramid->startFilterTest();
+
+                    std::vector<double> times;
+                    for (int i = 0; i < iterations; ++i)
+                    {
+                        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+                        pyramid->startFilterTest();
+                        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+                        times.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() * 1e-9);
+                    }
+
+                    std::sort(times.begin(), times.end());
+                    measured.seconds = times[times.size() / 2];
+                    measured.megapixelsPerSecond = static_cast<double>(size.area()) / measured.seconds * 1e-6;
+                }
+                catch (const cl::Error& error)
+                {
+                    measured.skipped = std::string("error ") + error.what() + " (" + std::to_string(error.err()) + ")";
+                }
+                catch (const std::string& error)
+                {
+                    measured.skipped = error;
+                }
+
+                results.push_back(measured);
+            }
+
+            std::cout << "Scaling: " << size.width << "x" << size.height << " " << result.pyramid << (result.skipped.empty() ? "" : " skipped (" + result.skipped + ")") << std::endl;
+        }
+    }
+
+    analyse();
+}
+
+void ScalingStudy::print(std::ostream& stream) const
+{
+    stream << "--- Throughput versus resolution on " << limits.name << " (sigma size " << sigmaSize << ", megapixels per second) ---" << std::endl;
+    stream << std::left << std::setw(14) << "size" << std::setw(18) << "pyramid" << std::setw(30) << "method" << std::right << std::setw(12) << "MP/s" << std::endl;
+
+    for (const Result& result : results)
+    {
+        stream << std::left << std::setw(14) << std::to_string(result.size.width) + "x" + std::to_string(result.size.height) << std::setw(18) << result.pyramid
+               << std::setw(30) << APyramid::methodToString(result.method) << std::right;
+        if (result.skipped.empty())
+        {
+            stream << std::setw(12) << std::fixed << std::setprecision(1) << result.megapixelsPerSecond << std::defaultfloat << std::endl;
+        }
+        else
+        {
+            stream << "  skipped (" << result.skipped << ")" << std::endl;
+        }
+    }
+
+    stream << "--- Cliffs (throughput drop > " << 100.0 * cliffThreshold << "%) ---" << std::endl;
+    for (const Cliff& cliff : cliffs)
+    {
+        stream << cliff.pyramid << " " << APyramid::methodToString(cliff.method) << ": " << cliff.from.width << "x" << cliff.from.height << " -> " << cliff.to.width << "x"
+               << cliff.to.height << " loses " << std::fixed << std::setprecision(0) << 100.0 * cliff.drop << std::defaultfloat << "%"
+               << (cliff.crossed.empty() ? "" : ", crosses " + cliff.crossed) << std::endl;
+    }
+
+    stream << "--- Crossovers of the storage types ---" << std::endl;
+    for (const Crossover& crossover : crossovers)
+    {
+        stream << APyramid::methodToString(crossover.method) << ": from " << crossover.size.width << "x" << crossover.size.height << " " << crossover.fastest
+               << " overtakes " << crossover.previous << std::endl;
+    }
+}
+
+void ScalingStudy::writeJson(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    ASSERT(file.is_open(), "Could not open " << filename);
+
+    JsonWriter json(file);
+    json.beginObject();
+
+    json.key("device").beginObject();
+    json.key("name").value(limits.name);
+    json.key("globalMemory").value(limits.globalMemory);
+    json.key("maxMemAllocSize").value(limits.maxAlloc);
+    json.key("globalMemCache").value(limits.globalCache);
+    json.key("localMemory").value(limits.localMemory);
+    json.key("image2DMaxWidth").value(limits.image2DMaxWidth);
+    json.key("image2DMaxHeight").value(limits.image2DMaxHeight);
+    json.key("imageMaxBufferSize").value(limits.imageMaxBufferSize);
+    json.endObject();
+
+    json.key("sigmaSize").value(sigmaSize);
+    json.key("iterations").value(iterations);
+
+    json.key("results").beginArray();
+    for (const Result& result : results)
+    {
+        json.beginObject();
+        json.key("pyramid").value(result.pyramid);
+        json.key("method").value(APyramid::methodToString(result.method));
+        json.key("width").value(result.size.width);
+        json.key("height").value(result.size.height);
+        if (result.skipped.empty())
+        {
+            json.key("seconds").value(result.seconds);
+            json.key("megapixelsPerSecond").value(result.megapixelsPerSecond);
+        }
+        else
+        {
+            json.key("skipped").value(result.skipped);
+        }
+        json.endObject();
+    }
+    json.endArray();
+
+    json.key("cliffs").beginArray();
+    for (const Cliff& cliff : cliffs)
+    {
+        json.beginObject();
+        json.key("pyramid").value(cliff.pyramid);
+        json.key("method").value(APyramid::methodToString(cliff.method));
+        json.key("from").value(std::vector<int>{ cliff.from.width, cliff.from.height });
+        json.key("to").value(std::vector<int>{ cliff.to.width, cliff.to.height });
+        json.key("drop").value(cliff.drop);
+        json.key("crossed").value(cliff.crossed);
+        json.endObject();
+    }
+    json.endArray();
+
+    json.key("crossovers").beginArray();
+    for (const Crossover& crossover : crossovers)
+    {
+        json.beginObject();
+        json.key("method").value(APyramid::methodToString(crossover.method));
+        json.key("width").value(crossover.size.width);
+        json.key("height").value(crossover.size.height);
+        json.key("previous").value(crossover.previous);
+        json.key("fastest").value(crossover.fastest);
+        json.endObject();
+    }
+    json.endArray();
+
+    json.endObject();
+}
+
+std::string ScalingStudy::exceededLimit(const KernelRegistry::Storage storage, const cv::Size& size, const int numberOctaves, const int levelsPerOctave) const
+{
+    const size_t pixels = static_cast<size_t>(size.area());
+    size_t pixelsPyramid = 0;
+    for (int o = 0; o < numberOctaves; ++o)
+    {
+        pixelsPyramid += levelsPerOctave * static_cast<size_t>(size.width >> o) * static_cast<size_t>(size.height >> o);
+    }
+
+    // Images, Gx and Gy of the whole pyramid
+    if (3 * pixelsPyramid * sizeof(float) > limits.globalMemory)
+    {
+        return "globalMemory";
+    }
+
+    const bool image2D = storage == KernelRegistry::IMAGES || storage == KernelRegistry::CUBES;
+    if (image2D && (static_cast<size_t>(size.width) > limits.image2DMaxWidth || static_cast<size_t>(size.height) > limits.image2DMaxHeight))
+    {
+        return "image2DMaxSize";
+    }
+    if (storage == KernelRegistry::IMAGE1D && pixelsPyramid > limits.imageMaxBufferSize)
+    {
+        return "imageMaxBufferSize";
+    }
+
+    // Largest single allocation: one level, one octave or the whole pyramid
+    size_t largestAllocation = pixels;
+    if (storage == KernelRegistry::CUBES)
+    {
+        largestAllocation = levelsPerOctave * pixels;
+    }
+    else if (storage == KernelRegistry::BUFFER || storage == KernelRegistry::IMAGE1D)
+    {
+        largestAllocation = pixelsPyramid;
+    }
+
+    if (largestAllocation * sizeof(float) > limits.maxAlloc)
+    {
+        return "maxMemAllocSize";
+    }
+
+    return "";
+}
+
+std::vector<std::string> ScalingStudy::crossedLimits(const cv::Size& from, const cv::Size& to) const
+{
+    std::vector<std::string> crossed;
+
+    // Working set of the first level: input image, Gx and Gy
+    const double workingSetFrom = 3.0 * from.area() * sizeof(float);
+    const double workingSetTo = 3.0 * to.area() * sizeof(float);
+    if (workingSetFrom <= limits.globalCache && workingSetTo > limits.globalCache)
+    {
+        crossed.push_back("globalMemCache");
+    }
+
+    // One image row (relevant for line buffers and tiles spanning whole rows)
+    const double rowFrom = static_cast<double>(from.width) * sizeof(float);
+    const double rowTo = static_cast<double>(to.width) * sizeof(float);
+    if (rowFrom <= limits.localMemory && rowTo > limits.localMemory)
+    {
+        crossed.push_back("localMemory");
+    }
+
+    // Images close to the size limit are often stored in a slower layout
+    const double halfLimit = limits.image2DMaxWidth / 2.0;
+    if (from.width <= halfLimit && to.width > halfLimit)
+    {
+        crossed.push_back("image2DMaxWidth/2");
+    }
+
+    return crossed;
+}
+
+void ScalingStudy::analyse()
+{
+    cliffs.clear();
+    crossovers.clear();
+
+    auto byArea = [](const Result* a, const Result* b)
+    {
+        return a->size.area() < b->size.area();
+    };
+
+    // Cliffs per pyramid and method
+    std::map<std::pair<std::string, APyramid::Method>, std::vector<const Result*>> series;
+    for (const Result& result : results)
+    {
+        if (result.skipped.empty())
+        {
+            series[{ result.pyramid, result.method }].push_back(&result);
+        }
+    }
+
+    for (auto& s : series)
+    {
+        std::stable_sort(s.second.begin(), s.second.end(), byArea);
+
+        for (size_t i = 1; i < s.second.size(); ++i)
+        {
+            const Result& previous = *s.second[i - 1];
+            const Result& current = *s.second[i];
+            const double drop = 1.0 - current.megapixelsPerSecond / previous.megapixelsPerSecond;
+
+            if (drop > cliffThreshold)
+            {
+                Cliff cliff;
+                cliff.pyramid = current.pyramid;
+                cliff.method = current.method;
+                cliff.from = previous.size;
+                cliff.to = current.size;
+                cliff.drop = drop;
+
+                for (const std::string& limit : crossedLimits(previous.size, current.size))
+                {
+                    cliff.crossed += (cliff.crossed.empty() ? "" : ", ") + limit;
+                }
+
+                cliffs.push_back(cliff);
+            }
+        }
+    }
+
+    // Fastest storage type per method and size
+    std::map<APyramid::Method, std::vector<const Result*>> fastest;
+    for (const Result& result : results)
+    {
+        if (!result.skipped.empty())
+        {
+            continue;
+        }
+
+        std::vector<const Result*>& f = fastest[result.method];
+        auto it = std::find_if(f.begin(), f.end(), [&result](const Result* r) { return r->size == result.size; });
+        if (it == f.end())
+        {
+            f.push_back(&result);
+        }
+        else if (result.megapixelsPerSecond > (*it)->megapixelsPerSecond)
+        {
+            *it = &result;
+        }
+    }
+
+    for (auto& f : fastest)
+    {
+        std::stable_sort(f.second.begin(), f.second.end(), byArea);
+
+        for (size_t i = 1; i < f.second.size(); ++i)
+        {
+            if (f.second[i]->pyramid != f.second[i - 1]->pyramid)
+            {
+                Crossover crossover;
+                crossover.method = f.first;
+                crossover.size = f.second[i]->size;
+                crossover.previous = f.second[i - 1]->pyramid;
+                crossover.fastest = f.second[i]->pyramid;
+                crossovers.push_back(crossover);
+            }
+        }
+    }
+}
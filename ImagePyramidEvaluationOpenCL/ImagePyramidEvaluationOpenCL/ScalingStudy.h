@@ -0,0 +1,108 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <ostream>
+#include <opencv2/core.hpp>
+#include "APyramid.h"
+
+/**
+ * @brief Throughput of every pyramid type and method on synthetic images of increasing resolution
+ *
+ * The images are generated (deterministic noise) so that any size can be tested, including non-power-of-two and odd sizes. Sizes which exceed the memory
+ * or image size limits of a storage type are skipped and marked with the limit. Afterwards, the series are searched for
+ * - cliffs: the throughput of a method drops noticeably from one size to the next; the device limits which are crossed between both sizes are noted
+ *   (working set of one level versus the global memory cache, one image row versus the local memory, the image size limits)
+ * - crossovers: a different storage type becomes the fastest for a method
+ *
+ * The throughput is given in megapixels of the input image per second (all levels of the pyramid are processed).
+ */
+class ScalingStudy
+{
+public:
+    using PyramidFactory = std::function<std::unique_ptr<APyramid>(const cv::Mat&)>;
+
+    struct Result
+    {
+        std::string pyramid;
+        APyramid::Method method;
+        cv::Size size;
+        double seconds = 0.0;               //!< Median of the iterations
+        double megapixelsPerSecond = 0.0;
+        std::string skipped;                //!< Limit which prevented the test, empty if the test was run
+    };
+
+    struct Cliff
+    {
+        std::string pyramid;
+        APyramid::Method method;
+        cv::Size from;
+        cv::Size to;
+        double drop = 0.0;                  //!< Relative loss of throughput
+        std::string crossed;                //!< Device limits which are crossed between both sizes
+    };
+
+    struct Crossover
+    {
+        APyramid::Method method;
+        cv::Size size;
+        std::string previous;
+        std::string fastest;
+    };
+
+public:
+    /**
+     * @param cliffThreshold relative throughput loss between consecutive sizes which is reported as cliff
+     */
+    explicit ScalingStudy(const std::vector<cv::Size>& sizes = defaultSizes(), const int iterations = 5, const int sigmaSize = 2, const double cliffThreshold = 0.25);
+
+    /**
+     * @brief 256x256 up to 16384x16384 including odd sizes and common non-square formats
+     */
+    static std::vector<cv::Size> defaultSizes();
+
+    static cv::Mat syntheticImage(const cv::Size& size);
+
+    /**
+     * @brief Runs every supported method of every pyramid type on all sizes
+     */
+    void run(const std::vector<PyramidFactory>& factories, const std::vector<APyramid::Method>& methods);
+
+    void print(std::ostream& stream) const;
+    void writeJson(const std::string& filename) const;
+
+private:
+    struct DeviceLimits
+    {
+        std::string name;
+        cl_ulong globalMemory = 0;
+        cl_ulong maxAlloc = 0;
+        cl_ulong globalCache = 0;
+        cl_ulong localMemory = 0;
+        size_t image2DMaxWidth = 0;
+        size_t image2DMaxHeight = 0;
+        size_t imageMaxBufferSize = 0;
+    };
+
+    /**
+     * @return the limit which prevents the pyramid from being created on the device or an empty string if it fits
+     */
+    std::string exceededLimit(const KernelRegistry::Storage storage, const cv::Size& size, const int numberOctaves, const int levelsPerOctave) const;
+
+    std::vector<std::string> crossedLimits(const cv::Size& from, const cv::Size& to) const;
+
+    void analyse();
+
+private:
+    const std::vector<cv::Size> sizes;
+    const int iterations;
+    const int sigmaSize;
+    const double cliffThreshold;
+
+    DeviceLimits limits;
+    std::vector<Result> results;
+    std::vector<Cliff> cliffs;
+    std::vector<Crossover> crossovers;
+};
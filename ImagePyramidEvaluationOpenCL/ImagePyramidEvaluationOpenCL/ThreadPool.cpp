@@ -0,0 +1,134 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(size_t numberThreads)
+    : remaining(0)
+{
+    if (numberThreads == 0)
+    {
+        numberThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (size_t i = 0; i < numberThreads; ++i)
+    {
+        queues.push_back(std::unique_ptr<Queue>(new Queue()));
+    }
+
+    for (size_t i = 0; i < numberThreads - 1; ++i)
+    {
+        threads.emplace_back(&ThreadPool::work, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    wake.notify_all();
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void ThreadPool::parallelFor(const size_t n, const std::function<void(size_t)>& task)
+{
+    if (n == 0)
+    {
+        return;
+    }
+
+    this->task = &task;
+    remaining = n;
+
+    // Contiguous blocks per queue
+    const size_t blockSize = (n + queues.size() - 1) / queues.size();
+    for (size_t q = 0; q < queues.size(); ++q)
+    {
+        std::lock_guard<std::mutex> lock(queues[q]->mutex);
+        for (size_t i = q * blockSize; i < std::min(n, (q + 1) * blockSize); ++i)
+        {
+            queues[q]->indices.push_back(i);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+    }
+    wake.notify_all();
+
+    while (runOne(queues.size() - 1))
+    {}
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]() { return remaining == 0; });
+}
+
+void ThreadPool::work(const size_t id)
+{
+    size_t seen = 0;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        wake.wait(lock, [this, seen]() { return stop || generation != seen; });
+        if (stop)
+        {
+            return;
+        }
+        seen = generation;
+
+        lock.unlock();
+        while (runOne(id))
+        {}
+        lock.lock();
+    }
+}
+
+bool ThreadPool::runOne(const size_t id)
+{
+    size_t index = 0;
+    bool found = false;
+
+    // Own queue from the front, the other queues from the back
+    for (size_t i = 0; i < queues.size() && !found; ++i)
+    {
+        Queue& queue = *queues[(id + i) % queues.size()];
+
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.indices.empty())
+        {
+            if (i == 0)
+            {
+                index = queue.indices.front();
+                queue.indices.pop_front();
+            }
+            else
+            {
+                index = queue.indices.back();
+                queue.indices.pop_back();
+            }
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        return false;
+    }
+
+    // The task is set before the indices are queued, so it is valid for every index which is found
+    (*task)(index);
+
+    if (--remaining == 0)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished.notify_all();
+    }
+
+    return true;
+}
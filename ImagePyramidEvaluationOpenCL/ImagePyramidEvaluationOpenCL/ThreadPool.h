@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+/**
+ * @brief Fixed set of worker threads which execute the tasks of one parallel loop at a time with work stealing
+ *
+ * The indices of a loop are distributed in contiguous blocks to one queue per thread (the calling thread works on its own queue as well). Every thread
+ * processes its block in order, which keeps neighbouring tiles on the same core, and steals from the end of the other queues when its own queue is empty.
+ * Hence, the load is balanced even if the tiles have different costs (e.g. the border tiles or the small images of the higher octaves).
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @param numberThreads total number of threads including the calling thread (0 = number of hardware threads)
+     */
+    explicit ThreadPool(size_t numberThreads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Calls task(i) for every i in [0, n) and returns when all calls are finished (must not be called from inside a task)
+     */
+    void parallelFor(const size_t n, const std::function<void(size_t)>& task);
+
+    size_t size() const
+    {
+        return queues.size();
+    }
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<size_t> indices;
+    };
+
+    void work(const size_t id);
+
+    /**
+     * @return false if there was no index left in any queue
+     */
+    bool runOne(const size_t id);
+
+private:
+    std::vector<std::unique_ptr<Queue>> queues;     //!< Last queue belongs to the calling thread
+    std::vector<std::thread> threads;
+
+    const std::function<void(size_t)>* task = nullptr;
+    std::atomic<size_t> remaining;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    size_t generation = 0;      //!< Incremented for every loop so that the workers know when new indices are available
+    bool stop = false;
+};
@@ -0,0 +1,195 @@
+#include "Tracer.h"
+#include "JsonWriter.h"
+#include "general.h"
+#include <fstream>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+Tracer::Tracer(const size_t maxLaunches)
+    : maxLaunches(maxLaunches)
+{}
+
+void Tracer::init(const cl::CommandQueue& queue, const cl::CommandQueue& queue2)
+{
+    this->queue = queue();
+    this->queue2 = queue2();
+
+    // The queued timestamp of a marker is taken by the runtime while the host enqueues it
+    queue.finish();
+    cl::Event marker;
+    const cl_ulong hostBefore = hostNow();
+    queue.enqueueMarkerWithWaitList(nullptr, &marker);
+    const cl_ulong hostAfter = hostNow();
+    marker.wait();
+
+    const cl_ulong queued = marker.getProfilingInfo<CL_PROFILING_COMMAND_QUEUED>();
+    deviceOffset = static_cast<long long>(queued) - static_cast<long long>(hostBefore + (hostAfter - hostBefore) / 2);
+}
+
+void Tracer::setLabel(const std::string& label)
+{
+    this->label = label;
+}
+
+void Tracer::record(const char* kernelName, const size_t cols, const cl::Event& event)
+{
+    if (label.empty() || recorded >= maxLaunches)
+    {
+        return;
+    }
+
+    pending.push_back({ label, kernelName, cols, event, hostNow() });
+    recorded++;
+}
+
+void Tracer::collect()
+{
+    for (const Pending& p : pending)
+    {
+        p.event.wait();
+
+        Launch launch;
+        launch.label = p.label;
+        launch.kernelName = p.kernelName;
+        launch.cols = p.cols;
+        launch.hostReturned = static_cast<cl_ulong>(std::max<long long>(static_cast<long long>(p.hostReturned) + deviceOffset, 0));
+        launch.queued = p.event.getProfilingInfo<CL_PROFILING_COMMAND_QUEUED>();
+        launch.submit = p.event.getProfilingInfo<CL_PROFILING_COMMAND_SUBMIT>();
+        launch.start = p.event.getProfilingInfo<CL_PROFILING_COMMAND_START>();
+        launch.end = p.event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+
+        const cl::CommandQueue eventQueue = p.event.getInfo<CL_EVENT_COMMAND_QUEUE>();
+        if (eventQueue() == queue)
+        {
+            launch.lane = QUEUE;
+        }
+        else if (eventQueue() == queue2)
+        {
+            launch.lane = QUEUE2;
+        }
+        else
+        {
+            launch.lane = QUEUE_OTHER;
+        }
+
+        launches.push_back(launch);
+    }
+
+    pending.clear();
+}
+
+void Tracer::writeJson(const std::string& filename) const
+{
+    ASSERT(pending.empty(), "collect() must be called before the trace is written");
+
+    std::ofstream file(filename);
+    ASSERT(file.is_open(), "Could not open " << filename);
+
+    // Timestamps in the trace are microseconds relative to the first command
+    cl_ulong origin = std::numeric_limits<cl_ulong>::max();
+    size_t maxCols = 1;
+    for (const Launch& launch : launches)
+    {
+        origin = std::min(origin, launch.queued);
+        maxCols = std::max(maxCols, launch.cols);
+    }
+    auto timestamp = [origin](const cl_ulong time)
+    {
+        return time > origin ? (time - origin) * 1e-3 : 0.0;
+    };
+
+    JsonWriter json(file);
+    json.beginObject();
+    json.key("displayTimeUnit").value("ns");
+    json.key("traceEvents").beginArray();
+
+    const std::vector<std::pair<int, const char*>> lanes = { { HOST, "host enqueue" }, { QUEUE, "queue" }, { QUEUE2, "queue2" }, { QUEUE_OTHER, "other queues" }, { TESTS, "tests" } };
+    for (const auto& lane : lanes)
+    {
+        json.beginObject();
+        json.key("name").value("thread_name");
+        json.key("ph").value("M");
+        json.key("pid").value(1);
+        json.key("tid").value(lane.first);
+        json.key("args").beginObject().key("name").value(lane.second).endObject();
+        json.endObject();
+
+        json.beginObject();
+        json.key("name").value("thread_sort_index");
+        json.key("ph").value("M");
+        json.key("pid").value(1);
+        json.key("tid").value(lane.first);
+        json.key("args").beginObject().key("sort_index").value(lane.first).endObject();
+        json.endObject();
+    }
+
+    // Starts a complete event, the caller adds optional arguments and closes the object
+    auto slice = [&](const std::string& name, const char* category, const int lane, const cl_ulong begin, const cl_ulong end)
+    {
+        json.beginObject();
+        json.key("name").value(name);
+        json.key("cat").value(category);
+        json.key("ph").value("X");
+        json.key("pid").value(1);
+        json.key("tid").value(lane);
+        json.key("ts").value(timestamp(begin));
+        json.key("dur").value(end > begin ? (end - begin) * 1e-3 : 0.0);
+    };
+
+    std::array<cl_ulong, TESTS + 1> laneEnd = {};     // End of the previous command in every lane (0 if there is none)
+    for (size_t i = 0; i < launches.size(); ++i)
+    {
+        const Launch& launch = launches[i];
+        const int octave = static_cast<int>(std::lround(std::log2(static_cast<double>(maxCols) / std::max<size_t>(launch.cols, 1))));
+
+        // Host lane: from queuing the command until the enqueue call returned
+        slice(launch.kernelName, "enqueue", HOST, launch.queued, launch.hostReturned);
+        json.endObject();
+
+        slice(launch.kernelName, "kernel", launch.lane, launch.start, launch.end);
+        json.key("args").beginObject();
+        json.key("test").value(launch.label);
+        json.key("octave").value(octave);
+        json.key("cols").value(launch.cols);
+        json.key("queuedUs").value(timestamp(launch.queued));
+        json.key("submitUs").value(timestamp(launch.submit));
+        json.key("startUs").value(timestamp(launch.start));
+        json.key("endUs").value(timestamp(launch.end));
+        json.key("queuedToStartUs").value(launch.start > launch.queued ? (launch.start - launch.queued) * 1e-3 : 0.0);
+        if (laneEnd[launch.lane] > 0)
+        {
+            json.key("idleBeforeUs").value(launch.start > laneEnd[launch.lane] ? (launch.start - laneEnd[launch.lane]) * 1e-3 : 0.0);
+        }
+        laneEnd[launch.lane] = launch.end;
+        json.endObject();
+        json.endObject();
+    }
+
+    // Test lane: one span per consecutive block of launches with the same label
+    for (size_t first = 0; first < launches.size();)
+    {
+        size_t last = first;
+        cl_ulong end = launches[first].end;
+        while (last + 1 < launches.size() && launches[last + 1].label == launches[first].label)
+        {
+            last++;
+            end = std::max(end, launches[last].end);
+        }
+
+        slice(launches[first].label, "test", TESTS, launches[first].queued, end);
+        json.key("args").beginObject().key("launches").value(last - first + 1).endObject();
+        json.endObject();
+
+        first = last + 1;
+    }
+
+    json.endArray();
+    json.endObject();
+}
+
+cl_ulong Tracer::hostNow() const
+{
+    return static_cast<cl_ulong>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
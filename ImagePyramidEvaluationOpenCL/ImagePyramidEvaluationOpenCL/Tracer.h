@@ -0,0 +1,93 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include "opencl_common.h"
+
+/**
+ * @brief Timeline of all kernel launches exported in the Chrome trace event format (viewable in chrome://tracing or Perfetto)
+ *
+ * Every launch and every image transfer is recorded with its queued/submit/start/end profiling timestamps when a tracer is attached to the OpenCL
+ * interface (which enables profiling in the queues). The trace contains one lane per command queue showing the execution on the device, a lane with the
+ * host enqueue time (from queuing the command until the enqueue call returned) and a lane with the span of each test. Idle gaps before every command are
+ * measured against the previous command of the same lane, also across tests.
+ *
+ * The host timestamps are mapped to the device clock with an offset which is measured once with a marker command, the host lane is therefore only
+ * accurate to a few microseconds.
+ */
+class Tracer
+{
+public:
+    /**
+     * @param maxLaunches launches after this limit are ignored so that long benchmark runs don't produce unmanageable traces
+     */
+    explicit Tracer(const size_t maxLaunches = 200000);
+
+    /**
+     * @brief Measures the offset between the host and the device clock and stores the queues which are assigned to their own lanes
+     * (the queues must have profiling enabled)
+     */
+    void init(const cl::CommandQueue& queue, const cl::CommandQueue& queue2);
+
+    /**
+     * @brief Subsequent launches are assigned to this label (shown in the test lane). Launches are ignored while the label is empty
+     */
+    void setLabel(const std::string& label);
+
+    /**
+     * @param cols width of the input image of the launch, the octave is derived from it
+     */
+    void record(const char* kernelName, const size_t cols, const cl::Event& event);
+
+    /**
+     * @brief Reads the profiling information of the recorded launches (waits until they are finished)
+     */
+    void collect();
+
+    void writeJson(const std::string& filename) const;
+
+private:
+    struct Pending
+    {
+        std::string label;
+        std::string kernelName;
+        size_t cols;
+        cl::Event event;
+        cl_ulong hostReturned;      //!< Host time when the enqueue call returned (host clock)
+    };
+
+    struct Launch
+    {
+        std::string label;
+        std::string kernelName;
+        size_t cols;
+        int lane;
+        cl_ulong hostReturned;      //!< Host time when the enqueue call returned (device clock)
+        cl_ulong queued;
+        cl_ulong submit;
+        cl_ulong start;
+        cl_ulong end;
+    };
+
+    enum Lane
+    {
+        HOST = 1,
+        QUEUE = 2,
+        QUEUE2 = 3,
+        QUEUE_OTHER = 4,
+        TESTS = 5
+    };
+
+    cl_ulong hostNow() const;
+
+private:
+    const size_t maxLaunches;
+    cl_command_queue queue = nullptr;
+    cl_command_queue queue2 = nullptr;
+    long long deviceOffset = 0;     //!< Added to the host time (in ns) to get the device time (measured again for every OpenCL interface)
+    size_t recorded = 0;
+    std::string label;
+    std::vector<Pending> pending;
+    std::vector<Launch> launches;
+};
@@ -49,8 +49,21 @@ int3 borderCoordinate(int3 coord, int rows, int cols, int border)
     return coordAdjusted;
 }
 
+// Memory access of the bandwidth probes (filter_probes.cl)
+#define PROBE_SRC_TYPE global const float*
+#define PROBE_DST_TYPE global float*
+#define PROBE_READ(x, y, z) src[((z) * rows + (y)) * cols + (x)]
+#define PROBE_WRITE(x, y, z, v) dst[((z) * rows + (y)) * cols + (x)] = (v)
+
 #include "filter_buffer_normal.cl"
 #include "filter_buffer_local.cl"
+#include "filter_buffer_dilated.cl"
+#include "filter_buffer_sliding.cl"
+#include "filter_buffer_transposed.cl"
+#include "filter_buffer_persistent.cl"
+#include "filter_probes.cl"
+#include "filter_overhead.cl"
+#include "filter_roofline.cl"
 
 /**
  * @see https://github.com/opencv/opencv/blob/master/modules/imgproc/src/opencl/resize.cl
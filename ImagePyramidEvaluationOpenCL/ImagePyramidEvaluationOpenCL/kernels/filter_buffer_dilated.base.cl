@@ -0,0 +1,99 @@
+/**
+ * Calculates the filter sum of a dilated 3x3 filter at a specified pixel position. Supposed to be called from other kernels.
+ * 
+ * The filter has only non-zero values at the rows 0, dilationRows and 2 * dilationRows and the cols 0, dilationCols and 2 * dilationCols (e.g. the derivative
+ * filters and their separation vectors for sigmaSize > 1). For vectors, the dilation of the direction of size 1 is 0. Only these (at most) 9 taps are
+ * considered and zero taps are skipped completely. The branches are uniform since every work-item uses the same filter.
+ * 
+ * Additional parameters compared to the base function (filter_MULTIPLICITY_dilated):
+ * @param coordBase pixel position to calculate the filter sum from
+ * @return calculated filter sum
+ */
+/* GENERATE_TYPE */ filter_sum_MULTIPLICITY_dilated(global float* imgIn,
+                            constant struct Lookup* locationLookup,
+                            constant float* filterKernel/* GENERATE_DOUBLE:1,
+                            constant float* filterKernel2*/,
+                            const int filterCols,
+                            const int dilationRows,
+                            const int dilationCols,
+                            const int3 coordBase,
+                            const int border)
+{
+    /* GENERATE_TYPE */ sum = (/* GENERATE_TYPE */)(0.0f/* GENERATE_DOUBLE:, 0.0f*/);
+    const int rows = locationLookup[coordBase.z].imgHeight;
+    const int cols = locationLookup[coordBase.z].imgWidth;
+    int3 coordCurrent;
+    int3 coordBorder;
+    float color;
+
+    coordCurrent.z = coordBase.z;
+    #pragma unroll
+    for (int y = -1; y <= 1; ++y)
+    {
+        // Row vectors only have the centre row
+        if (dilationRows == 0 && y != 0)
+        {
+            continue;
+        }
+
+        coordCurrent.y = coordBase.y + y * dilationRows;
+        #pragma unroll
+        for (int x = -1; x <= 1; ++x)
+        {
+            // Column vectors only have the centre col
+            if (dilationCols == 0 && x != 0)
+            {
+                continue;
+            }
+
+            // Position of the tap in the complete filter
+            const int idx = (y + 1) * dilationRows * filterCols + (x + 1) * dilationCols;
+            const float value = filterKernel/* GENERATE_DOUBLE:1*/[idx];
+            /* GENERATE_DOUBLE:const float value2 = filterKernel2[idx];*/
+            if (value == 0.0f/* GENERATE_DOUBLE: && value2 == 0.0f*/)
+            {
+                continue;
+            }
+
+            coordCurrent.x = coordBase.x + x * dilationCols;
+            coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
+            color = readValue(imgIn, locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);
+
+            sum/* GENERATE_DOUBLE:.x*/ += color * value;
+            /* GENERATE_DOUBLE:sum.y += color * value2;*/
+        }
+    }
+
+    return sum;
+}
+
+/**
+ * Filter kernel for a dilated 3x3 (or 1x3 and 3x1) MULTIPLICITY filter supposed to be called from the host.
+ * 
+ * @param imgIn input image
+ * @param locationLookup lookup table to access the pixels in the scale space
+ * @param imgOut image containing the filter response
+ * @param filterKernel 1D array with the values of the complete filter. The filter is centred on the current pixel and the size of the filter must be (2 * dilationRows + 1) x (2 * dilationCols + 1)
+ * @param filterCols cols of the filter
+ * @param dilationRows distance between the non-zero taps in y-direction, i.e. dilationRows = floor(filterRows / 2) (0 for row vectors)
+ * @param dilationCols distance between the non-zero taps in x-direction, i.e. dilationCols = floor(filterCols / 2) (0 for column vectors)
+ * @param border int value which specifies how out-of-border accesses should be handled. The values correspond to the OpenCV border types
+ */
+kernel void filter_MULTIPLICITY_dilated(global float* imgIn,
+                              constant struct Lookup* locationLookup,
+                              global float* imgOut/* GENERATE_DOUBLE:1,
+                              global float* imgOut2*/,
+                              constant float* filterKernel/* GENERATE_DOUBLE:1,
+                              constant float* filterKernel2*/,
+                              const int filterCols,
+                              const int dilationRows,
+                              const int dilationCols,
+                              const int border)
+{
+    int3 coordBase = (int3)(get_global_id(0), get_global_id(1), get_global_id(2));
+
+    /* GENERATE_TYPE */ sum = filter_sum_MULTIPLICITY_dilated(imgIn, locationLookup, filterKernel/* GENERATE_DOUBLE:1, filterKernel2*/, filterCols, dilationRows, dilationCols, coordBase, border);
+
+    writeValue(imgOut/* GENERATE_DOUBLE:1*/, locationLookup, coordBase.z, coordBase.x, coordBase.y, sum/* GENERATE_DOUBLE:.x*/);
+    /* GENERATE_DOUBLE:writeValue(imgOut2, locationLookup, coordBase.z, coordBase.x, coordBase.y, sum.y);*/
+}
@@ -20,7 +20,7 @@
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_NxN * LOCAL_SIZE_ROWS_NxN];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_NxN * LOCAL_SIZE_ROWS_NxN];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -32,46 +32,79 @@
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_NxN >= 9 || ROWS_NxN >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_NxN; y += yLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_NxN;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_NxN;
+    if (xBase - COLS_HALF_NxN >= 0 && xBase - COLS_HALF_NxN + patchCols <= cols)
     {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_NxN; x += xLocalSize)
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_NxN + xBase, y - ROWS_HALF_NxN + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_NxN + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_NxN + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_NxN >= 9 || ROWS_NxN >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_NxN; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_NxN; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_NxN + xBase, y - ROWS_HALF_NxN + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_NxN + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_NxN * LOCAL_SIZE_ROWS_NxN); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_NxN;
-        int y = idx1D / LOCAL_SIZE_COLS_NxN;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_NxN + xBase, y - ROWS_HALF_NxN + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_NxN + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_NxN * LOCAL_SIZE_ROWS_NxN); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_NxN;
+            int y = idx1D / LOCAL_SIZE_COLS_NxN;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_NxN + xBase, y - ROWS_HALF_NxN + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_NxN + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -93,7 +126,7 @@
         for (int x = -COLS_HALF_NxN; x <= COLS_HALF_NxN; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_NxN + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_NxN + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_NxN) * COLS_NxN + x + COLS_HALF_NxN;
             sum/* GENERATE_DOUBLE:.x*/ += color * filterKernel/* GENERATE_DOUBLE:1*/[idx];
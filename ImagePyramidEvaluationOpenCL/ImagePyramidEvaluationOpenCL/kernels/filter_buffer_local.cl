@@ -21,7 +21,7 @@ type_single filter_sum_single_local(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -33,46 +33,79 @@ type_single filter_sum_single_local(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if filterCols >= 9 || filterRows >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * filterRowsHalf; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * filterColsHalf; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * filterColsHalf;
+    const int patchRows = yLocalSize + 2 * filterRowsHalf;
+    if (xBase - filterColsHalf >= 0 && xBase - filterColsHalf + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_21x21 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if filterCols >= 9 || filterRows >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * filterRowsHalf; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * filterColsHalf; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_21x21 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_21x21;
-        int y = idx1D / LOCAL_SIZE_COLS_21x21;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_21x21;
+            int y = idx1D / LOCAL_SIZE_COLS_21x21;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_21x21 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -93,7 +126,7 @@ type_single filter_sum_single_local(global float* imgIn,
         for (int x = -filterColsHalf; x <= filterColsHalf; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_21x21 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_21x21 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + filterRowsHalf) * filterCols + x + filterColsHalf;
             sum += color * filterKernel[idx];
@@ -149,7 +182,7 @@ type_single filter_sum_single_local_3x3(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -161,46 +194,79 @@ type_single filter_sum_single_local_3x3(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_3x3 >= 9 || ROWS_3x3 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_3x3; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_3x3; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_3x3;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_3x3;
+    if (xBase - COLS_HALF_3x3 >= 0 && xBase - COLS_HALF_3x3 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_3x3 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_3x3 >= 9 || ROWS_3x3 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_3x3; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_3x3; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_3x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_3x3;
-        int y = idx1D / LOCAL_SIZE_COLS_3x3;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_3x3;
+            int y = idx1D / LOCAL_SIZE_COLS_3x3;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_3x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -221,7 +287,7 @@ type_single filter_sum_single_local_3x3(global float* imgIn,
         for (int x = -COLS_HALF_3x3; x <= COLS_HALF_3x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x3) * COLS_3x3 + x + COLS_HALF_3x3;
             sum += color * filterKernel[idx];
@@ -270,7 +336,7 @@ type_single filter_sum_single_local_5x5(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -282,46 +348,79 @@ type_single filter_sum_single_local_5x5(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_5x5 >= 9 || ROWS_5x5 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_5x5; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_5x5; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_5x5;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_5x5;
+    if (xBase - COLS_HALF_5x5 >= 0 && xBase - COLS_HALF_5x5 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_5x5 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_5x5 >= 9 || ROWS_5x5 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_5x5; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_5x5; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_5x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_5x5;
-        int y = idx1D / LOCAL_SIZE_COLS_5x5;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_5x5;
+            int y = idx1D / LOCAL_SIZE_COLS_5x5;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -342,7 +441,7 @@ type_single filter_sum_single_local_5x5(global float* imgIn,
         for (int x = -COLS_HALF_5x5; x <= COLS_HALF_5x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x5) * COLS_5x5 + x + COLS_HALF_5x5;
             sum += color * filterKernel[idx];
@@ -391,7 +490,7 @@ type_single filter_sum_single_local_7x7(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -403,46 +502,79 @@ type_single filter_sum_single_local_7x7(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_7x7 >= 9 || ROWS_7x7 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_7x7; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_7x7; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_7x7;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_7x7;
+    if (xBase - COLS_HALF_7x7 >= 0 && xBase - COLS_HALF_7x7 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_7x7 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_7x7 >= 9 || ROWS_7x7 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_7x7; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_7x7; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_7x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_7x7;
-        int y = idx1D / LOCAL_SIZE_COLS_7x7;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_7x7;
+            int y = idx1D / LOCAL_SIZE_COLS_7x7;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -463,7 +595,7 @@ type_single filter_sum_single_local_7x7(global float* imgIn,
         for (int x = -COLS_HALF_7x7; x <= COLS_HALF_7x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x7) * COLS_7x7 + x + COLS_HALF_7x7;
             sum += color * filterKernel[idx];
@@ -512,7 +644,7 @@ type_single filter_sum_single_local_9x9(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -524,46 +656,79 @@ type_single filter_sum_single_local_9x9(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_9x9 >= 9 || ROWS_9x9 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_9x9; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_9x9; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_9x9;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_9x9;
+    if (xBase - COLS_HALF_9x9 >= 0 && xBase - COLS_HALF_9x9 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_9x9 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_9x9 >= 9 || ROWS_9x9 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_9x9; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_9x9; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_9x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_9x9;
-        int y = idx1D / LOCAL_SIZE_COLS_9x9;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_9x9;
+            int y = idx1D / LOCAL_SIZE_COLS_9x9;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -584,7 +749,7 @@ type_single filter_sum_single_local_9x9(global float* imgIn,
         for (int x = -COLS_HALF_9x9; x <= COLS_HALF_9x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x9) * COLS_9x9 + x + COLS_HALF_9x9;
             sum += color * filterKernel[idx];
@@ -634,7 +799,7 @@ type_single filter_sum_single_local_1x3(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -646,46 +811,79 @@ type_single filter_sum_single_local_1x3(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_1x3 >= 9 || ROWS_1x3 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x3; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x3; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_1x3;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_1x3;
+    if (xBase - COLS_HALF_1x3 >= 0 && xBase - COLS_HALF_1x3 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_1x3 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_1x3 >= 9 || ROWS_1x3 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x3; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x3; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_1x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x3 * LOCAL_SIZE_ROWS_1x3); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_1x3;
-        int y = idx1D / LOCAL_SIZE_COLS_1x3;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x3 * LOCAL_SIZE_ROWS_1x3); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_1x3;
+            int y = idx1D / LOCAL_SIZE_COLS_1x3;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_1x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -706,7 +904,7 @@ type_single filter_sum_single_local_1x3(global float* imgIn,
         for (int x = -COLS_HALF_1x3; x <= COLS_HALF_1x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x3) * COLS_1x3 + x + COLS_HALF_1x3;
             sum += color * filterKernel[idx];
@@ -758,7 +956,7 @@ type_single filter_sum_single_local_1x5(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -770,46 +968,79 @@ type_single filter_sum_single_local_1x5(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_1x5 >= 9 || ROWS_1x5 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x5; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x5; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_1x5;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_1x5;
+    if (xBase - COLS_HALF_1x5 >= 0 && xBase - COLS_HALF_1x5 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_1x5 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_1x5 >= 9 || ROWS_1x5 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x5; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x5; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_1x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x5 * LOCAL_SIZE_ROWS_1x5); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_1x5;
-        int y = idx1D / LOCAL_SIZE_COLS_1x5;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x5 * LOCAL_SIZE_ROWS_1x5); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_1x5;
+            int y = idx1D / LOCAL_SIZE_COLS_1x5;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_1x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -830,7 +1061,7 @@ type_single filter_sum_single_local_1x5(global float* imgIn,
         for (int x = -COLS_HALF_1x5; x <= COLS_HALF_1x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x5) * COLS_1x5 + x + COLS_HALF_1x5;
             sum += color * filterKernel[idx];
@@ -882,7 +1113,7 @@ type_single filter_sum_single_local_1x7(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -894,46 +1125,79 @@ type_single filter_sum_single_local_1x7(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_1x7 >= 9 || ROWS_1x7 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x7; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x7; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_1x7;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_1x7;
+    if (xBase - COLS_HALF_1x7 >= 0 && xBase - COLS_HALF_1x7 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_1x7 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_1x7 >= 9 || ROWS_1x7 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x7; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x7; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_1x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x7 * LOCAL_SIZE_ROWS_1x7); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_1x7;
-        int y = idx1D / LOCAL_SIZE_COLS_1x7;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x7 * LOCAL_SIZE_ROWS_1x7); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_1x7;
+            int y = idx1D / LOCAL_SIZE_COLS_1x7;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_1x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -954,7 +1218,7 @@ type_single filter_sum_single_local_1x7(global float* imgIn,
         for (int x = -COLS_HALF_1x7; x <= COLS_HALF_1x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x7) * COLS_1x7 + x + COLS_HALF_1x7;
             sum += color * filterKernel[idx];
@@ -1006,7 +1270,7 @@ type_single filter_sum_single_local_1x9(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1018,46 +1282,79 @@ type_single filter_sum_single_local_1x9(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_1x9 >= 9 || ROWS_1x9 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x9; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x9; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_1x9;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_1x9;
+    if (xBase - COLS_HALF_1x9 >= 0 && xBase - COLS_HALF_1x9 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_1x9 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_1x9 >= 9 || ROWS_1x9 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x9; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x9; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_1x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x9 * LOCAL_SIZE_ROWS_1x9); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_1x9;
-        int y = idx1D / LOCAL_SIZE_COLS_1x9;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x9 * LOCAL_SIZE_ROWS_1x9); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_1x9;
+            int y = idx1D / LOCAL_SIZE_COLS_1x9;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_1x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -1078,7 +1375,7 @@ type_single filter_sum_single_local_1x9(global float* imgIn,
         for (int x = -COLS_HALF_1x9; x <= COLS_HALF_1x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x9) * COLS_1x9 + x + COLS_HALF_1x9;
             sum += color * filterKernel[idx];
@@ -1130,7 +1427,7 @@ type_single filter_sum_single_local_3x1(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1142,46 +1439,79 @@ type_single filter_sum_single_local_3x1(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_3x1 >= 9 || ROWS_3x1 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_3x1; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_3x1; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_3x1;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_3x1;
+    if (xBase - COLS_HALF_3x1 >= 0 && xBase - COLS_HALF_3x1 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_3x1 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_3x1 >= 9 || ROWS_3x1 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_3x1; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_3x1; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_3x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_3x1 * LOCAL_SIZE_ROWS_3x1); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_3x1;
-        int y = idx1D / LOCAL_SIZE_COLS_3x1;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_3x1 * LOCAL_SIZE_ROWS_3x1); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_3x1;
+            int y = idx1D / LOCAL_SIZE_COLS_3x1;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_3x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -1202,7 +1532,7 @@ type_single filter_sum_single_local_3x1(global float* imgIn,
         for (int x = -COLS_HALF_3x1; x <= COLS_HALF_3x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x1) * COLS_3x1 + x + COLS_HALF_3x1;
             sum += color * filterKernel[idx];
@@ -1254,7 +1584,7 @@ type_single filter_sum_single_local_5x1(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1266,46 +1596,79 @@ type_single filter_sum_single_local_5x1(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_5x1 >= 9 || ROWS_5x1 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_5x1; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_5x1; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_5x1;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_5x1;
+    if (xBase - COLS_HALF_5x1 >= 0 && xBase - COLS_HALF_5x1 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_5x1 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_5x1 >= 9 || ROWS_5x1 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_5x1; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_5x1; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_5x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_5x1 * LOCAL_SIZE_ROWS_5x1); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_5x1;
-        int y = idx1D / LOCAL_SIZE_COLS_5x1;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_5x1 * LOCAL_SIZE_ROWS_5x1); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_5x1;
+            int y = idx1D / LOCAL_SIZE_COLS_5x1;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_5x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -1326,7 +1689,7 @@ type_single filter_sum_single_local_5x1(global float* imgIn,
         for (int x = -COLS_HALF_5x1; x <= COLS_HALF_5x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x1) * COLS_5x1 + x + COLS_HALF_5x1;
             sum += color * filterKernel[idx];
@@ -1378,7 +1741,7 @@ type_single filter_sum_single_local_7x1(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1390,46 +1753,79 @@ type_single filter_sum_single_local_7x1(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_7x1 >= 9 || ROWS_7x1 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_7x1; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_7x1; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_7x1;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_7x1;
+    if (xBase - COLS_HALF_7x1 >= 0 && xBase - COLS_HALF_7x1 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_7x1 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_7x1 >= 9 || ROWS_7x1 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_7x1; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_7x1; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_7x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_7x1 * LOCAL_SIZE_ROWS_7x1); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_7x1;
-        int y = idx1D / LOCAL_SIZE_COLS_7x1;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_7x1 * LOCAL_SIZE_ROWS_7x1); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_7x1;
+            int y = idx1D / LOCAL_SIZE_COLS_7x1;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_7x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -1450,7 +1846,7 @@ type_single filter_sum_single_local_7x1(global float* imgIn,
         for (int x = -COLS_HALF_7x1; x <= COLS_HALF_7x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x1) * COLS_7x1 + x + COLS_HALF_7x1;
             sum += color * filterKernel[idx];
@@ -1502,7 +1898,7 @@ type_single filter_sum_single_local_9x1(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1514,46 +1910,79 @@ type_single filter_sum_single_local_9x1(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_9x1 >= 9 || ROWS_9x1 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_9x1; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_9x1; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_9x1;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_9x1;
+    if (xBase - COLS_HALF_9x1 >= 0 && xBase - COLS_HALF_9x1 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_9x1 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_9x1 >= 9 || ROWS_9x1 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_9x1; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_9x1; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_9x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_9x1 * LOCAL_SIZE_ROWS_9x1); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_9x1;
-        int y = idx1D / LOCAL_SIZE_COLS_9x1;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_9x1 * LOCAL_SIZE_ROWS_9x1); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_9x1;
+            int y = idx1D / LOCAL_SIZE_COLS_9x1;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_9x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -1574,7 +2003,7 @@ type_single filter_sum_single_local_9x1(global float* imgIn,
         for (int x = -COLS_HALF_9x1; x <= COLS_HALF_9x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x1) * COLS_9x1 + x + COLS_HALF_9x1;
             sum += color * filterKernel[idx];
@@ -1629,7 +2058,7 @@ type_double filter_sum_double_local(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1641,46 +2070,79 @@ type_double filter_sum_double_local(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if filterCols >= 9 || filterRows >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * filterRowsHalf; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * filterColsHalf; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * filterColsHalf;
+    const int patchRows = yLocalSize + 2 * filterRowsHalf;
+    if (xBase - filterColsHalf >= 0 && xBase - filterColsHalf + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_21x21 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if filterCols >= 9 || filterRows >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * filterRowsHalf; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * filterColsHalf; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_21x21 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_21x21;
-        int y = idx1D / LOCAL_SIZE_COLS_21x21;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_21x21;
+            int y = idx1D / LOCAL_SIZE_COLS_21x21;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_21x21 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -1701,7 +2163,7 @@ type_double filter_sum_double_local(global float* imgIn,
         for (int x = -filterColsHalf; x <= filterColsHalf; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_21x21 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_21x21 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + filterRowsHalf) * filterCols + x + filterColsHalf;
             sum.x += color * filterKernel1[idx];
@@ -1762,7 +2224,7 @@ type_double filter_sum_double_local_3x3(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1774,46 +2236,79 @@ type_double filter_sum_double_local_3x3(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_3x3 >= 9 || ROWS_3x3 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_3x3; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_3x3; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_3x3;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_3x3;
+    if (xBase - COLS_HALF_3x3 >= 0 && xBase - COLS_HALF_3x3 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_3x3 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_3x3 >= 9 || ROWS_3x3 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_3x3; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_3x3; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_3x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_3x3;
-        int y = idx1D / LOCAL_SIZE_COLS_3x3;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_3x3;
+            int y = idx1D / LOCAL_SIZE_COLS_3x3;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_3x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -1834,7 +2329,7 @@ type_double filter_sum_double_local_3x3(global float* imgIn,
         for (int x = -COLS_HALF_3x3; x <= COLS_HALF_3x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x3) * COLS_3x3 + x + COLS_HALF_3x3;
             sum.x += color * filterKernel1[idx];
@@ -1888,7 +2383,7 @@ type_double filter_sum_double_local_5x5(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1900,46 +2395,79 @@ type_double filter_sum_double_local_5x5(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_5x5 >= 9 || ROWS_5x5 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_5x5; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_5x5; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_5x5;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_5x5;
+    if (xBase - COLS_HALF_5x5 >= 0 && xBase - COLS_HALF_5x5 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_5x5 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_5x5 >= 9 || ROWS_5x5 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_5x5; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_5x5; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_5x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_5x5;
-        int y = idx1D / LOCAL_SIZE_COLS_5x5;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_5x5;
+            int y = idx1D / LOCAL_SIZE_COLS_5x5;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -1960,7 +2488,7 @@ type_double filter_sum_double_local_5x5(global float* imgIn,
         for (int x = -COLS_HALF_5x5; x <= COLS_HALF_5x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x5) * COLS_5x5 + x + COLS_HALF_5x5;
             sum.x += color * filterKernel1[idx];
@@ -2014,7 +2542,7 @@ type_double filter_sum_double_local_7x7(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2026,46 +2554,79 @@ type_double filter_sum_double_local_7x7(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_7x7 >= 9 || ROWS_7x7 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_7x7; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_7x7; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_7x7;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_7x7;
+    if (xBase - COLS_HALF_7x7 >= 0 && xBase - COLS_HALF_7x7 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_7x7 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_7x7 >= 9 || ROWS_7x7 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_7x7; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_7x7; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_7x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_7x7;
-        int y = idx1D / LOCAL_SIZE_COLS_7x7;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_7x7;
+            int y = idx1D / LOCAL_SIZE_COLS_7x7;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -2086,7 +2647,7 @@ type_double filter_sum_double_local_7x7(global float* imgIn,
         for (int x = -COLS_HALF_7x7; x <= COLS_HALF_7x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x7) * COLS_7x7 + x + COLS_HALF_7x7;
             sum.x += color * filterKernel1[idx];
@@ -2140,7 +2701,7 @@ type_double filter_sum_double_local_9x9(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2152,46 +2713,79 @@ type_double filter_sum_double_local_9x9(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_9x9 >= 9 || ROWS_9x9 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_9x9; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_9x9; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_9x9;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_9x9;
+    if (xBase - COLS_HALF_9x9 >= 0 && xBase - COLS_HALF_9x9 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_9x9 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_9x9 >= 9 || ROWS_9x9 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_9x9; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_9x9; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_9x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_9x9;
-        int y = idx1D / LOCAL_SIZE_COLS_9x9;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_9x9;
+            int y = idx1D / LOCAL_SIZE_COLS_9x9;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -2212,7 +2806,7 @@ type_double filter_sum_double_local_9x9(global float* imgIn,
         for (int x = -COLS_HALF_9x9; x <= COLS_HALF_9x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x9) * COLS_9x9 + x + COLS_HALF_9x9;
             sum.x += color * filterKernel1[idx];
@@ -2267,7 +2861,7 @@ type_double filter_sum_double_local_1x3(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2279,46 +2873,79 @@ type_double filter_sum_double_local_1x3(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_1x3 >= 9 || ROWS_1x3 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x3; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x3; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_1x3;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_1x3;
+    if (xBase - COLS_HALF_1x3 >= 0 && xBase - COLS_HALF_1x3 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_1x3 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_1x3 >= 9 || ROWS_1x3 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x3; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x3; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_1x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x3 * LOCAL_SIZE_ROWS_1x3); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_1x3;
-        int y = idx1D / LOCAL_SIZE_COLS_1x3;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x3 * LOCAL_SIZE_ROWS_1x3); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_1x3;
+            int y = idx1D / LOCAL_SIZE_COLS_1x3;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_1x3 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -2339,7 +2966,7 @@ type_double filter_sum_double_local_1x3(global float* imgIn,
         for (int x = -COLS_HALF_1x3; x <= COLS_HALF_1x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x3) * COLS_1x3 + x + COLS_HALF_1x3;
             sum.x += color * filterKernel1[idx];
@@ -2396,7 +3023,7 @@ type_double filter_sum_double_local_1x5(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2408,46 +3035,79 @@ type_double filter_sum_double_local_1x5(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_1x5 >= 9 || ROWS_1x5 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x5; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x5; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_1x5;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_1x5;
+    if (xBase - COLS_HALF_1x5 >= 0 && xBase - COLS_HALF_1x5 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_1x5 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_1x5 >= 9 || ROWS_1x5 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x5; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x5; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_1x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x5 * LOCAL_SIZE_ROWS_1x5); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_1x5;
-        int y = idx1D / LOCAL_SIZE_COLS_1x5;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x5 * LOCAL_SIZE_ROWS_1x5); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_1x5;
+            int y = idx1D / LOCAL_SIZE_COLS_1x5;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_1x5 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -2468,7 +3128,7 @@ type_double filter_sum_double_local_1x5(global float* imgIn,
         for (int x = -COLS_HALF_1x5; x <= COLS_HALF_1x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x5) * COLS_1x5 + x + COLS_HALF_1x5;
             sum.x += color * filterKernel1[idx];
@@ -2525,7 +3185,7 @@ type_double filter_sum_double_local_1x7(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2537,46 +3197,79 @@ type_double filter_sum_double_local_1x7(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_1x7 >= 9 || ROWS_1x7 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x7; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x7; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_1x7;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_1x7;
+    if (xBase - COLS_HALF_1x7 >= 0 && xBase - COLS_HALF_1x7 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_1x7 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_1x7 >= 9 || ROWS_1x7 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x7; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x7; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_1x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x7 * LOCAL_SIZE_ROWS_1x7); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_1x7;
-        int y = idx1D / LOCAL_SIZE_COLS_1x7;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x7 * LOCAL_SIZE_ROWS_1x7); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_1x7;
+            int y = idx1D / LOCAL_SIZE_COLS_1x7;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_1x7 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -2597,7 +3290,7 @@ type_double filter_sum_double_local_1x7(global float* imgIn,
         for (int x = -COLS_HALF_1x7; x <= COLS_HALF_1x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x7) * COLS_1x7 + x + COLS_HALF_1x7;
             sum.x += color * filterKernel1[idx];
@@ -2654,7 +3347,7 @@ type_double filter_sum_double_local_1x9(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2666,46 +3359,79 @@ type_double filter_sum_double_local_1x9(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_1x9 >= 9 || ROWS_1x9 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x9; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x9; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_1x9;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_1x9;
+    if (xBase - COLS_HALF_1x9 >= 0 && xBase - COLS_HALF_1x9 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_1x9 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_1x9 >= 9 || ROWS_1x9 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_1x9; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_1x9; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_1x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x9 * LOCAL_SIZE_ROWS_1x9); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_1x9;
-        int y = idx1D / LOCAL_SIZE_COLS_1x9;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_1x9 * LOCAL_SIZE_ROWS_1x9); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_1x9;
+            int y = idx1D / LOCAL_SIZE_COLS_1x9;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_1x9 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -2726,7 +3452,7 @@ type_double filter_sum_double_local_1x9(global float* imgIn,
         for (int x = -COLS_HALF_1x9; x <= COLS_HALF_1x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x9) * COLS_1x9 + x + COLS_HALF_1x9;
             sum.x += color * filterKernel1[idx];
@@ -2783,7 +3509,7 @@ type_double filter_sum_double_local_3x1(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2795,46 +3521,79 @@ type_double filter_sum_double_local_3x1(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_3x1 >= 9 || ROWS_3x1 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_3x1; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_3x1; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_3x1;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_3x1;
+    if (xBase - COLS_HALF_3x1 >= 0 && xBase - COLS_HALF_3x1 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_3x1 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_3x1 >= 9 || ROWS_3x1 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_3x1; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_3x1; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_3x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_3x1 * LOCAL_SIZE_ROWS_3x1); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_3x1;
-        int y = idx1D / LOCAL_SIZE_COLS_3x1;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_3x1 * LOCAL_SIZE_ROWS_3x1); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_3x1;
+            int y = idx1D / LOCAL_SIZE_COLS_3x1;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_3x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -2855,7 +3614,7 @@ type_double filter_sum_double_local_3x1(global float* imgIn,
         for (int x = -COLS_HALF_3x1; x <= COLS_HALF_3x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x1) * COLS_3x1 + x + COLS_HALF_3x1;
             sum.x += color * filterKernel1[idx];
@@ -2912,7 +3671,7 @@ type_double filter_sum_double_local_5x1(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2924,46 +3683,79 @@ type_double filter_sum_double_local_5x1(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_5x1 >= 9 || ROWS_5x1 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_5x1; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_5x1; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_5x1;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_5x1;
+    if (xBase - COLS_HALF_5x1 >= 0 && xBase - COLS_HALF_5x1 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_5x1 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_5x1 >= 9 || ROWS_5x1 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_5x1; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_5x1; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_5x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_5x1 * LOCAL_SIZE_ROWS_5x1); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_5x1;
-        int y = idx1D / LOCAL_SIZE_COLS_5x1;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_5x1 * LOCAL_SIZE_ROWS_5x1); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_5x1;
+            int y = idx1D / LOCAL_SIZE_COLS_5x1;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_5x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -2984,7 +3776,7 @@ type_double filter_sum_double_local_5x1(global float* imgIn,
         for (int x = -COLS_HALF_5x1; x <= COLS_HALF_5x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x1) * COLS_5x1 + x + COLS_HALF_5x1;
             sum.x += color * filterKernel1[idx];
@@ -3041,7 +3833,7 @@ type_double filter_sum_double_local_7x1(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -3053,46 +3845,79 @@ type_double filter_sum_double_local_7x1(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_7x1 >= 9 || ROWS_7x1 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_7x1; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_7x1; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_7x1;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_7x1;
+    if (xBase - COLS_HALF_7x1 >= 0 && xBase - COLS_HALF_7x1 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_7x1 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_7x1 >= 9 || ROWS_7x1 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_7x1; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_7x1; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_7x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_7x1 * LOCAL_SIZE_ROWS_7x1); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_7x1;
-        int y = idx1D / LOCAL_SIZE_COLS_7x1;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_7x1 * LOCAL_SIZE_ROWS_7x1); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_7x1;
+            int y = idx1D / LOCAL_SIZE_COLS_7x1;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_7x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -3113,7 +3938,7 @@ type_double filter_sum_double_local_7x1(global float* imgIn,
         for (int x = -COLS_HALF_7x1; x <= COLS_HALF_7x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x1) * COLS_7x1 + x + COLS_HALF_7x1;
             sum.x += color * filterKernel1[idx];
@@ -3170,7 +3995,7 @@ type_double filter_sum_double_local_9x1(global float* imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -3182,46 +4007,79 @@ type_double filter_sum_double_local_9x1(global float* imgIn,
     int xBase = coordBase.x - xLocalId;
     int yBase = coordBase.y - yLocalId;
 
-#if COLS_9x1 >= 9 || ROWS_9x1 >= 9
-    /*
-     * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
-     * bbbb
-     * bxxb
-     * bxxb
-     * bbbb
-     * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
-     * 1122
-     * 1122
-     * 3344
-     * 3344
-     * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
-     *
-     * Less index calculation but more memory accesses, better for larger filter sizes
-     */
-    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_9x1; y += yLocalSize)
-    {
-        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_9x1; x += xLocalSize)
+    const int patchCols = xLocalSize + 2 * COLS_HALF_9x1;
+    const int patchRows = yLocalSize + 2 * ROWS_HALF_9x1;
+    if (xBase - COLS_HALF_9x1 >= 0 && xBase - COLS_HALF_9x1 + patchCols <= cols)
+    {
+        /*
+         * The patch does not cross the left or right image border, i.e. every row of the patch is contiguous in memory. Each work-item copies 4 pixels at once
+         * (vload4 only requires the alignment of a float) and the remaining pixels at the end of a row individually. Only the rows are mapped according to the border type
+         */
+        const int vectorsPerRow = (patchCols + 3) / 4;
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < vectorsPerRow * patchRows; idx1D += xLocalSize * yLocalSize)
         {
-            // Coordinate from the image patch which must be stored in the current local buffer position
+            const int x = (idx1D % vectorsPerRow) * 4;
+            const int y = idx1D / vectorsPerRow;
+
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            global float* rowIn = imgIn + locationLookup[coordBorder.z].previousPixels + coordBorder.y * cols + coordBorder.x;
+            local float* rowLocal = localBuffer + y * LOCAL_STRIDE_9x1 + x;
+            if (x + 4 <= patchCols)
+            {
+                vstore4(vload4(0, rowIn), 0, rowLocal);
+            }
+            else
+            {
+                for (int i = 0; i < patchCols - x; ++i)
+                {
+                    rowLocal[i] = rowIn[i];
+                }
+            }
         }
     }
+    else
+    {
+#if COLS_9x1 >= 9 || ROWS_9x1 >= 9
+        /*
+         * Copy the image patch including the padding from global to local memory. Consider for example a 2x2 patch with a padding of 1 px:
+         * bbbb
+         * bxxb
+         * bxxb
+         * bbbb
+         * The following pattern fills the local buffer in 4 iterations with a local work-group size of 2x2
+         * 1122
+         * 1122
+         * 3344
+         * 3344
+         * The number denotes the iteration when the corresponding buffer element is filled. Note that the local buffer is filled beginning in the top left corner (of the buffer)
+         *
+         * Less index calculation but more memory accesses, better for larger filter sizes
+         */
+        for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_9x1; y += yLocalSize)
+        {
+            for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_9x1; x += xLocalSize)
+            {
+                // Coordinate from the image patch which must be stored in the current local buffer position
+                int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
+                localBuffer[y * LOCAL_STRIDE_9x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            }
+        }
 #else
-    /*
-     * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
-     *
-     * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
-     */
-    for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_9x1 * LOCAL_SIZE_ROWS_9x1); idx1D += xLocalSize * yLocalSize) {
-        int x = idx1D % LOCAL_SIZE_COLS_9x1;
-        int y = idx1D / LOCAL_SIZE_COLS_9x1;
-        
-        // Coordinate from the image patch which must be stored in the current local buffer position
-        int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
-    }
+        /*
+         * Copy the image patch including the padding from global to local memory. The local ID is mapped to the 1D index and this index is remapped to the size of the local buffer. It only needs 2 iterations
+         *
+         * More index calculations but less memory accesses, better for smaller filter sizes (a 9x9 filter is the first which needs 3 iterations)
+         */
+        for (int idx1D = yLocalId * xLocalSize + xLocalId; idx1D < (LOCAL_SIZE_COLS_9x1 * LOCAL_SIZE_ROWS_9x1); idx1D += xLocalSize * yLocalSize) {
+            int x = idx1D % LOCAL_SIZE_COLS_9x1;
+            int y = idx1D / LOCAL_SIZE_COLS_9x1;
+            
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_9x1 + x] = readValue(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        }
 #endif
+    }
         
     // Wait until the image patch is loaded in local memory
     work_group_barrier(CLK_LOCAL_MEM_FENCE);
@@ -3242,7 +4100,7 @@ type_double filter_sum_double_local_9x1(global float* imgIn,
         for (int x = -COLS_HALF_9x1; x <= COLS_HALF_9x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x1) * COLS_9x1 + x + COLS_HALF_9x1;
             sum.x += color * filterKernel1[idx];
@@ -0,0 +1,199 @@
+// Persistent work-groups for the pyramids stored in one buffer (buffer and image1D pyramid). Instead of one work-group per tile, a fixed number of
+// work-groups loops over all tiles of an octave. The image patch of the next tile is prefetched with async_work_group_copy into a second local buffer
+// while the current tile is computed
+
+#define TILE_SIZE_PERSISTENT 16 // Must match the local work-group size
+
+/**
+ * Checks whether all rows of the image patch (including the padding) can be copied as a whole, i.e. the patch does not cross the left or right image border.
+ */
+bool tile_inside_persistent(const int xTile, const int cols, const int filterColsHalf)
+{
+    return xTile - filterColsHalf >= 0 && xTile + TILE_SIZE_PERSISTENT + filterColsHalf <= cols;
+}
+
+/**
+ * Starts the asynchronous copy of the image patch (including the padding) from global to local memory. Every row of the patch is one contiguous block in the
+ * buffer. Rows outside the image are mapped according to the border type. All copies are associated with the returned event.
+ */
+event_t prefetch_tile_persistent(global const float* imgIn,
+                                 constant struct Lookup* locationLookup,
+                                 local float* localBuffer,
+                                 const int level,
+                                 const int xTile,
+                                 const int yTile,
+                                 const int filterRowsHalf,
+                                 const int filterColsHalf,
+                                 const int border)
+{
+    const int rows = locationLookup[level].imgHeight;
+    const int cols = locationLookup[level].imgWidth;
+    const int localCols = TILE_SIZE_PERSISTENT + 2 * filterColsHalf;
+    const int localRows = TILE_SIZE_PERSISTENT + 2 * filterRowsHalf;
+
+    int3 coordRow = borderCoordinate((int3)(0, yTile - filterRowsHalf, level), rows, cols, border);
+    coordRow.y = clamp(coordRow.y, 0, rows - 1); // BORDER_REPLICATE is not handled by borderCoordinate
+    event_t event = async_work_group_copy(localBuffer, imgIn + locationLookup[level].previousPixels + coordRow.y * cols + xTile - filterColsHalf, localCols, 0);
+
+    for (int y = 1; y < localRows; ++y)
+    {
+        coordRow = borderCoordinate((int3)(0, yTile - filterRowsHalf + y, level), rows, cols, border);
+        coordRow.y = clamp(coordRow.y, 0, rows - 1);
+        event = async_work_group_copy(localBuffer + y * localCols, imgIn + locationLookup[level].previousPixels + coordRow.y * cols + xTile - filterColsHalf, localCols, event);
+    }
+
+    return event;
+}
+
+/**
+ * Loads the image patch (including the padding) pixel by pixel from global to local memory. Used for tiles at the left and right image border where the
+ * rows of the patch are not contiguous in memory.
+ */
+void load_tile_persistent(global const float* imgIn,
+                          constant struct Lookup* locationLookup,
+                          local float* localBuffer,
+                          const int level,
+                          const int xTile,
+                          const int yTile,
+                          const int filterRowsHalf,
+                          const int filterColsHalf,
+                          const int border)
+{
+    const int rows = locationLookup[level].imgHeight;
+    const int cols = locationLookup[level].imgWidth;
+    const int localCols = TILE_SIZE_PERSISTENT + 2 * filterColsHalf;
+    const int localRows = TILE_SIZE_PERSISTENT + 2 * filterRowsHalf;
+
+    for (int y = get_local_id(1); y < localRows; y += get_local_size(1))
+    {
+        for (int x = get_local_id(0); x < localCols; x += get_local_size(0))
+        {
+            int3 coordBorder = borderCoordinate((int3)(xTile - filterColsHalf + x, yTile - filterRowsHalf + y, level), rows, cols, border);
+            coordBorder.x = clamp(coordBorder.x, 0, cols - 1);
+            coordBorder.y = clamp(coordBorder.y, 0, rows - 1);
+            localBuffer[y * localCols + x] = imgIn[locationLookup[level].previousPixels + coordBorder.y * cols + coordBorder.x];
+        }
+    }
+}
+
+/**
+ * Filter kernel for a single filter using local memory with persistent work-groups supposed to be called from the host.
+ *
+ * Only as many work-groups as the device can run concurrently are started (1D list of work-groups with a local size of 16x16). Each work-group processes
+ * the tiles tile = group_id, group_id + num_groups, ... of the complete octave. While the current tile is computed, the next tile is already copied to
+ * the second local buffer. Tiles at the left and right image border are loaded directly by the work-items (no overlap with the computation).
+ *
+ * @param imgIn input image
+ * @param locationLookup lookup table to access the pixels in the scale space
+ * @param imgOut image containing the filter response
+ * @param filterKernel 1D array with the filter values. The filter is centred on the current pixel and the size of the filter must be odd (up to 21x21)
+ * @param filterRowsHalf rows of the filter divided by 2 with int cast, i.e. filterRowsHalf = floor(filterRows / 2)
+ * @param filterCols cols of the filter
+ * @param filterColsHalf cols of the filter divided by 2 with int cast, i.e. filterColsHalf = floor(filterCols / 2)
+ * @param base first level of the octave
+ * @param depth number of levels in the octave (all levels have the same size)
+ * @param border int value which specifies how out-of-border accesses should be handled. The values correspond to the OpenCV border types
+ */
+kernel void filter_single_local_persistent(global const float* imgIn,
+                                           constant struct Lookup* locationLookup,
+                                           global float* imgOut,
+                                           constant float* filterKernel,
+                                           const int filterRowsHalf,
+                                           const int filterCols,
+                                           const int filterColsHalf,
+                                           const int base,
+                                           const int depth,
+                                           const int border)
+{
+    // Two local buffers: one is used for the computation while the next tile is copied into the other one
+    local float localBuffer0[LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21];
+    local float localBuffer1[LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21];
+
+    const int rows = locationLookup[base].imgHeight;
+    const int cols = locationLookup[base].imgWidth;
+    const int tilesX = (cols + TILE_SIZE_PERSISTENT - 1) / TILE_SIZE_PERSISTENT;
+    const int tilesY = (rows + TILE_SIZE_PERSISTENT - 1) / TILE_SIZE_PERSISTENT;
+    const int tilesPerLevel = tilesX * tilesY;
+    const int tilesTotal = tilesPerLevel * depth;
+    const int localCols = TILE_SIZE_PERSISTENT + 2 * filterColsHalf;
+
+    const int xLocalId = get_local_id(0);
+    const int yLocalId = get_local_id(1);
+
+    // All variables below are uniform in the work-group (required for async_work_group_copy and the barriers)
+    int tile = get_group_id(0);
+    const int tileStep = get_num_groups(0);
+    if (tile >= tilesTotal)
+    {
+        return;
+    }
+
+    local float* bufferCurrent = localBuffer0;
+    local float* bufferNext = localBuffer1;
+
+    event_t event;
+    int level = base + tile / tilesPerLevel;
+    int xTile = (tile % tilesPerLevel) % tilesX * TILE_SIZE_PERSISTENT;
+    int yTile = (tile % tilesPerLevel) / tilesX * TILE_SIZE_PERSISTENT;
+    bool asyncCopy = tile_inside_persistent(xTile, cols, filterColsHalf);
+    if (asyncCopy)
+    {
+        event = prefetch_tile_persistent(imgIn, locationLookup, bufferCurrent, level, xTile, yTile, filterRowsHalf, filterColsHalf, border);
+    }
+    else
+    {
+        load_tile_persistent(imgIn, locationLookup, bufferCurrent, level, xTile, yTile, filterRowsHalf, filterColsHalf, border);
+    }
+
+    for (; tile < tilesTotal; tile += tileStep)
+    {
+        // Wait until the current tile is completely in local memory. The barrier also ensures that no work-item still reads from the other buffer
+        if (asyncCopy)
+        {
+            wait_group_events(1, &event);
+        }
+        work_group_barrier(CLK_LOCAL_MEM_FENCE);
+
+        const int levelCurrent = level;
+        const int xTileCurrent = xTile;
+        const int yTileCurrent = yTile;
+
+        // Start the copy of the next tile before the current one is computed
+        const int tileNext = tile + tileStep;
+        if (tileNext < tilesTotal)
+        {
+            level = base + tileNext / tilesPerLevel;
+            xTile = (tileNext % tilesPerLevel) % tilesX * TILE_SIZE_PERSISTENT;
+            yTile = (tileNext % tilesPerLevel) / tilesX * TILE_SIZE_PERSISTENT;
+            asyncCopy = tile_inside_persistent(xTile, cols, filterColsHalf);
+            if (asyncCopy)
+            {
+                event = prefetch_tile_persistent(imgIn, locationLookup, bufferNext, level, xTile, yTile, filterRowsHalf, filterColsHalf, border);
+            }
+            else
+            {
+                load_tile_persistent(imgIn, locationLookup, bufferNext, level, xTile, yTile, filterRowsHalf, filterColsHalf, border);
+            }
+        }
+
+        const int x = xTileCurrent + xLocalId;
+        const int y = yTileCurrent + yLocalId;
+        if (x < cols && y < rows)
+        {
+            float sum = 0.0f;
+            for (int yFilter = 0; yFilter <= 2 * filterRowsHalf; ++yFilter)
+            {
+                for (int xFilter = 0; xFilter < filterCols; ++xFilter)
+                {
+                    sum += bufferCurrent[(yLocalId + yFilter) * localCols + xLocalId + xFilter] * filterKernel[yFilter * filterCols + xFilter];
+                }
+            }
+
+            writeValue(imgOut, locationLookup, levelCurrent, x, y, sum);
+        }
+
+        local float* bufferTmp = bufferCurrent;
+        bufferCurrent = bufferNext;
+        bufferNext = bufferTmp;
+    }
+}
@@ -0,0 +1,63 @@
+// Separation filter where both passes filter along the rows. Every pass writes its result transposed (via a tile in local memory) so that the second
+// pass reads the columns of the original image as contiguous rows and the final result is again in the original layout
+
+#define TILE_SIZE_TRANSPOSED 16 // Must match the local work-group size
+
+/**
+ * Filter kernel which applies a row filter and writes the result transposed supposed to be called from the host (once per pass).
+ *
+ * The filter sum is calculated at the input pixel (x, y) and stored in a 16x16 tile in local memory. The tile is then written with swapped coordinates so
+ * that consecutive work-items write consecutive addresses. The tile has one additional column to avoid bank conflicts when it is read column-wise.
+ * The global size must be a multiple of the tile size (work-items outside the image only take part in the barrier).
+ *
+ * @param imgIn input image
+ * @param locationLookupIn lookup table to access the pixels of the input image
+ * @param imgOut transposed image containing the filter response
+ * @param locationLookupOut lookup table to access the pixels of the output image (width and height of the input image swapped)
+ * @param filterKernel 1D array with the values of the row filter. The filter is centred on the current pixel and the size of the filter must be odd
+ * @param filterColsHalf cols of the filter divided by 2 with int cast, i.e. filterColsHalf = floor(filterCols / 2)
+ * @param border int value which specifies how out-of-border accesses should be handled. The values correspond to the OpenCV border types
+ */
+kernel void filter_single_row_transposed(global float* imgIn,
+                                         constant struct Lookup* locationLookupIn,
+                                         global float* imgOut,
+                                         constant struct Lookup* locationLookupOut,
+                                         constant float* filterKernel,
+                                         const int filterColsHalf,
+                                         const int border)
+{
+    local float tile[TILE_SIZE_TRANSPOSED][TILE_SIZE_TRANSPOSED + 1];
+
+    const int level = get_global_id(2);
+    const int rows = locationLookupIn[level].imgHeight;
+    const int cols = locationLookupIn[level].imgWidth;
+
+    const int xLocalId = get_local_id(0);
+    const int yLocalId = get_local_id(1);
+    const int x = get_global_id(0);
+    const int y = get_global_id(1);
+
+    if (x < cols && y < rows)
+    {
+        float sum = 0.0f;
+        for (int xFilter = -filterColsHalf; xFilter <= filterColsHalf; ++xFilter)
+        {
+            int3 coordBorder = borderCoordinate((int3)(x + xFilter, y, level), rows, cols, border);
+            coordBorder.x = clamp(coordBorder.x, 0, cols - 1); // BORDER_REPLICATE is not handled by borderCoordinate
+            sum += readValue(imgIn, locationLookupIn, level, coordBorder.x, y) * filterKernel[xFilter + filterColsHalf];
+        }
+
+        tile[yLocalId][xLocalId] = sum;
+    }
+
+    // Wait until the complete tile is filtered
+    work_group_barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Position in the transposed output: the work-group (gx, gy) writes to the tile (gy, gx)
+    const int xOut = get_group_id(1) * TILE_SIZE_TRANSPOSED + xLocalId;
+    const int yOut = get_group_id(0) * TILE_SIZE_TRANSPOSED + yLocalId;
+    if (xOut < rows && yOut < cols)
+    {
+        writeValue(imgOut, locationLookupOut, level, xOut, yOut, tile[xLocalId][yLocalId]);
+    }
+}
@@ -48,8 +48,17 @@ int4 borderCoordinate(int4 coord, int rows, int cols, int border)
     return coordAdjusted;
 }
 
+// Memory access of the bandwidth probes (filter_probes.cl)
+#define PROBE_SRC_TYPE read_only image2d_array_t
+#define PROBE_DST_TYPE write_only image2d_array_t
+#define PROBE_READ(x, y, z) read_imagef(src, sampler, (int4)(x, y, z, 0)).x
+#define PROBE_WRITE(x, y, z, v) write_imagef(dst, (int4)(x, y, z, 0), (float4)(v))
+
 #include "filter_cubes_normal.cl"
 #include "filter_cubes_local.cl"
+#include "filter_cubes_dilated.cl"
+#include "filter_probes.cl"
+#include "filter_overhead.cl"
 
 /**
  * @see https://github.com/opencv/opencv/blob/master/modules/imgproc/src/opencl/resize.cl
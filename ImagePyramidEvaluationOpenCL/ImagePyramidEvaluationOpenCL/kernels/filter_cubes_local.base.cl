@@ -19,7 +19,7 @@
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_NxN * LOCAL_SIZE_ROWS_NxN];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_NxN * LOCAL_SIZE_ROWS_NxN];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -53,7 +53,7 @@
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_NxN + xBase, y - ROWS_HALF_NxN + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_NxN + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_NxN + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -68,7 +68,7 @@
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_NxN + xBase, y - ROWS_HALF_NxN + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_NxN + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_NxN + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -92,7 +92,7 @@
         for (int x = -COLS_HALF_NxN; x <= COLS_HALF_NxN; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_NxN + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_NxN + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_NxN) * COLS_NxN + x + COLS_HALF_NxN;
             sum/* GENERATE_DOUBLE:.x*/ += color * filterKernel/* GENERATE_DOUBLE:1*/[idx];
@@ -20,7 +20,7 @@ type_single filter_sum_single_local(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -54,7 +54,7 @@ type_single filter_sum_single_local(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -69,7 +69,7 @@ type_single filter_sum_single_local(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -92,7 +92,7 @@ type_single filter_sum_single_local(read_only image2d_array_t imgIn,
         for (int x = -filterColsHalf; x <= filterColsHalf; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_21x21 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_21x21 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + filterRowsHalf) * filterCols + x + filterColsHalf;
             sum += color * filterKernel[idx];
@@ -146,7 +146,7 @@ type_single filter_sum_single_local_3x3(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -180,7 +180,7 @@ type_single filter_sum_single_local_3x3(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -195,7 +195,7 @@ type_single filter_sum_single_local_3x3(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -218,7 +218,7 @@ type_single filter_sum_single_local_3x3(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_3x3; x <= COLS_HALF_3x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x3) * COLS_3x3 + x + COLS_HALF_3x3;
             sum += color * filterKernel[idx];
@@ -265,7 +265,7 @@ type_single filter_sum_single_local_5x5(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -299,7 +299,7 @@ type_single filter_sum_single_local_5x5(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -314,7 +314,7 @@ type_single filter_sum_single_local_5x5(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -337,7 +337,7 @@ type_single filter_sum_single_local_5x5(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_5x5; x <= COLS_HALF_5x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x5) * COLS_5x5 + x + COLS_HALF_5x5;
             sum += color * filterKernel[idx];
@@ -384,7 +384,7 @@ type_single filter_sum_single_local_7x7(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -418,7 +418,7 @@ type_single filter_sum_single_local_7x7(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -433,7 +433,7 @@ type_single filter_sum_single_local_7x7(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -456,7 +456,7 @@ type_single filter_sum_single_local_7x7(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_7x7; x <= COLS_HALF_7x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x7) * COLS_7x7 + x + COLS_HALF_7x7;
             sum += color * filterKernel[idx];
@@ -503,7 +503,7 @@ type_single filter_sum_single_local_9x9(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -537,7 +537,7 @@ type_single filter_sum_single_local_9x9(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -552,7 +552,7 @@ type_single filter_sum_single_local_9x9(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -575,7 +575,7 @@ type_single filter_sum_single_local_9x9(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_9x9; x <= COLS_HALF_9x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x9) * COLS_9x9 + x + COLS_HALF_9x9;
             sum += color * filterKernel[idx];
@@ -623,7 +623,7 @@ type_single filter_sum_single_local_1x3(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -657,7 +657,7 @@ type_single filter_sum_single_local_1x3(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -672,7 +672,7 @@ type_single filter_sum_single_local_1x3(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -695,7 +695,7 @@ type_single filter_sum_single_local_1x3(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_1x3; x <= COLS_HALF_1x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x3) * COLS_1x3 + x + COLS_HALF_1x3;
             sum += color * filterKernel[idx];
@@ -745,7 +745,7 @@ type_single filter_sum_single_local_1x5(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -779,7 +779,7 @@ type_single filter_sum_single_local_1x5(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -794,7 +794,7 @@ type_single filter_sum_single_local_1x5(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -817,7 +817,7 @@ type_single filter_sum_single_local_1x5(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_1x5; x <= COLS_HALF_1x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x5) * COLS_1x5 + x + COLS_HALF_1x5;
             sum += color * filterKernel[idx];
@@ -867,7 +867,7 @@ type_single filter_sum_single_local_1x7(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -901,7 +901,7 @@ type_single filter_sum_single_local_1x7(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -916,7 +916,7 @@ type_single filter_sum_single_local_1x7(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -939,7 +939,7 @@ type_single filter_sum_single_local_1x7(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_1x7; x <= COLS_HALF_1x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x7) * COLS_1x7 + x + COLS_HALF_1x7;
             sum += color * filterKernel[idx];
@@ -989,7 +989,7 @@ type_single filter_sum_single_local_1x9(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1023,7 +1023,7 @@ type_single filter_sum_single_local_1x9(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1038,7 +1038,7 @@ type_single filter_sum_single_local_1x9(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1061,7 +1061,7 @@ type_single filter_sum_single_local_1x9(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_1x9; x <= COLS_HALF_1x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x9) * COLS_1x9 + x + COLS_HALF_1x9;
             sum += color * filterKernel[idx];
@@ -1111,7 +1111,7 @@ type_single filter_sum_single_local_3x1(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1145,7 +1145,7 @@ type_single filter_sum_single_local_3x1(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1160,7 +1160,7 @@ type_single filter_sum_single_local_3x1(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1183,7 +1183,7 @@ type_single filter_sum_single_local_3x1(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_3x1; x <= COLS_HALF_3x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x1) * COLS_3x1 + x + COLS_HALF_3x1;
             sum += color * filterKernel[idx];
@@ -1233,7 +1233,7 @@ type_single filter_sum_single_local_5x1(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1267,7 +1267,7 @@ type_single filter_sum_single_local_5x1(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1282,7 +1282,7 @@ type_single filter_sum_single_local_5x1(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1305,7 +1305,7 @@ type_single filter_sum_single_local_5x1(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_5x1; x <= COLS_HALF_5x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x1) * COLS_5x1 + x + COLS_HALF_5x1;
             sum += color * filterKernel[idx];
@@ -1355,7 +1355,7 @@ type_single filter_sum_single_local_7x1(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1389,7 +1389,7 @@ type_single filter_sum_single_local_7x1(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1404,7 +1404,7 @@ type_single filter_sum_single_local_7x1(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1427,7 +1427,7 @@ type_single filter_sum_single_local_7x1(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_7x1; x <= COLS_HALF_7x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x1) * COLS_7x1 + x + COLS_HALF_7x1;
             sum += color * filterKernel[idx];
@@ -1477,7 +1477,7 @@ type_single filter_sum_single_local_9x1(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1511,7 +1511,7 @@ type_single filter_sum_single_local_9x1(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1526,7 +1526,7 @@ type_single filter_sum_single_local_9x1(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1549,7 +1549,7 @@ type_single filter_sum_single_local_9x1(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_9x1; x <= COLS_HALF_9x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x1) * COLS_9x1 + x + COLS_HALF_9x1;
             sum += color * filterKernel[idx];
@@ -1602,7 +1602,7 @@ type_double filter_sum_double_local(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1636,7 +1636,7 @@ type_double filter_sum_double_local(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1651,7 +1651,7 @@ type_double filter_sum_double_local(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1674,7 +1674,7 @@ type_double filter_sum_double_local(read_only image2d_array_t imgIn,
         for (int x = -filterColsHalf; x <= filterColsHalf; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_21x21 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_21x21 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + filterRowsHalf) * filterCols + x + filterColsHalf;
             sum.x += color * filterKernel1[idx];
@@ -1733,7 +1733,7 @@ type_double filter_sum_double_local_3x3(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1767,7 +1767,7 @@ type_double filter_sum_double_local_3x3(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1782,7 +1782,7 @@ type_double filter_sum_double_local_3x3(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1805,7 +1805,7 @@ type_double filter_sum_double_local_3x3(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_3x3; x <= COLS_HALF_3x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x3) * COLS_3x3 + x + COLS_HALF_3x3;
             sum.x += color * filterKernel1[idx];
@@ -1857,7 +1857,7 @@ type_double filter_sum_double_local_5x5(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1891,7 +1891,7 @@ type_double filter_sum_double_local_5x5(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1906,7 +1906,7 @@ type_double filter_sum_double_local_5x5(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1929,7 +1929,7 @@ type_double filter_sum_double_local_5x5(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_5x5; x <= COLS_HALF_5x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x5) * COLS_5x5 + x + COLS_HALF_5x5;
             sum.x += color * filterKernel1[idx];
@@ -1981,7 +1981,7 @@ type_double filter_sum_double_local_7x7(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2015,7 +2015,7 @@ type_double filter_sum_double_local_7x7(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -2030,7 +2030,7 @@ type_double filter_sum_double_local_7x7(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -2053,7 +2053,7 @@ type_double filter_sum_double_local_7x7(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_7x7; x <= COLS_HALF_7x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x7) * COLS_7x7 + x + COLS_HALF_7x7;
             sum.x += color * filterKernel1[idx];
@@ -2105,7 +2105,7 @@ type_double filter_sum_double_local_9x9(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2139,7 +2139,7 @@ type_double filter_sum_double_local_9x9(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -2154,7 +2154,7 @@ type_double filter_sum_double_local_9x9(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -2177,7 +2177,7 @@ type_double filter_sum_double_local_9x9(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_9x9; x <= COLS_HALF_9x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x9) * COLS_9x9 + x + COLS_HALF_9x9;
             sum.x += color * filterKernel1[idx];
@@ -2230,7 +2230,7 @@ type_double filter_sum_double_local_1x3(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2264,7 +2264,7 @@ type_double filter_sum_double_local_1x3(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -2279,7 +2279,7 @@ type_double filter_sum_double_local_1x3(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -2302,7 +2302,7 @@ type_double filter_sum_double_local_1x3(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_1x3; x <= COLS_HALF_1x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x3) * COLS_1x3 + x + COLS_HALF_1x3;
             sum.x += color * filterKernel1[idx];
@@ -2357,7 +2357,7 @@ type_double filter_sum_double_local_1x5(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2391,7 +2391,7 @@ type_double filter_sum_double_local_1x5(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -2406,7 +2406,7 @@ type_double filter_sum_double_local_1x5(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -2429,7 +2429,7 @@ type_double filter_sum_double_local_1x5(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_1x5; x <= COLS_HALF_1x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x5) * COLS_1x5 + x + COLS_HALF_1x5;
             sum.x += color * filterKernel1[idx];
@@ -2484,7 +2484,7 @@ type_double filter_sum_double_local_1x7(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2518,7 +2518,7 @@ type_double filter_sum_double_local_1x7(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -2533,7 +2533,7 @@ type_double filter_sum_double_local_1x7(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -2556,7 +2556,7 @@ type_double filter_sum_double_local_1x7(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_1x7; x <= COLS_HALF_1x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x7) * COLS_1x7 + x + COLS_HALF_1x7;
             sum.x += color * filterKernel1[idx];
@@ -2611,7 +2611,7 @@ type_double filter_sum_double_local_1x9(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2645,7 +2645,7 @@ type_double filter_sum_double_local_1x9(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -2660,7 +2660,7 @@ type_double filter_sum_double_local_1x9(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -2683,7 +2683,7 @@ type_double filter_sum_double_local_1x9(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_1x9; x <= COLS_HALF_1x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x9) * COLS_1x9 + x + COLS_HALF_1x9;
             sum.x += color * filterKernel1[idx];
@@ -2738,7 +2738,7 @@ type_double filter_sum_double_local_3x1(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2772,7 +2772,7 @@ type_double filter_sum_double_local_3x1(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -2787,7 +2787,7 @@ type_double filter_sum_double_local_3x1(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -2810,7 +2810,7 @@ type_double filter_sum_double_local_3x1(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_3x1; x <= COLS_HALF_3x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x1) * COLS_3x1 + x + COLS_HALF_3x1;
             sum.x += color * filterKernel1[idx];
@@ -2865,7 +2865,7 @@ type_double filter_sum_double_local_5x1(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2899,7 +2899,7 @@ type_double filter_sum_double_local_5x1(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -2914,7 +2914,7 @@ type_double filter_sum_double_local_5x1(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -2937,7 +2937,7 @@ type_double filter_sum_double_local_5x1(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_5x1; x <= COLS_HALF_5x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x1) * COLS_5x1 + x + COLS_HALF_5x1;
             sum.x += color * filterKernel1[idx];
@@ -2992,7 +2992,7 @@ type_double filter_sum_double_local_7x1(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -3026,7 +3026,7 @@ type_double filter_sum_double_local_7x1(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -3041,7 +3041,7 @@ type_double filter_sum_double_local_7x1(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -3064,7 +3064,7 @@ type_double filter_sum_double_local_7x1(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_7x1; x <= COLS_HALF_7x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x1) * COLS_7x1 + x + COLS_HALF_7x1;
             sum.x += color * filterKernel1[idx];
@@ -3119,7 +3119,7 @@ type_double filter_sum_double_local_9x1(read_only image2d_array_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -3153,7 +3153,7 @@ type_double filter_sum_double_local_9x1(read_only image2d_array_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z, 0), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -3168,7 +3168,7 @@ type_double filter_sum_double_local_9x1(read_only image2d_array_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int4 coordBorder = borderCoordinate((int4)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z, 0), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x1 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -3191,7 +3191,7 @@ type_double filter_sum_double_local_9x1(read_only image2d_array_t imgIn,
         for (int x = -COLS_HALF_9x1; x <= COLS_HALF_9x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x1) * COLS_9x1 + x + COLS_HALF_9x1;
             sum.x += color * filterKernel1[idx];
@@ -48,8 +48,18 @@ int3 borderCoordinate(int3 coord, int rows, int cols, int border)
     return coordAdjusted;
 }
 
+// Memory access of the bandwidth probes (filter_probes.cl)
+#define PROBE_SRC_TYPE read_only image1d_buffer_t
+#define PROBE_DST_TYPE write_only image1d_buffer_t
+#define PROBE_READ(x, y, z) read_imagef(src, ((z) * rows + (y)) * cols + (x)).x
+#define PROBE_WRITE(x, y, z, v) write_imagef(dst, ((z) * rows + (y)) * cols + (x), (float4)(v))
+
 #include "filter_image1D_normal.cl"
 #include "filter_image1D_local.cl"
+#include "filter_image1D_dilated.cl"
+#include "filter_buffer_persistent.cl"
+#include "filter_probes.cl"
+#include "filter_overhead.cl"
 
 /**
  * @see https://github.com/opencv/opencv/blob/master/modules/imgproc/src/opencl/resize.cl
@@ -20,7 +20,7 @@
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_NxN * LOCAL_SIZE_ROWS_NxN];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_NxN * LOCAL_SIZE_ROWS_NxN];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -54,7 +54,7 @@
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_NxN + xBase, y - ROWS_HALF_NxN + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_NxN + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_NxN + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -69,7 +69,7 @@
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_NxN + xBase, y - ROWS_HALF_NxN + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_NxN + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_NxN + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -93,7 +93,7 @@
         for (int x = -COLS_HALF_NxN; x <= COLS_HALF_NxN; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_NxN + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_NxN + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_NxN) * COLS_NxN + x + COLS_HALF_NxN;
             sum/* GENERATE_DOUBLE:.x*/ += color * filterKernel/* GENERATE_DOUBLE:1*/[idx];
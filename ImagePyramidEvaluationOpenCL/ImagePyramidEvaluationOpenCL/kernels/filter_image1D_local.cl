@@ -21,7 +21,7 @@ type_single filter_sum_single_local(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -55,7 +55,7 @@ type_single filter_sum_single_local(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_21x21 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -70,7 +70,7 @@ type_single filter_sum_single_local(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_21x21 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -93,7 +93,7 @@ type_single filter_sum_single_local(read_only image1d_buffer_t imgIn,
         for (int x = -filterColsHalf; x <= filterColsHalf; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_21x21 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_21x21 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + filterRowsHalf) * filterCols + x + filterColsHalf;
             sum += color * filterKernel[idx];
@@ -149,7 +149,7 @@ type_single filter_sum_single_local_3x3(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -183,7 +183,7 @@ type_single filter_sum_single_local_3x3(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -198,7 +198,7 @@ type_single filter_sum_single_local_3x3(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -221,7 +221,7 @@ type_single filter_sum_single_local_3x3(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_3x3; x <= COLS_HALF_3x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x3) * COLS_3x3 + x + COLS_HALF_3x3;
             sum += color * filterKernel[idx];
@@ -270,7 +270,7 @@ type_single filter_sum_single_local_5x5(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -304,7 +304,7 @@ type_single filter_sum_single_local_5x5(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -319,7 +319,7 @@ type_single filter_sum_single_local_5x5(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -342,7 +342,7 @@ type_single filter_sum_single_local_5x5(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_5x5; x <= COLS_HALF_5x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x5) * COLS_5x5 + x + COLS_HALF_5x5;
             sum += color * filterKernel[idx];
@@ -391,7 +391,7 @@ type_single filter_sum_single_local_7x7(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -425,7 +425,7 @@ type_single filter_sum_single_local_7x7(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -440,7 +440,7 @@ type_single filter_sum_single_local_7x7(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -463,7 +463,7 @@ type_single filter_sum_single_local_7x7(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_7x7; x <= COLS_HALF_7x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x7) * COLS_7x7 + x + COLS_HALF_7x7;
             sum += color * filterKernel[idx];
@@ -512,7 +512,7 @@ type_single filter_sum_single_local_9x9(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -546,7 +546,7 @@ type_single filter_sum_single_local_9x9(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -561,7 +561,7 @@ type_single filter_sum_single_local_9x9(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -584,7 +584,7 @@ type_single filter_sum_single_local_9x9(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_9x9; x <= COLS_HALF_9x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x9) * COLS_9x9 + x + COLS_HALF_9x9;
             sum += color * filterKernel[idx];
@@ -634,7 +634,7 @@ type_single filter_sum_single_local_1x3(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -668,7 +668,7 @@ type_single filter_sum_single_local_1x3(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -683,7 +683,7 @@ type_single filter_sum_single_local_1x3(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -706,7 +706,7 @@ type_single filter_sum_single_local_1x3(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_1x3; x <= COLS_HALF_1x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x3) * COLS_1x3 + x + COLS_HALF_1x3;
             sum += color * filterKernel[idx];
@@ -758,7 +758,7 @@ type_single filter_sum_single_local_1x5(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -792,7 +792,7 @@ type_single filter_sum_single_local_1x5(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -807,7 +807,7 @@ type_single filter_sum_single_local_1x5(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -830,7 +830,7 @@ type_single filter_sum_single_local_1x5(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_1x5; x <= COLS_HALF_1x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x5) * COLS_1x5 + x + COLS_HALF_1x5;
             sum += color * filterKernel[idx];
@@ -882,7 +882,7 @@ type_single filter_sum_single_local_1x7(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -916,7 +916,7 @@ type_single filter_sum_single_local_1x7(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -931,7 +931,7 @@ type_single filter_sum_single_local_1x7(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -954,7 +954,7 @@ type_single filter_sum_single_local_1x7(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_1x7; x <= COLS_HALF_1x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x7) * COLS_1x7 + x + COLS_HALF_1x7;
             sum += color * filterKernel[idx];
@@ -1006,7 +1006,7 @@ type_single filter_sum_single_local_1x9(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1040,7 +1040,7 @@ type_single filter_sum_single_local_1x9(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -1055,7 +1055,7 @@ type_single filter_sum_single_local_1x9(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -1078,7 +1078,7 @@ type_single filter_sum_single_local_1x9(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_1x9; x <= COLS_HALF_1x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x9) * COLS_1x9 + x + COLS_HALF_1x9;
             sum += color * filterKernel[idx];
@@ -1130,7 +1130,7 @@ type_single filter_sum_single_local_3x1(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1164,7 +1164,7 @@ type_single filter_sum_single_local_3x1(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -1179,7 +1179,7 @@ type_single filter_sum_single_local_3x1(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -1202,7 +1202,7 @@ type_single filter_sum_single_local_3x1(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_3x1; x <= COLS_HALF_3x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x1) * COLS_3x1 + x + COLS_HALF_3x1;
             sum += color * filterKernel[idx];
@@ -1254,7 +1254,7 @@ type_single filter_sum_single_local_5x1(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1288,7 +1288,7 @@ type_single filter_sum_single_local_5x1(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -1303,7 +1303,7 @@ type_single filter_sum_single_local_5x1(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -1326,7 +1326,7 @@ type_single filter_sum_single_local_5x1(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_5x1; x <= COLS_HALF_5x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x1) * COLS_5x1 + x + COLS_HALF_5x1;
             sum += color * filterKernel[idx];
@@ -1378,7 +1378,7 @@ type_single filter_sum_single_local_7x1(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1412,7 +1412,7 @@ type_single filter_sum_single_local_7x1(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -1427,7 +1427,7 @@ type_single filter_sum_single_local_7x1(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -1450,7 +1450,7 @@ type_single filter_sum_single_local_7x1(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_7x1; x <= COLS_HALF_7x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x1) * COLS_7x1 + x + COLS_HALF_7x1;
             sum += color * filterKernel[idx];
@@ -1502,7 +1502,7 @@ type_single filter_sum_single_local_9x1(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1536,7 +1536,7 @@ type_single filter_sum_single_local_9x1(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -1551,7 +1551,7 @@ type_single filter_sum_single_local_9x1(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -1574,7 +1574,7 @@ type_single filter_sum_single_local_9x1(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_9x1; x <= COLS_HALF_9x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x1) * COLS_9x1 + x + COLS_HALF_9x1;
             sum += color * filterKernel[idx];
@@ -1629,7 +1629,7 @@ type_double filter_sum_double_local(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1663,7 +1663,7 @@ type_double filter_sum_double_local(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_21x21 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -1678,7 +1678,7 @@ type_double filter_sum_double_local(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_21x21 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -1701,7 +1701,7 @@ type_double filter_sum_double_local(read_only image1d_buffer_t imgIn,
         for (int x = -filterColsHalf; x <= filterColsHalf; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_21x21 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_21x21 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + filterRowsHalf) * filterCols + x + filterColsHalf;
             sum.x += color * filterKernel1[idx];
@@ -1762,7 +1762,7 @@ type_double filter_sum_double_local_3x3(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1796,7 +1796,7 @@ type_double filter_sum_double_local_3x3(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -1811,7 +1811,7 @@ type_double filter_sum_double_local_3x3(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -1834,7 +1834,7 @@ type_double filter_sum_double_local_3x3(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_3x3; x <= COLS_HALF_3x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x3) * COLS_3x3 + x + COLS_HALF_3x3;
             sum.x += color * filterKernel1[idx];
@@ -1888,7 +1888,7 @@ type_double filter_sum_double_local_5x5(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1922,7 +1922,7 @@ type_double filter_sum_double_local_5x5(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -1937,7 +1937,7 @@ type_double filter_sum_double_local_5x5(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -1960,7 +1960,7 @@ type_double filter_sum_double_local_5x5(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_5x5; x <= COLS_HALF_5x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x5) * COLS_5x5 + x + COLS_HALF_5x5;
             sum.x += color * filterKernel1[idx];
@@ -2014,7 +2014,7 @@ type_double filter_sum_double_local_7x7(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2048,7 +2048,7 @@ type_double filter_sum_double_local_7x7(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -2063,7 +2063,7 @@ type_double filter_sum_double_local_7x7(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -2086,7 +2086,7 @@ type_double filter_sum_double_local_7x7(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_7x7; x <= COLS_HALF_7x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x7) * COLS_7x7 + x + COLS_HALF_7x7;
             sum.x += color * filterKernel1[idx];
@@ -2140,7 +2140,7 @@ type_double filter_sum_double_local_9x9(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2174,7 +2174,7 @@ type_double filter_sum_double_local_9x9(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -2189,7 +2189,7 @@ type_double filter_sum_double_local_9x9(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -2212,7 +2212,7 @@ type_double filter_sum_double_local_9x9(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_9x9; x <= COLS_HALF_9x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x9) * COLS_9x9 + x + COLS_HALF_9x9;
             sum.x += color * filterKernel1[idx];
@@ -2267,7 +2267,7 @@ type_double filter_sum_double_local_1x3(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x3 * LOCAL_SIZE_ROWS_1x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2301,7 +2301,7 @@ type_double filter_sum_double_local_1x3(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -2316,7 +2316,7 @@ type_double filter_sum_double_local_1x3(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x3 + xBase, y - ROWS_HALF_1x3 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x3 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -2339,7 +2339,7 @@ type_double filter_sum_double_local_1x3(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_1x3; x <= COLS_HALF_1x3; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x3 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x3 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x3) * COLS_1x3 + x + COLS_HALF_1x3;
             sum.x += color * filterKernel1[idx];
@@ -2396,7 +2396,7 @@ type_double filter_sum_double_local_1x5(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x5 * LOCAL_SIZE_ROWS_1x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2430,7 +2430,7 @@ type_double filter_sum_double_local_1x5(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -2445,7 +2445,7 @@ type_double filter_sum_double_local_1x5(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x5 + xBase, y - ROWS_HALF_1x5 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x5 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -2468,7 +2468,7 @@ type_double filter_sum_double_local_1x5(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_1x5; x <= COLS_HALF_1x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x5) * COLS_1x5 + x + COLS_HALF_1x5;
             sum.x += color * filterKernel1[idx];
@@ -2525,7 +2525,7 @@ type_double filter_sum_double_local_1x7(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x7 * LOCAL_SIZE_ROWS_1x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2559,7 +2559,7 @@ type_double filter_sum_double_local_1x7(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -2574,7 +2574,7 @@ type_double filter_sum_double_local_1x7(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x7 + xBase, y - ROWS_HALF_1x7 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x7 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -2597,7 +2597,7 @@ type_double filter_sum_double_local_1x7(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_1x7; x <= COLS_HALF_1x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x7) * COLS_1x7 + x + COLS_HALF_1x7;
             sum.x += color * filterKernel1[idx];
@@ -2654,7 +2654,7 @@ type_double filter_sum_double_local_1x9(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_1x9 * LOCAL_SIZE_ROWS_1x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2688,7 +2688,7 @@ type_double filter_sum_double_local_1x9(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_1x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -2703,7 +2703,7 @@ type_double filter_sum_double_local_1x9(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_1x9 + xBase, y - ROWS_HALF_1x9 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_1x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_1x9 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -2726,7 +2726,7 @@ type_double filter_sum_double_local_1x9(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_1x9; x <= COLS_HALF_1x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_1x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_1x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_1x9) * COLS_1x9 + x + COLS_HALF_1x9;
             sum.x += color * filterKernel1[idx];
@@ -2783,7 +2783,7 @@ type_double filter_sum_double_local_3x1(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x1 * LOCAL_SIZE_ROWS_3x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2817,7 +2817,7 @@ type_double filter_sum_double_local_3x1(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -2832,7 +2832,7 @@ type_double filter_sum_double_local_3x1(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_3x1 + xBase, y - ROWS_HALF_3x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -2855,7 +2855,7 @@ type_double filter_sum_double_local_3x1(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_3x1; x <= COLS_HALF_3x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_3x1) * COLS_3x1 + x + COLS_HALF_3x1;
             sum.x += color * filterKernel1[idx];
@@ -2912,7 +2912,7 @@ type_double filter_sum_double_local_5x1(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x1 * LOCAL_SIZE_ROWS_5x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -2946,7 +2946,7 @@ type_double filter_sum_double_local_5x1(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -2961,7 +2961,7 @@ type_double filter_sum_double_local_5x1(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_5x1 + xBase, y - ROWS_HALF_5x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -2984,7 +2984,7 @@ type_double filter_sum_double_local_5x1(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_5x1; x <= COLS_HALF_5x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x1) * COLS_5x1 + x + COLS_HALF_5x1;
             sum.x += color * filterKernel1[idx];
@@ -3041,7 +3041,7 @@ type_double filter_sum_double_local_7x1(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x1 * LOCAL_SIZE_ROWS_7x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -3075,7 +3075,7 @@ type_double filter_sum_double_local_7x1(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -3090,7 +3090,7 @@ type_double filter_sum_double_local_7x1(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_7x1 + xBase, y - ROWS_HALF_7x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -3113,7 +3113,7 @@ type_double filter_sum_double_local_7x1(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_7x1; x <= COLS_HALF_7x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x1) * COLS_7x1 + x + COLS_HALF_7x1;
             sum.x += color * filterKernel1[idx];
@@ -3170,7 +3170,7 @@ type_double filter_sum_double_local_9x1(read_only image1d_buffer_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x1 * LOCAL_SIZE_ROWS_9x1];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -3204,7 +3204,7 @@ type_double filter_sum_double_local_9x1(read_only image1d_buffer_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
         }
     }
 #else
@@ -3219,7 +3219,7 @@ type_double filter_sum_double_local_9x1(read_only image1d_buffer_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int3 coordBorder = borderCoordinate((int3)(x - COLS_HALF_9x1 + xBase, y - ROWS_HALF_9x1 + yBase, coordBase.z), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x1 + x] = readValue1D(imgIn,  locationLookup, coordBorder.z, coordBorder.x, coordBorder.y);   // Fill local buffer
     }
 #endif
         
@@ -3242,7 +3242,7 @@ type_double filter_sum_double_local_9x1(read_only image1d_buffer_t imgIn,
         for (int x = -COLS_HALF_9x1; x <= COLS_HALF_9x1; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x1 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x1 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x1) * COLS_9x1 + x + COLS_HALF_9x1;
             sum.x += color * filterKernel1[idx];
@@ -48,10 +48,22 @@ int2 borderCoordinate(int2 coord, int rows, int cols, int border)
     return coordAdjusted;
 }
 
+// Memory access of the bandwidth probes (filter_probes.cl)
+#define PROBE_SRC_TYPE read_only image2d_t
+#define PROBE_DST_TYPE write_only image2d_t
+#define PROBE_READ(x, y, z) read_imagef(src, sampler, (int2)(x, y)).x
+#define PROBE_WRITE(x, y, z, v) write_imagef(dst, (int2)(x, y), (float4)(v))
+
 #include "filter_images_normal.cl"
 #include "filter_images_local.cl"
 #include "filter_images_predefined-normal.cl"
 #include "filter_images_predefined-local.cl"
+#include "filter_images_dilated.cl"
+#include "filter_images_multi_sigma.cl"
+#include "filter_images_sliding.cl"
+#include "filter_images_winograd.cl"
+#include "filter_probes.cl"
+#include "filter_overhead.cl"
 
 /**
  * @see https://github.com/opencv/opencv/blob/master/modules/imgproc/src/opencl/resize.cl
@@ -101,3 +113,15 @@ kernel void fed_resize(read_only image2d_t imgSrc,
         //storepix(convertToT(convertToWT2V(sum) * (WT2V)(SCALE)), dst + mad24(dx, TSIZE, dst_index));
     }
 }
+
+/**
+ * Adds two images pixel-wise (e.g. to sum up the responses of several separable filters).
+ */
+kernel void add_images(read_only image2d_t imgIn1,
+                       read_only image2d_t imgIn2,
+                       write_only image2d_t imgOut)
+{
+    const int2 coord = (int2)(get_global_id(0), get_global_id(1));
+
+    write_imagef(imgOut, coord, read_imagef(imgIn1, sampler, coord).x + read_imagef(imgIn2, sampler, coord).x);
+}
@@ -4,3 +4,4 @@
 #define ROWS_HALF_NxN // GENERATE_N-HALF
 #define LOCAL_SIZE_COLS_NxN // GENERATE_LOCAL_SIZE_COLS
 #define LOCAL_SIZE_ROWS_NxN // GENERATE_LOCAL_SIZE_ROWS
+#define LOCAL_STRIDE_NxN // GENERATE_LOCAL_STRIDE
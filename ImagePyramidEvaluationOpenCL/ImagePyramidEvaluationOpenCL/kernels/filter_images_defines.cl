@@ -7,6 +7,7 @@
 #define ROWS_HALF_3x3 1
 #define LOCAL_SIZE_COLS_3x3 18 // 16 + 2 * 1
 #define LOCAL_SIZE_ROWS_3x3 18 // 16 + 2 * 1
+#define LOCAL_STRIDE_3x3 19 // 18 padded to an odd stride
 
 #define COLS_5x5 5
 #define COLS_HALF_5x5 2
@@ -14,6 +15,7 @@
 #define ROWS_HALF_5x5 2
 #define LOCAL_SIZE_COLS_5x5 20 // 16 + 2 * 2
 #define LOCAL_SIZE_ROWS_5x5 20 // 16 + 2 * 2
+#define LOCAL_STRIDE_5x5 21 // 20 padded to an odd stride
 
 #define COLS_7x7 7
 #define COLS_HALF_7x7 3
@@ -21,6 +23,7 @@
 #define ROWS_HALF_7x7 3
 #define LOCAL_SIZE_COLS_7x7 22 // 16 + 2 * 3
 #define LOCAL_SIZE_ROWS_7x7 22 // 16 + 2 * 3
+#define LOCAL_STRIDE_7x7 23 // 22 padded to an odd stride
 
 #define COLS_9x9 9
 #define COLS_HALF_9x9 4
@@ -28,10 +31,12 @@
 #define ROWS_HALF_9x9 4
 #define LOCAL_SIZE_COLS_9x9 24 // 16 + 2 * 4
 #define LOCAL_SIZE_ROWS_9x9 24 // 16 + 2 * 4
+#define LOCAL_STRIDE_9x9 25 // 24 padded to an odd stride
 
 // Max possible filter size with local memory (arbitrary chosen)
 #define LOCAL_SIZE_COLS_21x21 36 // 16 + 2 * 10
 #define LOCAL_SIZE_ROWS_21x21 36 // 16 + 2 * 10
+#define LOCAL_STRIDE_21x21 37 // 36 padded to an odd stride
 
 // Separation filter
 #define COLS_1x3 3
@@ -40,6 +45,7 @@
 #define ROWS_HALF_1x3 0
 #define LOCAL_SIZE_COLS_1x3 18 // 16 + 2 * 1
 #define LOCAL_SIZE_ROWS_1x3 16 // 16
+#define LOCAL_STRIDE_1x3 19 // 18 padded to an odd stride
 
 #define COLS_1x5 5
 #define COLS_HALF_1x5 2
@@ -47,6 +53,7 @@
 #define ROWS_HALF_1x5 0
 #define LOCAL_SIZE_COLS_1x5 20 // 16 + 2 * 2
 #define LOCAL_SIZE_ROWS_1x5 16 // 16
+#define LOCAL_STRIDE_1x5 21 // 20 padded to an odd stride
 
 #define COLS_1x7 7
 #define COLS_HALF_1x7 3
@@ -54,6 +61,7 @@
 #define ROWS_HALF_1x7 0
 #define LOCAL_SIZE_COLS_1x7 22 // 16 + 2 * 3
 #define LOCAL_SIZE_ROWS_1x7 16 // 16
+#define LOCAL_STRIDE_1x7 23 // 22 padded to an odd stride
 
 #define COLS_1x9 9
 #define COLS_HALF_1x9 4
@@ -61,6 +69,7 @@
 #define ROWS_HALF_1x9 0
 #define LOCAL_SIZE_COLS_1x9 24 // 16 + 2 * 4
 #define LOCAL_SIZE_ROWS_1x9 16 // 16
+#define LOCAL_STRIDE_1x9 25 // 24 padded to an odd stride
 
 #define COLS_3x1 1
 #define COLS_HALF_3x1 0
@@ -68,6 +77,7 @@
 #define ROWS_HALF_3x1 1
 #define LOCAL_SIZE_COLS_3x1 16 // 16
 #define LOCAL_SIZE_ROWS_3x1 18 // 16 + 2 * 1
+#define LOCAL_STRIDE_3x1 17 // 16 padded to an odd stride
 
 #define COLS_5x1 1
 #define COLS_HALF_5x1 0
@@ -75,6 +85,7 @@
 #define ROWS_HALF_5x1 2
 #define LOCAL_SIZE_COLS_5x1 16 // 16
 #define LOCAL_SIZE_ROWS_5x1 20 // 16 + 2 * 2
+#define LOCAL_STRIDE_5x1 17 // 16 padded to an odd stride
 
 #define COLS_7x1 1
 #define COLS_HALF_7x1 0
@@ -82,6 +93,7 @@
 #define ROWS_HALF_7x1 3
 #define LOCAL_SIZE_COLS_7x1 16 // 16
 #define LOCAL_SIZE_ROWS_7x1 22 // 16 + 2 * 3
+#define LOCAL_STRIDE_7x1 17 // 16 padded to an odd stride
 
 #define COLS_9x1 1
 #define COLS_HALF_9x1 0
@@ -89,3 +101,4 @@
 #define ROWS_HALF_9x1 4
 #define LOCAL_SIZE_COLS_9x1 16 // 16
 #define LOCAL_SIZE_ROWS_9x1 24 // 16 + 2 * 4
+#define LOCAL_STRIDE_9x1 17 // 16 padded to an odd stride
@@ -0,0 +1,105 @@
+// Derivatives for all sigma sizes (1-4) computed from one image patch in local memory. The largest derivative filter (9x9) determines the size of the patch
+
+/**
+ * Calculates the derivative responses for one sigma size from the image patch in local memory.
+ *
+ * The derivative filters only have non-zero values at the offsets -s, 0 and s (with s being the sigma size), i.e. Gx = smoothing (column) * (-1, 0, 1) (row) and
+ * Gy = (-1, 0, 1) (column) * smoothing (row). Only these 6 taps per filter are read from the local buffer.
+ *
+ * @param localBuffer image patch including the padding for a 9x9 filter
+ * @param coordBase position of the current pixel in the local buffer
+ * @param s sigma size (distance of the taps to the centre)
+ * @param smoothing value of the smoothing vector at the border (x) and the centre (y)
+ * @return derivative responses in x- (x) and y-direction (y)
+ */
+type_double filter_sum_derivatives_sigma(local const float* localBuffer, const int2 coordBase, const int s, const float2 smoothing)
+{
+    const int idxCentre = coordBase.y * LOCAL_STRIDE_9x9 + coordBase.x;
+    const int idxTop = idxCentre - s * LOCAL_STRIDE_9x9;
+    const int idxBottom = idxCentre + s * LOCAL_STRIDE_9x9;
+
+    // Difference between the right and the left column (Gx) respectively the bottom and the top row (Gy)
+    const float diffXTop = localBuffer[idxTop + s] - localBuffer[idxTop - s];
+    const float diffXCentre = localBuffer[idxCentre + s] - localBuffer[idxCentre - s];
+    const float diffXBottom = localBuffer[idxBottom + s] - localBuffer[idxBottom - s];
+
+    const float diffYLeft = localBuffer[idxBottom - s] - localBuffer[idxTop - s];
+    const float diffYCentre = localBuffer[idxBottom] - localBuffer[idxTop];
+    const float diffYRight = localBuffer[idxBottom + s] - localBuffer[idxTop + s];
+
+    type_double sum;
+    sum.x = smoothing.x * (diffXTop + diffXBottom) + smoothing.y * diffXCentre;
+    sum.y = smoothing.x * (diffYLeft + diffYRight) + smoothing.y * diffYCentre;
+
+    return sum;
+}
+
+/**
+ * Filter kernel which calculates the derivatives in x- and y-direction for the sigma sizes 1-4 using local memory supposed to be called from the host.
+ * The image patch is loaded only once for all 8 filter responses.
+ *
+ * @param imgIn input image
+ * @param imgOutGx1 image containing the Gx filter response for the sigma size 1 (imgOutGx2, imgOutGx3, imgOutGx4 analogous)
+ * @param imgOutGy1 image containing the Gy filter response for the sigma size 1 (imgOutGy2, imgOutGy3, imgOutGy4 analogous)
+ * @param smoothingCoefficients value of the smoothing vector at the border (x) and the centre (y) for each sigma size (index = sigma size - 1)
+ * @param border int value which specifies how out-of-border accesses should be handled. The values correspond to the OpenCV border types
+ */
+kernel void filter_derivatives_multi_sigma_local(read_only image2d_t imgIn,
+                                                 write_only image2d_t imgOutGx1,
+                                                 write_only image2d_t imgOutGx2,
+                                                 write_only image2d_t imgOutGx3,
+                                                 write_only image2d_t imgOutGx4,
+                                                 write_only image2d_t imgOutGy1,
+                                                 write_only image2d_t imgOutGy2,
+                                                 write_only image2d_t imgOutGy3,
+                                                 write_only image2d_t imgOutGy4,
+                                                 constant float2* smoothingCoefficients,
+                                                 const int border)
+{
+    const int rows = get_image_height(imgIn);
+    const int cols = get_image_width(imgIn);
+
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+
+    int2 coordBase = (int2)(get_global_id(0), get_global_id(1));
+
+    int xLocalId = get_local_id(0);
+    int yLocalId = get_local_id(1);
+
+    int xLocalSize = get_local_size(0);
+    int yLocalSize = get_local_size(1);
+
+    // The top left pixel in the current patch is the base for every work-item in the work-group
+    int xBase = coordBase.x - xLocalId;
+    int yBase = coordBase.y - yLocalId;
+
+    // Copy the image patch including the padding from global to local memory (same pattern as in filter_single_local_9x9)
+    for (int y = yLocalId; y < yLocalSize + 2 * ROWS_HALF_9x9; y += yLocalSize)
+    {
+        for (int x = xLocalId; x < xLocalSize + 2 * COLS_HALF_9x9; x += xLocalSize)
+        {
+            // Coordinate from the image patch which must be stored in the current local buffer position
+            int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        }
+    }
+
+    // Wait until the image patch is loaded in local memory
+    work_group_barrier(CLK_LOCAL_MEM_FENCE);
+
+    const int2 coordLocal = (int2)(xLocalId + COLS_HALF_9x9, yLocalId + ROWS_HALF_9x9);
+
+    type_double sum1 = filter_sum_derivatives_sigma(localBuffer, coordLocal, 1, smoothingCoefficients[0]);
+    type_double sum2 = filter_sum_derivatives_sigma(localBuffer, coordLocal, 2, smoothingCoefficients[1]);
+    type_double sum3 = filter_sum_derivatives_sigma(localBuffer, coordLocal, 3, smoothingCoefficients[2]);
+    type_double sum4 = filter_sum_derivatives_sigma(localBuffer, coordLocal, 4, smoothingCoefficients[3]);
+
+    write_imagef(imgOutGx1, coordBase, sum1.x);
+    write_imagef(imgOutGx2, coordBase, sum2.x);
+    write_imagef(imgOutGx3, coordBase, sum3.x);
+    write_imagef(imgOutGx4, coordBase, sum4.x);
+    write_imagef(imgOutGy1, coordBase, sum1.y);
+    write_imagef(imgOutGy2, coordBase, sum2.y);
+    write_imagef(imgOutGy3, coordBase, sum3.y);
+    write_imagef(imgOutGy4, coordBase, sum4.y);
+}
@@ -21,7 +21,7 @@ type_single filter_sum_single_local(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -55,7 +55,7 @@ type_single filter_sum_single_local(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -70,7 +70,7 @@ type_single filter_sum_single_local(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -93,7 +93,7 @@ type_single filter_sum_single_local(read_only image2d_t imgIn,
         for (int x = -filterColsHalf; x <= filterColsHalf; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_21x21 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_21x21 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + filterRowsHalf) * filterCols + x + filterColsHalf;
             sum += color * filterKernel[idx];
@@ -279,7 +279,7 @@ type_single filter_sum_single_local_5x5(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -313,7 +313,7 @@ type_single filter_sum_single_local_5x5(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -328,7 +328,7 @@ type_single filter_sum_single_local_5x5(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -351,7 +351,7 @@ type_single filter_sum_single_local_5x5(read_only image2d_t imgIn,
         for (int x = -COLS_HALF_5x5; x <= COLS_HALF_5x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x5) * COLS_5x5 + x + COLS_HALF_5x5;
             sum += color * filterKernel[idx];
@@ -401,7 +401,7 @@ type_single filter_sum_single_local_7x7(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -435,7 +435,7 @@ type_single filter_sum_single_local_7x7(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -450,7 +450,7 @@ type_single filter_sum_single_local_7x7(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -473,7 +473,7 @@ type_single filter_sum_single_local_7x7(read_only image2d_t imgIn,
         for (int x = -COLS_HALF_7x7; x <= COLS_HALF_7x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x7) * COLS_7x7 + x + COLS_HALF_7x7;
             sum += color * filterKernel[idx];
@@ -523,7 +523,7 @@ type_single filter_sum_single_local_9x9(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -557,7 +557,7 @@ type_single filter_sum_single_local_9x9(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -572,7 +572,7 @@ type_single filter_sum_single_local_9x9(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -595,7 +595,7 @@ type_single filter_sum_single_local_9x9(read_only image2d_t imgIn,
         for (int x = -COLS_HALF_9x9; x <= COLS_HALF_9x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x9) * COLS_9x9 + x + COLS_HALF_9x9;
             sum += color * filterKernel[idx];
@@ -649,7 +649,7 @@ type_double filter_sum_double_local(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_21x21 * LOCAL_SIZE_ROWS_21x21];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -683,7 +683,7 @@ type_double filter_sum_double_local(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -698,7 +698,7 @@ type_double filter_sum_double_local(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - filterColsHalf + xBase, y - filterRowsHalf + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_21x21 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -721,7 +721,7 @@ type_double filter_sum_double_local(read_only image2d_t imgIn,
         for (int x = -filterColsHalf; x <= filterColsHalf; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_21x21 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_21x21 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + filterRowsHalf) * filterCols + x + filterColsHalf;
             sum.x += color * filterKernel1[idx];
@@ -922,7 +922,7 @@ type_double filter_sum_double_local_5x5(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -956,7 +956,7 @@ type_double filter_sum_double_local_5x5(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -971,7 +971,7 @@ type_double filter_sum_double_local_5x5(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -994,7 +994,7 @@ type_double filter_sum_double_local_5x5(read_only image2d_t imgIn,
         for (int x = -COLS_HALF_5x5; x <= COLS_HALF_5x5; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_5x5) * COLS_5x5 + x + COLS_HALF_5x5;
             sum.x += color * filterKernel1[idx];
@@ -1049,7 +1049,7 @@ type_double filter_sum_double_local_7x7(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1083,7 +1083,7 @@ type_double filter_sum_double_local_7x7(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1098,7 +1098,7 @@ type_double filter_sum_double_local_7x7(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1121,7 +1121,7 @@ type_double filter_sum_double_local_7x7(read_only image2d_t imgIn,
         for (int x = -COLS_HALF_7x7; x <= COLS_HALF_7x7; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_7x7) * COLS_7x7 + x + COLS_HALF_7x7;
             sum.x += color * filterKernel1[idx];
@@ -1176,7 +1176,7 @@ type_double filter_sum_double_local_9x9(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1210,7 +1210,7 @@ type_double filter_sum_double_local_9x9(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1225,7 +1225,7 @@ type_double filter_sum_double_local_9x9(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1248,7 +1248,7 @@ type_double filter_sum_double_local_9x9(read_only image2d_t imgIn,
         for (int x = -COLS_HALF_9x9; x <= COLS_HALF_9x9; ++x)
         {
             coordCurrent.x = coordBase.x + x;
-            color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];    // Read from local buffer
+            color = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];    // Read from local buffer
 
             const int idx = (y + ROWS_HALF_9x9) * COLS_9x9 + x + COLS_HALF_9x9;
             sum.x += color * filterKernel1[idx];
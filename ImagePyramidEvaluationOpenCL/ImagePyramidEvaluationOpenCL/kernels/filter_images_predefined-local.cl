@@ -16,7 +16,7 @@ type_single filter_sum_single_local_Gx_3x3(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -50,7 +50,7 @@ type_single filter_sum_single_local_Gx_3x3(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -65,7 +65,7 @@ type_single filter_sum_single_local_Gx_3x3(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -76,30 +76,26 @@ type_single filter_sum_single_local_Gx_3x3(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_3x3, yLocalId + ROWS_HALF_3x3);
     int2 coordCurrent;
-    float color;
     type_single sum = (type_single)(0.0f);
 
 	coordCurrent.y = coordBase.y + -1;
 	coordCurrent.x = coordBase.x + -1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * -3.0f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * 3.0f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * -10.0f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * 10.0f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 1;
 	coordCurrent.x = coordBase.x + -1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * -3.0f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * 3.0f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
+
+	sum -= (color0 - color1 + color4 - color5) * 3.0f;
+	sum -= (color2 - color3) * 10.0f;
 
     return sum;
 }
@@ -139,7 +135,7 @@ type_single filter_sum_single_local_Gx_5x5(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -173,7 +169,7 @@ type_single filter_sum_single_local_Gx_5x5(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -188,7 +184,7 @@ type_single filter_sum_single_local_Gx_5x5(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -199,30 +195,26 @@ type_single filter_sum_single_local_Gx_5x5(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_5x5, yLocalId + ROWS_HALF_5x5);
     int2 coordCurrent;
-    float color;
     type_single sum = (type_single)(0.0f);
 
 	coordCurrent.y = coordBase.y + -2;
 	coordCurrent.x = coordBase.x + -2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * -0.0468750037f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * 0.0468750037f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * -0.156250015f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * 0.156250015f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 2;
 	coordCurrent.x = coordBase.x + -2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * -0.0468750037f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * 0.0468750037f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
+
+	sum -= (color0 - color1 + color4 - color5) * 0.0468750037f;
+	sum -= (color2 - color3) * 0.156250015f;
 
     return sum;
 }
@@ -262,7 +254,7 @@ type_single filter_sum_single_local_Gx_7x7(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -296,7 +288,7 @@ type_single filter_sum_single_local_Gx_7x7(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -311,7 +303,7 @@ type_single filter_sum_single_local_Gx_7x7(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -322,30 +314,26 @@ type_single filter_sum_single_local_Gx_7x7(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_7x7, yLocalId + ROWS_HALF_7x7);
     int2 coordCurrent;
-    float color;
     type_single sum = (type_single)(0.0f);
 
 	coordCurrent.y = coordBase.y + -3;
 	coordCurrent.x = coordBase.x + -3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * -0.0312500037f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * 0.0312500037f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * -0.104166679f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * 0.104166679f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 3;
 	coordCurrent.x = coordBase.x + -3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * -0.0312500037f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * 0.0312500037f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
+
+	sum -= (color0 - color1 + color4 - color5) * 0.0312500037f;
+	sum -= (color2 - color3) * 0.104166679f;
 
     return sum;
 }
@@ -385,7 +373,7 @@ type_single filter_sum_single_local_Gx_9x9(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -419,7 +407,7 @@ type_single filter_sum_single_local_Gx_9x9(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -434,7 +422,7 @@ type_single filter_sum_single_local_Gx_9x9(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -445,30 +433,26 @@ type_single filter_sum_single_local_Gx_9x9(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_9x9, yLocalId + ROWS_HALF_9x9);
     int2 coordCurrent;
-    float color;
     type_single sum = (type_single)(0.0f);
 
 	coordCurrent.y = coordBase.y + -4;
 	coordCurrent.x = coordBase.x + -4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * -0.0234375019f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * 0.0234375019f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * -0.0781250075f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * 0.0781250075f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 4;
 	coordCurrent.x = coordBase.x + -4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * -0.0234375019f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * 0.0234375019f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
+
+	sum -= (color0 - color1 + color4 - color5) * 0.0234375019f;
+	sum -= (color2 - color3) * 0.0781250075f;
 
     return sum;
 }
@@ -508,7 +492,7 @@ type_single filter_sum_single_local_Gy_3x3(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -542,7 +526,7 @@ type_single filter_sum_single_local_Gy_3x3(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -557,7 +541,7 @@ type_single filter_sum_single_local_Gy_3x3(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -568,29 +552,25 @@ type_single filter_sum_single_local_Gy_3x3(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_3x3, yLocalId + ROWS_HALF_3x3);
     int2 coordCurrent;
-    float color;
     type_single sum = (type_single)(0.0f);
 
 	coordCurrent.y = coordBase.y + -1;
 	coordCurrent.x = coordBase.x + -1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * -3.0f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * -10.0f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * -3.0f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 1;
 	coordCurrent.x = coordBase.x + -1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * 3.0f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * 10.0f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum += color * 3.0f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
+
+	sum -= (color0 + color2 - color3 - color5) * 3.0f;
+	sum -= (color1 - color4) * 10.0f;
 
     return sum;
 }
@@ -630,7 +610,7 @@ type_single filter_sum_single_local_Gy_5x5(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -664,7 +644,7 @@ type_single filter_sum_single_local_Gy_5x5(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -679,7 +659,7 @@ type_single filter_sum_single_local_Gy_5x5(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -690,29 +670,25 @@ type_single filter_sum_single_local_Gy_5x5(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_5x5, yLocalId + ROWS_HALF_5x5);
     int2 coordCurrent;
-    float color;
     type_single sum = (type_single)(0.0f);
 
 	coordCurrent.y = coordBase.y + -2;
 	coordCurrent.x = coordBase.x + -2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * -0.0468750037f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * -0.156250015f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * -0.0468750037f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 2;
 	coordCurrent.x = coordBase.x + -2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * 0.0468750037f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * 0.156250015f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum += color * 0.0468750037f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
+
+	sum -= (color0 + color2 - color3 - color5) * 0.0468750037f;
+	sum -= (color1 - color4) * 0.156250015f;
 
     return sum;
 }
@@ -752,7 +728,7 @@ type_single filter_sum_single_local_Gy_7x7(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -786,7 +762,7 @@ type_single filter_sum_single_local_Gy_7x7(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -801,7 +777,7 @@ type_single filter_sum_single_local_Gy_7x7(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -812,29 +788,25 @@ type_single filter_sum_single_local_Gy_7x7(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_7x7, yLocalId + ROWS_HALF_7x7);
     int2 coordCurrent;
-    float color;
     type_single sum = (type_single)(0.0f);
 
 	coordCurrent.y = coordBase.y + -3;
 	coordCurrent.x = coordBase.x + -3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * -0.0312500037f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * -0.104166679f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * -0.0312500037f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 3;
 	coordCurrent.x = coordBase.x + -3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * 0.0312500037f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * 0.104166679f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum += color * 0.0312500037f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
+
+	sum -= (color0 + color2 - color3 - color5) * 0.0312500037f;
+	sum -= (color1 - color4) * 0.104166679f;
 
     return sum;
 }
@@ -874,7 +846,7 @@ type_single filter_sum_single_local_Gy_9x9(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -908,7 +880,7 @@ type_single filter_sum_single_local_Gy_9x9(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -923,7 +895,7 @@ type_single filter_sum_single_local_Gy_9x9(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -934,29 +906,25 @@ type_single filter_sum_single_local_Gy_9x9(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_9x9, yLocalId + ROWS_HALF_9x9);
     int2 coordCurrent;
-    float color;
     type_single sum = (type_single)(0.0f);
 
 	coordCurrent.y = coordBase.y + -4;
 	coordCurrent.x = coordBase.x + -4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * -0.0234375019f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * -0.0781250075f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * -0.0234375019f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 4;
 	coordCurrent.x = coordBase.x + -4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * 0.0234375019f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * 0.0781250075f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum += color * 0.0234375019f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
+
+	sum -= (color0 + color2 - color3 - color5) * 0.0234375019f;
+	sum -= (color1 - color4) * 0.0781250075f;
 
     return sum;
 }
@@ -996,7 +964,7 @@ type_double filter_sum_double_local_GxGy_3x3(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_3x3 * LOCAL_SIZE_ROWS_3x3];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1030,7 +998,7 @@ type_double filter_sum_double_local_GxGy_3x3(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1045,7 +1013,7 @@ type_double filter_sum_double_local_GxGy_3x3(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_3x3 + xBase, y - ROWS_HALF_3x3 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_3x3 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1056,40 +1024,32 @@ type_double filter_sum_double_local_GxGy_3x3(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_3x3, yLocalId + ROWS_HALF_3x3);
     int2 coordCurrent;
-    float color;
     type_double sum = (type_double)(0.0f, 0.0f);
 
 	coordCurrent.y = coordBase.y + -1;
 	coordCurrent.x = coordBase.x + -1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum.x += color * -3.0f;
-	sum.y += color * -3.0f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum.y += color * -10.0f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum.x += color * 3.0f;
-	sum.y += color * -3.0f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum.x += color * -10.0f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum.x += color * 10.0f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 1;
 	coordCurrent.x = coordBase.x + -1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum.x += color * -3.0f;
-	sum.y += color * 3.0f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum.y += color * 10.0f;
+	const float color6 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 1;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_3x3 + coordCurrent.x];
-	sum.x += color * 3.0f;
-	sum.y += color * 3.0f;
+	const float color7 = localBuffer[coordCurrent.y * LOCAL_STRIDE_3x3 + coordCurrent.x];
+
+	sum.x -= (color0 - color2 + color5 - color7) * 3.0f;
+	sum.x -= (color3 - color4) * 10.0f;
+	sum.y -= (color0 + color2 - color5 - color7) * 3.0f;
+	sum.y -= (color1 - color6) * 10.0f;
 
     return sum;
 }
@@ -1131,7 +1091,7 @@ type_double filter_sum_double_local_GxGy_5x5(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_5x5 * LOCAL_SIZE_ROWS_5x5];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1165,7 +1125,7 @@ type_double filter_sum_double_local_GxGy_5x5(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1180,7 +1140,7 @@ type_double filter_sum_double_local_GxGy_5x5(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_5x5 + xBase, y - ROWS_HALF_5x5 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_5x5 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1191,40 +1151,32 @@ type_double filter_sum_double_local_GxGy_5x5(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_5x5, yLocalId + ROWS_HALF_5x5);
     int2 coordCurrent;
-    float color;
     type_double sum = (type_double)(0.0f, 0.0f);
 
 	coordCurrent.y = coordBase.y + -2;
 	coordCurrent.x = coordBase.x + -2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum.x += color * -0.0468750037f;
-	sum.y += color * -0.0468750037f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum.y += color * -0.156250015f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum.x += color * 0.0468750037f;
-	sum.y += color * -0.0468750037f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum.x += color * -0.156250015f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum.x += color * 0.156250015f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 2;
 	coordCurrent.x = coordBase.x + -2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum.x += color * -0.0468750037f;
-	sum.y += color * 0.0468750037f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum.y += color * 0.156250015f;
+	const float color6 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 2;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_5x5 + coordCurrent.x];
-	sum.x += color * 0.0468750037f;
-	sum.y += color * 0.0468750037f;
+	const float color7 = localBuffer[coordCurrent.y * LOCAL_STRIDE_5x5 + coordCurrent.x];
+
+	sum.x -= (color0 - color2 + color5 - color7) * 0.0468750037f;
+	sum.x -= (color3 - color4) * 0.156250015f;
+	sum.y -= (color0 + color2 - color5 - color7) * 0.0468750037f;
+	sum.y -= (color1 - color6) * 0.156250015f;
 
     return sum;
 }
@@ -1266,7 +1218,7 @@ type_double filter_sum_double_local_GxGy_7x7(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_7x7 * LOCAL_SIZE_ROWS_7x7];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1300,7 +1252,7 @@ type_double filter_sum_double_local_GxGy_7x7(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1315,7 +1267,7 @@ type_double filter_sum_double_local_GxGy_7x7(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_7x7 + xBase, y - ROWS_HALF_7x7 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_7x7 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1326,40 +1278,32 @@ type_double filter_sum_double_local_GxGy_7x7(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_7x7, yLocalId + ROWS_HALF_7x7);
     int2 coordCurrent;
-    float color;
     type_double sum = (type_double)(0.0f, 0.0f);
 
 	coordCurrent.y = coordBase.y + -3;
 	coordCurrent.x = coordBase.x + -3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum.x += color * -0.0312500037f;
-	sum.y += color * -0.0312500037f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum.y += color * -0.104166679f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum.x += color * 0.0312500037f;
-	sum.y += color * -0.0312500037f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum.x += color * -0.104166679f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum.x += color * 0.104166679f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 3;
 	coordCurrent.x = coordBase.x + -3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum.x += color * -0.0312500037f;
-	sum.y += color * 0.0312500037f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum.y += color * 0.104166679f;
+	const float color6 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 3;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_7x7 + coordCurrent.x];
-	sum.x += color * 0.0312500037f;
-	sum.y += color * 0.0312500037f;
+	const float color7 = localBuffer[coordCurrent.y * LOCAL_STRIDE_7x7 + coordCurrent.x];
+
+	sum.x -= (color0 - color2 + color5 - color7) * 0.0312500037f;
+	sum.x -= (color3 - color4) * 0.104166679f;
+	sum.y -= (color0 + color2 - color5 - color7) * 0.0312500037f;
+	sum.y -= (color1 - color6) * 0.104166679f;
 
     return sum;
 }
@@ -1401,7 +1345,7 @@ type_double filter_sum_double_local_GxGy_9x9(read_only image2d_t imgIn,
 
     // The exact size must be known at compile time (no dynamic memory allocation possible)
     // Adjust according to the highest needed filter size or set via compile parameter
-    local float localBuffer[LOCAL_SIZE_COLS_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
+    local float localBuffer[LOCAL_STRIDE_9x9 * LOCAL_SIZE_ROWS_9x9];   // Allocate local buffer
 
     int xLocalId = get_local_id(0);
     int yLocalId = get_local_id(1);
@@ -1435,7 +1379,7 @@ type_double filter_sum_double_local_GxGy_9x9(read_only image2d_t imgIn,
         {
             // Coordinate from the image patch which must be stored in the current local buffer position
             int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
-            localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+            localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
         }
     }
 #else
@@ -1450,7 +1394,7 @@ type_double filter_sum_double_local_GxGy_9x9(read_only image2d_t imgIn,
         
         // Coordinate from the image patch which must be stored in the current local buffer position
         int2 coordBorder = borderCoordinate((int2)(x - COLS_HALF_9x9 + xBase, y - ROWS_HALF_9x9 + yBase), rows, cols, border);
-        localBuffer[y * LOCAL_SIZE_COLS_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
+        localBuffer[y * LOCAL_STRIDE_9x9 + x] = read_imagef(imgIn, sampler, coordBorder).x;   // Fill local buffer
     }
 #endif
         
@@ -1461,40 +1405,32 @@ type_double filter_sum_double_local_GxGy_9x9(read_only image2d_t imgIn,
     // Note that the local buffer contains all pixels which are read but only the inner part contains pixels where an output value is written
     coordBase = (int2)(xLocalId + COLS_HALF_9x9, yLocalId + ROWS_HALF_9x9);
     int2 coordCurrent;
-    float color;
     type_double sum = (type_double)(0.0f, 0.0f);
 
 	coordCurrent.y = coordBase.y + -4;
 	coordCurrent.x = coordBase.x + -4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum.x += color * -0.0234375019f;
-	sum.y += color * -0.0234375019f;
+	const float color0 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum.y += color * -0.0781250075f;
+	const float color1 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum.x += color * 0.0234375019f;
-	sum.y += color * -0.0234375019f;
+	const float color2 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum.x += color * -0.0781250075f;
+	const float color3 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum.x += color * 0.0781250075f;
+	const float color4 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.y = coordBase.y + 4;
 	coordCurrent.x = coordBase.x + -4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum.x += color * -0.0234375019f;
-	sum.y += color * 0.0234375019f;
+	const float color5 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum.y += color * 0.0781250075f;
+	const float color6 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
 	coordCurrent.x = coordBase.x + 4;
-	color = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_9x9 + coordCurrent.x];
-	sum.x += color * 0.0234375019f;
-	sum.y += color * 0.0234375019f;
+	const float color7 = localBuffer[coordCurrent.y * LOCAL_STRIDE_9x9 + coordCurrent.x];
+
+	sum.x -= (color0 - color2 + color5 - color7) * 0.0234375019f;
+	sum.x -= (color3 - color4) * 0.0781250075f;
+	sum.y -= (color0 + color2 - color5 - color7) * 0.0234375019f;
+	sum.y -= (color1 - color6) * 0.0781250075f;
 
     return sum;
 }
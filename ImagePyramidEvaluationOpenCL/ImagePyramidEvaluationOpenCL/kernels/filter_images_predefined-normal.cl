@@ -16,35 +16,31 @@ type_single filter_sum_single_Gx_3x3(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -1;
 	coordCurrent.x = coordBase.x + -1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -3.0f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 3.0f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -10.0f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 10.0f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 1;
 	coordCurrent.x = coordBase.x + -1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -3.0f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 3.0f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum -= (color0 - color1 + color4 - color5) * 3.0f;
+	sum -= (color2 - color3) * 10.0f;
 
     return sum;
 }
@@ -84,35 +80,31 @@ type_single filter_sum_single_Gx_5x5(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -2;
 	coordCurrent.x = coordBase.x + -2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0468750037f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0468750037f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.156250015f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.156250015f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 2;
 	coordCurrent.x = coordBase.x + -2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0468750037f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0468750037f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum -= (color0 - color1 + color4 - color5) * 0.0468750037f;
+	sum -= (color2 - color3) * 0.156250015f;
 
     return sum;
 }
@@ -152,35 +144,31 @@ type_single filter_sum_single_Gx_7x7(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -3;
 	coordCurrent.x = coordBase.x + -3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0312500037f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0312500037f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.104166679f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.104166679f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 3;
 	coordCurrent.x = coordBase.x + -3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0312500037f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0312500037f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum -= (color0 - color1 + color4 - color5) * 0.0312500037f;
+	sum -= (color2 - color3) * 0.104166679f;
 
     return sum;
 }
@@ -220,35 +208,31 @@ type_single filter_sum_single_Gx_9x9(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -4;
 	coordCurrent.x = coordBase.x + -4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0234375019f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0234375019f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0781250075f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0781250075f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 4;
 	coordCurrent.x = coordBase.x + -4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0234375019f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0234375019f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum -= (color0 - color1 + color4 - color5) * 0.0234375019f;
+	sum -= (color2 - color3) * 0.0781250075f;
 
     return sum;
 }
@@ -288,34 +272,30 @@ type_single filter_sum_single_Gy_3x3(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -1;
 	coordCurrent.x = coordBase.x + -1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -3.0f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -10.0f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -3.0f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 1;
 	coordCurrent.x = coordBase.x + -1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 3.0f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 10.0f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 3.0f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum -= (color0 + color2 - color3 - color5) * 3.0f;
+	sum -= (color1 - color4) * 10.0f;
 
     return sum;
 }
@@ -355,34 +335,30 @@ type_single filter_sum_single_Gy_5x5(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -2;
 	coordCurrent.x = coordBase.x + -2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0468750037f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.156250015f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0468750037f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 2;
 	coordCurrent.x = coordBase.x + -2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0468750037f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.156250015f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0468750037f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum -= (color0 + color2 - color3 - color5) * 0.0468750037f;
+	sum -= (color1 - color4) * 0.156250015f;
 
     return sum;
 }
@@ -422,34 +398,30 @@ type_single filter_sum_single_Gy_7x7(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -3;
 	coordCurrent.x = coordBase.x + -3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0312500037f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.104166679f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0312500037f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 3;
 	coordCurrent.x = coordBase.x + -3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0312500037f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.104166679f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0312500037f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum -= (color0 + color2 - color3 - color5) * 0.0312500037f;
+	sum -= (color1 - color4) * 0.104166679f;
 
     return sum;
 }
@@ -489,34 +461,30 @@ type_single filter_sum_single_Gy_9x9(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -4;
 	coordCurrent.x = coordBase.x + -4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0234375019f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0781250075f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * -0.0234375019f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 4;
 	coordCurrent.x = coordBase.x + -4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0234375019f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0781250075f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum += color * 0.0234375019f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum -= (color0 + color2 - color3 - color5) * 0.0234375019f;
+	sum -= (color1 - color4) * 0.0781250075f;
 
     return sum;
 }
@@ -556,47 +524,39 @@ type_double filter_sum_double_GxGy_3x3(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -1;
 	coordCurrent.x = coordBase.x + -1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -3.0f;
-	sum.y += color * -3.0f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.y += color * -10.0f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 3.0f;
-	sum.y += color * -3.0f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -10.0f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 10.0f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 1;
 	coordCurrent.x = coordBase.x + -1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -3.0f;
-	sum.y += color * 3.0f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.y += color * 10.0f;
+	const float color6 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 1;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 3.0f;
-	sum.y += color * 3.0f;
+	const float color7 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum.x -= (color0 - color2 + color5 - color7) * 3.0f;
+	sum.x -= (color3 - color4) * 10.0f;
+	sum.y -= (color0 + color2 - color5 - color7) * 3.0f;
+	sum.y -= (color1 - color6) * 10.0f;
 
     return sum;
 }
@@ -638,47 +598,39 @@ type_double filter_sum_double_GxGy_5x5(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -2;
 	coordCurrent.x = coordBase.x + -2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -0.0468750037f;
-	sum.y += color * -0.0468750037f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.y += color * -0.156250015f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 0.0468750037f;
-	sum.y += color * -0.0468750037f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -0.156250015f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 0.156250015f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 2;
 	coordCurrent.x = coordBase.x + -2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -0.0468750037f;
-	sum.y += color * 0.0468750037f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.y += color * 0.156250015f;
+	const float color6 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 2;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 0.0468750037f;
-	sum.y += color * 0.0468750037f;
+	const float color7 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum.x -= (color0 - color2 + color5 - color7) * 0.0468750037f;
+	sum.x -= (color3 - color4) * 0.156250015f;
+	sum.y -= (color0 + color2 - color5 - color7) * 0.0468750037f;
+	sum.y -= (color1 - color6) * 0.156250015f;
 
     return sum;
 }
@@ -720,47 +672,39 @@ type_double filter_sum_double_GxGy_7x7(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -3;
 	coordCurrent.x = coordBase.x + -3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -0.0312500037f;
-	sum.y += color * -0.0312500037f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.y += color * -0.104166679f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 0.0312500037f;
-	sum.y += color * -0.0312500037f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -0.104166679f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 0.104166679f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 3;
 	coordCurrent.x = coordBase.x + -3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -0.0312500037f;
-	sum.y += color * 0.0312500037f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.y += color * 0.104166679f;
+	const float color6 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 3;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 0.0312500037f;
-	sum.y += color * 0.0312500037f;
+	const float color7 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum.x -= (color0 - color2 + color5 - color7) * 0.0312500037f;
+	sum.x -= (color3 - color4) * 0.104166679f;
+	sum.y -= (color0 + color2 - color5 - color7) * 0.0312500037f;
+	sum.y -= (color1 - color6) * 0.104166679f;
 
     return sum;
 }
@@ -802,47 +746,39 @@ type_double filter_sum_double_GxGy_9x9(read_only image2d_t imgIn,
     const int cols = get_image_width(imgIn);
     int2 coordCurrent;
     int2 coordBorder;
-    float color;
 
 	coordCurrent.y = coordBase.y + -4;
 	coordCurrent.x = coordBase.x + -4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -0.0234375019f;
-	sum.y += color * -0.0234375019f;
+	const float color0 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.y += color * -0.0781250075f;
+	const float color1 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 0.0234375019f;
-	sum.y += color * -0.0234375019f;
+	const float color2 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y;
 	coordCurrent.x = coordBase.x + -4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -0.0781250075f;
+	const float color3 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 0.0781250075f;
+	const float color4 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.y = coordBase.y + 4;
 	coordCurrent.x = coordBase.x + -4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * -0.0234375019f;
-	sum.y += color * 0.0234375019f;
+	const float color5 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.y += color * 0.0781250075f;
+	const float color6 = read_imagef(imgIn, sampler, coordBorder).x;
 	coordCurrent.x = coordBase.x + 4;
 	coordBorder = borderCoordinate(coordCurrent, rows, cols, border);
-	color = read_imagef(imgIn, sampler, coordBorder).x;
-	sum.x += color * 0.0234375019f;
-	sum.y += color * 0.0234375019f;
+	const float color7 = read_imagef(imgIn, sampler, coordBorder).x;
+
+	sum.x -= (color0 - color2 + color5 - color7) * 0.0234375019f;
+	sum.x -= (color3 - color4) * 0.0781250075f;
+	sum.y -= (color0 + color2 - color5 - color7) * 0.0234375019f;
+	sum.y -= (color1 - color6) * 0.0781250075f;
 
     return sum;
 }
@@ -0,0 +1,94 @@
+// Sliding line buffer: a work-group owns a vertical strip of the image and slides down it. Only the 2 * filterRowsHalf + 1 rows needed for the current output
+// row are kept in local memory (ring buffer) so that every input pixel is loaded only once per strip (plus the warm-up rows at the beginning of each chunk)
+
+#define STRIP_WIDTH_SLIDING 64  // Must match the local work-group size
+#define ROWS_MAX_SLIDING 21     // Largest supported filter (21x21)
+
+/**
+ * Loads one image row of the strip (including the padding) into the given slot of the ring buffer.
+ */
+void load_row_sliding(read_only image2d_t imgIn, local float* ringBuffer, const int slot, const int xStrip, const int y, const int filterColsHalf, const int border)
+{
+    const int rows = get_image_height(imgIn);
+    const int cols = get_image_width(imgIn);
+    const int localCols = STRIP_WIDTH_SLIDING + 2 * filterColsHalf;
+
+    for (int x = get_local_id(0); x < localCols; x += get_local_size(0))
+    {
+        int2 coordBorder = borderCoordinate((int2)(xStrip - filterColsHalf + x, y), rows, cols, border);
+        ringBuffer[slot * localCols + x] = read_imagef(imgIn, sampler, coordBorder).x;
+    }
+}
+
+/**
+ * Filter kernel for a single filter using a sliding line buffer supposed to be called from the host.
+ *
+ * The work-groups are 1D (64 work-items, one per column of the strip). The first dimension of the global size selects the strip and the second dimension the
+ * chunk of rows inside the strip (more work-groups for small images). Every work-group first loads the 2 * filterRowsHalf rows above its first output row
+ * (warm-up) and then only one new row per output row.
+ *
+ * @param imgIn input image
+ * @param imgOut image containing the filter response
+ * @param filterKernel 1D array with the filter values. The filter is centred on the current pixel and the size of the filter must be odd (up to 21x21)
+ * @param filterRowsHalf rows of the filter divided by 2 with int cast, i.e. filterRowsHalf = floor(filterRows / 2)
+ * @param filterCols cols of the filter
+ * @param filterColsHalf cols of the filter divided by 2 with int cast, i.e. filterColsHalf = floor(filterCols / 2)
+ * @param chunkRows number of output rows per work-group
+ * @param border int value which specifies how out-of-border accesses should be handled. The values correspond to the OpenCV border types
+ */
+kernel void filter_single_sliding(read_only image2d_t imgIn,
+                                  write_only image2d_t imgOut,
+                                  constant float* filterKernel,
+                                  const int filterRowsHalf,
+                                  const int filterCols,
+                                  const int filterColsHalf,
+                                  const int chunkRows,
+                                  const int border)
+{
+    local float ringBuffer[ROWS_MAX_SLIDING * (STRIP_WIDTH_SLIDING + ROWS_MAX_SLIDING - 1)];
+
+    const int rows = get_image_height(imgIn);
+    const int cols = get_image_width(imgIn);
+    const int filterRows = 2 * filterRowsHalf + 1;
+    const int localCols = STRIP_WIDTH_SLIDING + 2 * filterColsHalf;
+
+    const int xLocalId = get_local_id(0);
+    const int xStrip = get_group_id(0) * STRIP_WIDTH_SLIDING;
+    const int x = xStrip + xLocalId;
+    const int yStart = get_group_id(1) * chunkRows;
+    const int yEnd = min(yStart + chunkRows, rows);
+
+    // Warm-up: the rows above the first output row. The slot of the image row y is (y - yStart + filterRowsHalf) % filterRows
+    for (int yRow = 0; yRow < 2 * filterRowsHalf; ++yRow)
+    {
+        load_row_sliding(imgIn, ringBuffer, yRow, xStrip, yStart - filterRowsHalf + yRow, filterColsHalf, border);
+    }
+
+    for (int y = yStart; y < yEnd; ++y)
+    {
+        // The new row replaces the oldest row in the ring buffer
+        const int slotNew = (y - yStart + 2 * filterRowsHalf) % filterRows;
+        load_row_sliding(imgIn, ringBuffer, slotNew, xStrip, y + filterRowsHalf, filterColsHalf, border);
+
+        // Wait until the new row is loaded in local memory
+        work_group_barrier(CLK_LOCAL_MEM_FENCE);
+
+        if (x < cols)
+        {
+            float sum = 0.0f;
+            for (int yFilter = 0; yFilter < filterRows; ++yFilter)
+            {
+                const int slot = (y - yStart + yFilter) % filterRows;
+                for (int xFilter = 0; xFilter < filterCols; ++xFilter)
+                {
+                    sum += ringBuffer[slot * localCols + xLocalId + xFilter] * filterKernel[yFilter * filterCols + xFilter];
+                }
+            }
+
+            write_imagef(imgOut, (int2)(x, y), sum);
+        }
+
+        // The oldest row is overwritten in the next iteration
+        work_group_barrier(CLK_LOCAL_MEM_FENCE);
+    }
+}
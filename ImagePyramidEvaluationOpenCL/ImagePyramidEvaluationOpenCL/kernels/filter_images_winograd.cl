@@ -0,0 +1,208 @@
+// Winograd minimal filtering F(2x2, 3x3) and F(2x2, 5x5): every work-item calculates a 2x2 output tile. The input tile d (alpha x alpha with
+// alpha = 2 + filterSize - 1) is transformed to V = Bt * d * B, multiplied element-wise with the transformed filters U = G * g * Gt (calculated on the host)
+// and transformed back with Y = At * (U .* V) * A. The transforms only contain small integer values and are written out as additions and subtractions so that
+// the element-wise product is the only real multiplication (16 instead of 36 for 3x3 and 36 instead of 100 for 5x5 per filter and 2x2 tile). The input
+// transform is shared between both filters
+
+#define ALPHA_MAX_WINOGRAD 6
+
+/**
+ * Applies the input transform Bt to the alpha values d[0], d[stride], ..., d[(alpha - 1) * stride] and stores the result with the same stride in v.
+ * The transforms are written out as explicit additions and subtractions:
+ *
+ * F(2x2, 3x3) (interpolation points 0, 1, -1, infinity):
+ *   Bt = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 -1 0 1]
+ * F(2x2, 5x5) (interpolation points 0, 1, -1, 2, -2, infinity):
+ *   Bt = [4 0 -5 0 1 0; 0 -4 -4 1 1 0; 0 4 -4 -1 1 0; 0 -2 -1 2 1 0; 0 2 -1 -2 1 0; 0 4 0 -5 0 1]
+ *
+ * alpha is a compile-time constant once the function is inlined into the kernels so that only one of the branches remains.
+ */
+void winograd_input_transform(const float* d, float* v, const int stride, const int alpha)
+{
+    if (alpha == 4)
+    {
+        v[0]          = d[0]          - d[2 * stride];
+        v[stride]     = d[stride]     + d[2 * stride];
+        v[2 * stride] = d[2 * stride] - d[stride];
+        v[3 * stride] = d[3 * stride] - d[stride];
+    }
+    else
+    {
+        // Shared terms of the rows 1/2 and 3/4
+        const float t0 = d[4 * stride] - 4.0f * d[2 * stride];
+        const float t1 = d[3 * stride] - 4.0f * d[stride];
+        const float t2 = d[4 * stride] - d[2 * stride];
+        const float t3 = 2.0f * (d[3 * stride] - d[stride]);
+
+        v[0]          = 4.0f * d[0] - 5.0f * d[2 * stride] + d[4 * stride];
+        v[stride]     = t0 + t1;
+        v[2 * stride] = t0 - t1;
+        v[3 * stride] = t2 + t3;
+        v[4 * stride] = t2 - t3;
+        v[5 * stride] = 4.0f * d[stride] - 5.0f * d[3 * stride] + d[5 * stride];
+    }
+}
+
+/**
+ * Applies the output transform At to the alpha values m[0], m[stride], ..., m[(alpha - 1) * stride] and stores the two results at y[0] and y[strideOut].
+ *
+ * F(2x2, 3x3): At = [1 1 1 0; 0 1 -1 1]
+ * F(2x2, 5x5): At = [1 1 1 1 1 0; 0 1 -1 2 -2 1]
+ */
+void winograd_output_transform(const float* m, float* y, const int stride, const int strideOut, const int alpha)
+{
+    if (alpha == 4)
+    {
+        y[0]         = m[0] + m[stride] + m[2 * stride];
+        y[strideOut] = m[stride] - m[2 * stride] + m[3 * stride];
+    }
+    else
+    {
+        y[0]         = m[0] + m[stride] + m[2 * stride] + m[3 * stride] + m[4 * stride];
+        y[strideOut] = m[stride] - m[2 * stride] + 2.0f * (m[3 * stride] - m[4 * stride]) + m[5 * stride];
+    }
+}
+
+/**
+ * Calculates the 2x2 output tile of two filters with the Winograd algorithm. Supposed to be called from other kernels.
+ *
+ * @param imgIn input image
+ * @param imgOut1 image containing the filter response of the first filter
+ * @param imgOut2 image containing the filter response of the second filter
+ * @param transformedKernel1 first filter transformed with G * g * Gt (alpha x alpha values)
+ * @param transformedKernel2 second filter transformed with G * g * Gt (alpha x alpha values)
+ * @param alpha size of the input tile, i.e. alpha = 2 + filterSize - 1 (4 or 6)
+ * @param border int value which specifies how out-of-border accesses should be handled. The values correspond to the OpenCV border types
+ */
+void filter_tile_double_winograd(read_only image2d_t imgIn,
+                                 write_only image2d_t imgOut1,
+                                 write_only image2d_t imgOut2,
+                                 constant float* transformedKernel1,
+                                 constant float* transformedKernel2,
+                                 const int alpha,
+                                 const int border)
+{
+    const int rows = get_image_height(imgIn);
+    const int cols = get_image_width(imgIn);
+    const int filterHalf = (alpha - 1) / 2;
+    const int2 coordTile = (int2)(get_global_id(0), get_global_id(1)) * 2;
+
+    if (coordTile.x >= cols || coordTile.y >= rows)
+    {
+        return;
+    }
+
+    // Input tile (including the padding)
+    float d[ALPHA_MAX_WINOGRAD * ALPHA_MAX_WINOGRAD];
+    #pragma unroll
+    for (int y = 0; y < alpha; ++y)
+    {
+        #pragma unroll
+        for (int x = 0; x < alpha; ++x)
+        {
+            const int2 coordBorder = borderCoordinate(coordTile + (int2)(x - filterHalf, y - filterHalf), rows, cols, border);
+            d[y * alpha + x] = read_imagef(imgIn, sampler, coordBorder).x;
+        }
+    }
+
+    // tmp = Bt * d (every column of the tile)
+    float tmp[ALPHA_MAX_WINOGRAD * ALPHA_MAX_WINOGRAD];
+    #pragma unroll
+    for (int x = 0; x < alpha; ++x)
+    {
+        winograd_input_transform(d + x, tmp + x, alpha, alpha);
+    }
+
+    // V = tmp * B (every row of the tile)
+    float v[ALPHA_MAX_WINOGRAD * ALPHA_MAX_WINOGRAD];
+    #pragma unroll
+    for (int y = 0; y < alpha; ++y)
+    {
+        winograd_input_transform(tmp + y * alpha, v + y * alpha, 1, alpha);
+    }
+
+    // Element-wise product with both transformed filters (the only real multiplications)
+    float m1[ALPHA_MAX_WINOGRAD * ALPHA_MAX_WINOGRAD];
+    float m2[ALPHA_MAX_WINOGRAD * ALPHA_MAX_WINOGRAD];
+    #pragma unroll
+    for (int i = 0; i < alpha * alpha; ++i)
+    {
+        m1[i] = v[i] * transformedKernel1[i];
+        m2[i] = v[i] * transformedKernel2[i];
+    }
+
+    // At * m (every column, 2 x alpha values)
+    float t1[2 * ALPHA_MAX_WINOGRAD];
+    float t2[2 * ALPHA_MAX_WINOGRAD];
+    #pragma unroll
+    for (int x = 0; x < alpha; ++x)
+    {
+        winograd_output_transform(m1 + x, t1 + x, alpha, alpha, alpha);
+        winograd_output_transform(m2 + x, t2 + x, alpha, alpha, alpha);
+    }
+
+    // Y = (At * m) * A (every row, 2x2 values)
+    float y1[4];
+    float y2[4];
+    #pragma unroll
+    for (int i = 0; i < 2; ++i)
+    {
+        winograd_output_transform(t1 + i * alpha, y1 + i * 2, 1, 1, alpha);
+        winograd_output_transform(t2 + i * alpha, y2 + i * 2, 1, 1, alpha);
+    }
+
+    #pragma unroll
+    for (int i = 0; i < 2; ++i)
+    {
+        #pragma unroll
+        for (int j = 0; j < 2; ++j)
+        {
+            const int2 coordOut = coordTile + (int2)(j, i);
+            if (coordOut.x < cols && coordOut.y < rows)
+            {
+                write_imagef(imgOut1, coordOut, y1[i * 2 + j]);
+                write_imagef(imgOut2, coordOut, y2[i * 2 + j]);
+            }
+        }
+    }
+}
+
+/**
+ * Filter kernel for two 3x3 filters using Winograd F(2x2, 3x3) supposed to be called from the host. One work-item per 2x2 output tile.
+ *
+ * @param imgIn input image
+ * @param imgOut1 image containing the filter response of the first filter
+ * @param imgOut2 image containing the filter response of the second filter
+ * @param transformedKernel1 first filter transformed with G * g * Gt (4x4 values)
+ * @param transformedKernel2 second filter transformed with G * g * Gt (4x4 values)
+ * @param border int value which specifies how out-of-border accesses should be handled. The values correspond to the OpenCV border types
+ */
+kernel void filter_double_winograd_3x3(read_only image2d_t imgIn,
+                                       write_only image2d_t imgOut1,
+                                       write_only image2d_t imgOut2,
+                                       constant float* transformedKernel1,
+                                       constant float* transformedKernel2,
+                                       const int border)
+{
+    filter_tile_double_winograd(imgIn, imgOut1, imgOut2, transformedKernel1, transformedKernel2, 4, border);
+}
+
+/**
+ * Filter kernel for two 5x5 filters using Winograd F(2x2, 5x5) supposed to be called from the host. One work-item per 2x2 output tile.
+ *
+ * @param imgIn input image
+ * @param imgOut1 image containing the filter response of the first filter
+ * @param imgOut2 image containing the filter response of the second filter
+ * @param transformedKernel1 first filter transformed with G * g * Gt (6x6 values)
+ * @param transformedKernel2 second filter transformed with G * g * Gt (6x6 values)
+ * @param border int value which specifies how out-of-border accesses should be handled. The values correspond to the OpenCV border types
+ */
+kernel void filter_double_winograd_5x5(read_only image2d_t imgIn,
+                                       write_only image2d_t imgOut1,
+                                       write_only image2d_t imgOut2,
+                                       constant float* transformedKernel1,
+                                       constant float* transformedKernel2,
+                                       const int border)
+{
+    filter_tile_double_winograd(imgIn, imgOut1, imgOut2, transformedKernel1, transformedKernel2, 6, border);
+}
@@ -0,0 +1,6 @@
+// Empty kernel for the host overhead measurements (see HostOverhead.h). Its only argument is a memory object of the storage type (the parameter type of the
+// bandwidth probes) so that only the host and driver costs of a launch are measured
+
+kernel void overhead_empty(PROBE_SRC_TYPE img)
+{
+}
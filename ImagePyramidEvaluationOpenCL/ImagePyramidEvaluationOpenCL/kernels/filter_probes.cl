@@ -0,0 +1,57 @@
+// Bandwidth probes (see BandwidthProbe.h) shared by all storage types. The root file of every storage type defines the memory access of the probes:
+// PROBE_SRC_TYPE/PROBE_DST_TYPE are the parameter types and PROBE_READ(x, y, z)/PROBE_WRITE(x, y, z, v) access the pixel in the column x, row y and level z.
+// The reads which are not written use a condition which never holds for the pyramid images so that the compiler cannot remove them
+
+kernel void probe_copy(PROBE_SRC_TYPE src, PROBE_DST_TYPE dst, const int cols, const int rows, const int radius)
+{
+    const int x = get_global_id(0);
+    const int y = get_global_id(1);
+    const int z = get_global_id(2);
+
+    PROBE_WRITE(x, y, z, PROBE_READ(x, y, z));
+}
+
+kernel void probe_strided(PROBE_SRC_TYPE src, PROBE_DST_TYPE dst, const int cols, const int rows, const int radius)
+{
+    // The global range is transposed
+    const int x = get_global_id(1);
+    const int y = get_global_id(0);
+    const int z = get_global_id(2);
+
+    const float value = PROBE_READ(x, y, z);
+    if (value == -1.0f)
+    {
+        PROBE_WRITE(x, y, z, value);
+    }
+}
+
+kernel void probe_neighbourhood(PROBE_SRC_TYPE src, PROBE_DST_TYPE dst, const int cols, const int rows, const int radius)
+{
+    const int x = get_global_id(0);
+    const int y = get_global_id(1);
+    const int z = get_global_id(2);
+
+    float sum = 0.0f;
+    for (int dy = -radius; dy <= radius; ++dy)
+    {
+        const int yy = clamp(y + dy, 0, rows - 1);
+        for (int dx = -radius; dx <= radius; ++dx)
+        {
+            sum += PROBE_READ(clamp(x + dx, 0, cols - 1), yy, z);
+        }
+    }
+
+    if (sum == -1.0f)
+    {
+        PROBE_WRITE(x, y, z, sum);
+    }
+}
+
+kernel void probe_write(PROBE_SRC_TYPE src, PROBE_DST_TYPE dst, const int cols, const int rows, const int radius)
+{
+    const int x = get_global_id(0);
+    const int y = get_global_id(1);
+    const int z = get_global_id(2);
+
+    PROBE_WRITE(x, y, z, (float)x);
+}
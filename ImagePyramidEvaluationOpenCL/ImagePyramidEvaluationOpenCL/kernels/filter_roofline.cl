@@ -0,0 +1,28 @@
+// Peak measurements of the roofline model (see Roofline.h). The kernels only use plain buffers and are therefore only part of the buffer storage
+
+kernel void roofline_copy(global const float4* src, global float4* dst)
+{
+    const size_t i = get_global_id(0);
+    dst[i] = src[i];
+}
+
+kernel void roofline_fma(global float* dst, const float a, const float b, const int iterations)
+{
+    // Independent chains so that the latency of the FMA units is hidden
+    float4 x0 = (float4)(get_global_id(0));
+    float4 x1 = x0 + 1.0f;
+    float4 x2 = x0 + 2.0f;
+    float4 x3 = x0 + 3.0f;
+
+    #pragma unroll 16
+    for (int i = 0; i < iterations; ++i)
+    {
+        x0 = mad(x0, a, b);
+        x1 = mad(x1, a, b);
+        x2 = mad(x2, a, b);
+        x3 = mad(x3, a, b);
+    }
+
+    // Store the result so that the compiler cannot remove the loop
+    dst[get_global_id(0)] = dot(x0 + x1, x2 + x3);
+}
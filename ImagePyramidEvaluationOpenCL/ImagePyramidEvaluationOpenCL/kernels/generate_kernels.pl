@@ -11,6 +11,10 @@ our %kernels;
 
 my $generateSeparationFilter = 1;
 my $generatedWarning = "/* This file is generated. Do not modify. */\n\n";
+my %registry;   # Generated filter kernels: storage => multiplicity => memory => size => [name, rows, cols]
+my %registryDilated;        # Dilated filter kernels: storage => multiplicity => name
+my %registryPredefined;     # Filter kernels with the derivative filters compiled in: memory => derivative => size => [name, rows, cols]
+my %variants;   # Code of every generated filter variant (filter sum and kernel): base filename => [code, ...]
 
 generate_defines("filter_images_defines.base.cl");
 generate_filter("filter_images_normal.base.cl");
@@ -18,16 +22,23 @@ generate_filter("filter_images_local.base.cl");
 generate_filter_optimum("filter_images.base.cl");
 generate_derivativeKernels("filter_images_normal.base.cl", "filter_images_predefined-normal.cl");  # Use only normal
 generate_derivativeKernels("filter_images_local.base.cl", "filter_images_predefined-local.cl");    # Use only local
+generate_filter_dilated("filter_images_dilated.base.cl");
 #generate_derivativeKernels("filter_images_normal.base.cl", "filter_images_local.base.cl", "filter_images_optimum-predefined.cl");   # Use local memory for filter sizes > 3 x 3
 
 generate_filter("filter_cubes_normal.base.cl");
 generate_filter("filter_cubes_local.base.cl");
+generate_filter_dilated("filter_cubes_dilated.base.cl");
 
 generate_filter("filter_buffer_normal.base.cl");
 generate_filter("filter_buffer_local.base.cl");
+generate_filter_dilated("filter_buffer_dilated.base.cl");
 
 generate_filter("filter_image1D_normal.base.cl");
 generate_filter("filter_image1D_local.base.cl");
+generate_filter_dilated("filter_image1D_dilated.base.cl");
+
+generate_registry("../KernelRegistry.h");
+generate_sources("../KernelSources.cpp");
 
 sub generate_defines
 {
@@ -47,6 +58,7 @@ sub generate_defines
         $baseCopy =~ s{// GENERATE_N-HALF$}{$N_HALF}gm;
         $baseCopy =~ s{// GENERATE_LOCAL_SIZE_COLS$}{$LOCAL_SIZE // 16 + 2 * $N_HALF}gm;
         $baseCopy =~ s{// GENERATE_LOCAL_SIZE_ROWS$}{$LOCAL_SIZE // 16 + 2 * $N_HALF}gm;
+        $baseCopy =~ s{// GENERATE_LOCAL_STRIDE$}{localStride($LOCAL_SIZE)}gme;
         
         $code .= $baseCopy;
         if ($N != 9) {
@@ -57,6 +69,7 @@ sub generate_defines
     $code .= "\n// Max possible filter size with local memory (arbitrary chosen)\n";
     $code .= "#define LOCAL_SIZE_COLS_21x21 36 // 16 + 2 * 10\n";
     $code .= "#define LOCAL_SIZE_ROWS_21x21 36 // 16 + 2 * 10\n";
+    $code .= "#define LOCAL_STRIDE_21x21 " . localStride(36) . "\n";
     
     if ($generateSeparationFilter) {
         $code .= "\n";
@@ -75,6 +88,7 @@ sub generate_defines
             $baseCopy =~ s{ROWS_HALF_NxN // GENERATE_N-HALF}{ROWS_HALF_1x$N 0}gm;
             $baseCopy =~ s{LOCAL_SIZE_COLS_NxN // GENERATE_LOCAL_SIZE_COLS}{LOCAL_SIZE_COLS_1x$N $LOCAL_SIZE_COLS // 16 + 2 * $N_HALF}gm;
             $baseCopy =~ s{LOCAL_SIZE_ROWS_NxN // GENERATE_LOCAL_SIZE_ROWS}{LOCAL_SIZE_ROWS_1x$N $LOCAL_SIZE_ROWS // 16}gm;
+            $baseCopy =~ s{LOCAL_STRIDE_NxN // GENERATE_LOCAL_STRIDE}{"LOCAL_STRIDE_1x$N " . localStride($LOCAL_SIZE_COLS)}gme;
             
             $code .= $baseCopy;
             if ($N != 9) {
@@ -97,6 +111,7 @@ sub generate_defines
             $baseCopy =~ s{ROWS_HALF_NxN // GENERATE_N-HALF}{ROWS_HALF_${N}x1 $N_HALF}gm;
             $baseCopy =~ s{LOCAL_SIZE_COLS_NxN // GENERATE_LOCAL_SIZE_COLS}{LOCAL_SIZE_COLS_${N}x1 $LOCAL_SIZE_COLS // 16}gm;
             $baseCopy =~ s{LOCAL_SIZE_ROWS_NxN // GENERATE_LOCAL_SIZE_ROWS}{LOCAL_SIZE_ROWS_${N}x1 $LOCAL_SIZE_ROWS // 16 + 2 * $N_HALF}gm;
+            $baseCopy =~ s{LOCAL_STRIDE_NxN // GENERATE_LOCAL_STRIDE}{"LOCAL_STRIDE_${N}x1 " . localStride($LOCAL_SIZE_COLS)}gme;
             
             $code .= $baseCopy;
             if ($N != 9) {
@@ -109,6 +124,14 @@ sub generate_defines
     path($codeFilename)->spew({binmode => ":encoding(UTF-8)"}, $code) or die "Can't write file " . $codeFilename . ": $!\n";
 }
 
+# Row stride of the local buffer: the next odd number so that the work-items of a column access different memory banks
+sub localStride {
+        my $localSizeCols = $_[0];
+        my $stride = $localSizeCols % 2 == 0 ? $localSizeCols + 1 : $localSizeCols;
+        
+        return "$stride // $localSizeCols padded to an odd stride";
+    }
+
 sub substDefaults {
         my $multiplicity = $_[0];
         my $baseCopy = $_[1];
@@ -144,6 +167,7 @@ sub generate_filter
         $baseCopy =~ s{\bCOLS\b}{filterCols}gm;
         $baseCopy =~ s{\bCOLS_HALF\b}{filterColsHalf}gm;
         $baseCopy =~ s{LOCAL_SIZE_(COLS|ROWS)}{LOCAL_SIZE_$1_21x21}gm;
+        $baseCopy =~ s{\bLOCAL_STRIDE\b}{LOCAL_STRIDE_21x21}gm;
         $baseCopy =~ s{,\s+// GENERATE_REMOVE$}{,}gm;
         $baseCopy =~ s{\s*// GENERATE_REMOVE$}{}gm;
         $baseCopy =~ s{/\* GENERATE_REMOVE:([^*]+)\*/}{$1}gm;
@@ -151,6 +175,7 @@ sub generate_filter
         $baseCopy = substDefaults($multiplicity, $baseCopy);
         
         $code .= $baseCopy . "\n";
+        push @{$variants{$filenameBase}}, $baseCopy;
         $code .= "// Normal filter\n";
 
         foreach my $N (3, 5, 7, 9) {
@@ -165,6 +190,7 @@ sub generate_filter
             $baseCopy = substDefaults($multiplicity, $baseCopy);
         
             $code .= $baseCopy;
+            push @{$variants{$filenameBase}}, $baseCopy;
             if ($N != 9) {
                 $code .= "\n";
             }
@@ -186,6 +212,7 @@ sub generate_filter
                 $baseCopy = substDefaults($multiplicity, $baseCopy);
                 
                 $code .= $baseCopy;
+                push @{$variants{$filenameBase}}, $baseCopy;
                 if ($N != 9) {
                     $code .= "\n";
                 }
@@ -205,6 +232,7 @@ sub generate_filter
                 $baseCopy = substDefaults($multiplicity, $baseCopy);
                 
                 $code .= $baseCopy;
+                push @{$variants{$filenameBase}}, $baseCopy;
                 if ($N != 9) {
                     $code .= "\n";
                 }
@@ -212,6 +240,30 @@ sub generate_filter
         }
     }
     
+    register_kernels($filenameBase, $code);
+    
+    my $codeFilename = $filenameBase =~ s/\.base//r;
+    path($codeFilename)->spew({binmode => ":encoding(UTF-8)"}, $code) or die "Can't write file " . $codeFilename . ": $!\n";
+}
+
+sub generate_filter_dilated
+{
+    my $filenameBase = $_[0];
+    my $base = path($filenameBase)->slurp({binmode => ":encoding(UTF-8)"}) or die "Can't read file " . $filenameBase . ": $!\n";
+    my $code = $generatedWarning;
+    
+    # The dilated filters work for every filter size; hence, only the multiplicity must be substituted
+    foreach my $multiplicity ("single", "double") {
+        $code .= substDefaults($multiplicity, $base) . "\n";
+    }
+    
+    $code =~ s/\n\n$/\n/;
+    
+    my ($storage) = $filenameBase =~ m{^filter_(images|cubes|buffer|image1D)_dilated\.base\.cl$} or die "Unknown storage type of the file " . $filenameBase . "\n";
+    while ($code =~ m{^kernel void (filter_(single|double)_dilated)\s*\(}gm) {
+        $registryDilated{$storage}{$2} = $1;
+    }
+    
     my $codeFilename = $filenameBase =~ s/\.base//r;
     path($codeFilename)->spew({binmode => ":encoding(UTF-8)"}, $code) or die "Can't write file " . $codeFilename . ": $!\n";
 }
@@ -235,6 +287,7 @@ sub generate_filter_optimum
         $baseCopy =~ s{\bCOLS\b}{filterCols}gm;
         $baseCopy =~ s{\bCOLS_HALF\b}{filterColsHalf}gm;
         $baseCopy =~ s{LOCAL_SIZE_(COLS|ROWS)}{LOCAL_SIZE_$1_21x21}gm;
+        $baseCopy =~ s{\bLOCAL_STRIDE\b}{LOCAL_STRIDE_21x21}gm;
         $baseCopy =~ s{,\s+// GENERATE_REMOVE$}{,}gm;
         $baseCopy =~ s{/\* GENERATE_REMOVE:([^*]+)\*/}{$1}gm;
         
@@ -347,7 +400,19 @@ sub generate_derivativeKernels
             
             my $kernelCode = "\n";
             
-            # Execute the convolution
+            my $localCode;
+            if ($optimise) {
+                $localCode = $rows > 3 ? 1 : 0;
+            }
+            else {
+                $localCode = $useLocal ? 1 : 0;
+            }
+            
+            # Read every pixel with a non-zero filter value (in at least one of the kernels) exactly once
+            my @groups = ({}, {});          # Per output component: absolute filter value --> list of signed color variables
+            my @groupOrder = ([], []);      # Absolute filter values in the order of their first appearance
+            my $colorIdx = 0;
+            
             for (my $y = -$rowsHalf; $y <= $rowsHalf; ++$y) {
                 my $codeYCoord = "\tcoordCurrent.y = coordBase.y";
                 if ($y != 0) {
@@ -359,85 +424,88 @@ sub generate_derivativeKernels
                 
                 for (my $x = -$colsHalf; $x <= $colsHalf; ++$x) {
                     # Retrieve the value for the kernel
-                    my $value = $kernels{$key}[($y + $rowsHalf) * $cols + $x + $colsHalf];
-                    my $value2;
+                    my @values = ($kernels{$key}[($y + $rowsHalf) * $cols + $x + $colsHalf]);
                     if ($multiplicity eq "double") {
-                        $value2 = $kernels{$key2}[($y + $rowsHalf) * $cols + $x + $colsHalf];
+                        push @values, $kernels{$key2}[($y + $rowsHalf) * $cols + $x + $colsHalf];
                     }
                     
-                    # Check if the filter kernel values are non-zero
-                    my $validValue = 0;
-                    my $sum = "";
-                    my $sum2 = "";
-                    if ($multiplicity eq "double") {
-                        if ($value != 0) {
-                            $validValue = 1;
-                            
-                            # Use as max digits after the period as available
-                            my $valuePrecision = ($value =~ /\.(.*)/) ? length($1) : 1;
-                            
-                            # It is important that the numbers are float literals (i.e. they have .f appended); otherwise additional overhead is introduced due to type casting
-                            $sum = sprintf("\tsum.x += color * %.*ff;\n", $valuePrecision, $value);
-                        }
-                        if ($value2 != 0) {
-                            $validValue = 1;
-                            my $value2Precision = ($value2 =~ /\.(.*)/) ? length($1) : 1;
-                            $sum2 = sprintf("\tsum.y += color * %.*ff;\n", $value2Precision, $value2);
-                        }
+                    # Zero taps are skipped completely
+                    next unless grep { $_ != 0 } @values;
+                    
+                    my $color = "color$colorIdx";
+                    ++$colorIdx;
+                    
+                    # The y coordinates must only be printed once per row
+                    if ($codeYCoordPrinted == 0) {
+                        $kernelCode .= $codeYCoord;
+                        $codeYCoordPrinted = 1;
+                    }
+
+                    $kernelCode .= "\tcoordCurrent.x = coordBase.x";
+                    if ($x != 0) {
+                        $kernelCode .= " + $x";
+                    }
+                    $kernelCode .= ";\n";
+                    
+                    if ($localCode) {
+                        $kernelCode .= "\tconst float $color = localBuffer[coordCurrent.y * LOCAL_STRIDE_${rows}x$cols + coordCurrent.x];\n";
                     }
                     else {
-                        if ($value != 0) {
-                            $validValue = 1;
-                            my $valuePrecision = ($value =~ /\.(.*)/) ? length($1) : 1;
-                            $sum = sprintf("\tsum += color * %.*ff;\n", $valuePrecision, $value);
-                        }
+                        $kernelCode .= "\tcoordBorder = borderCoordinate(coordCurrent, rows, cols, border);\n";
+                        $kernelCode .= "\tconst float $color = read_imagef(imgIn, sampler, coordBorder).x;\n";
                     }
                     
-                    if ($validValue) {
-                        # The y coordinates must only be printed once per row
-                        if ($codeYCoordPrinted == 0) {
-                            $kernelCode .= $codeYCoord;
-                            $codeYCoordPrinted = 1;
-                        }
-
-                        $kernelCode .= "\tcoordCurrent.x = coordBase.x";
-                        if ($x != 0) {
-                            $kernelCode .= " + $x";
-                        }
-                        $kernelCode .= ";\n";
-                        
-                        my $localCode;
-                        if ($optimise) {
-                            $localCode = $rows > 3 ? 1 : 0;
-                        }
-                        else {
-                            $localCode = $useLocal ? 1 : 0;
-                        }
+                    # Taps with the same absolute filter value are grouped so that they share one multiplication (symmetric and antisymmetric taps of the derivative kernels)
+                    for (my $i = 0; $i < scalar @values; ++$i) {
+                        next if $values[$i] == 0;
                         
-                        if ($localCode) {
-                            $kernelCode .= "\tcolor = localBuffer[coordCurrent.y * LOCAL_SIZE_COLS_${rows}x$cols + coordCurrent.x];\n";
-                        }
-                        else {
-                            $kernelCode .= "\tcoordBorder = borderCoordinate(coordCurrent, rows, cols, border);\n";
-                            $kernelCode .= "\tcolor = read_imagef(imgIn, sampler, coordBorder).x;\n";
-                        }
-                        
-                        if ($sum ne "") {
-                            $kernelCode .= $sum;
-                        }
-                        if ($sum2 ne "") {
-                            $kernelCode .= $sum2;
+                        my $absValue = $values[$i] =~ s/^-//r;
+                        if (!exists $groups[$i]{$absValue}) {
+                            $groups[$i]{$absValue} = [];
+                            push @{$groupOrder[$i]}, $absValue;
                         }
+                        push @{$groups[$i]{$absValue}}, ($values[$i] < 0 ? "-" : "+") . $color;
                     }
                 }
             }
             
+            $kernelCode .= "\n";
+            
+            # Sum up the groups
+            my @sumNames = $multiplicity eq "double" ? ("sum.x", "sum.y") : ("sum");
+            for (my $i = 0; $i < scalar @sumNames; ++$i) {
+                foreach my $absValue (@{$groupOrder[$i]}) {
+                    my @terms = @{$groups[$i]{$absValue}};
+                    
+                    # If the first term is negative, all signs are flipped and the group is subtracted instead
+                    my $operator = "+=";
+                    if ($terms[0] =~ m/^-/) {
+                        $operator = "-=";
+                        @terms = map { tr/+-/-+/r } @terms;
+                    }
+                    
+                    my $termsCode = join(" ", @terms);
+                    $termsCode =~ s/^\+//;
+                    $termsCode =~ s/ ([+-])/ $1 /g;
+                    if (scalar @terms > 1) {
+                        $termsCode = "($termsCode)";
+                    }
+                    
+                    # Use as max digits after the period as available
+                    my $valuePrecision = ($absValue =~ /\.(.*)/) ? length($1) : 1;
+                    
+                    # It is important that the numbers are float literals (i.e. they have .f appended); otherwise additional overhead is introduced due to type casting
+                    $kernelCode .= sprintf("\t%s %s %s * %.*ff;\n", $sumNames[$i], $operator, $termsCode, $valuePrecision, $absValue);
+                }
+            }
+            
             $kernelCode =~ s/\n\n$/\n/;
             
             # The rest are just the normal substitutions
             $baseCopy =~ s{NxN}{${rows}x$cols}gm;
             $baseCopy =~ s{DERIV}{$deriv}gm;
             $baseCopy =~ s{^\s*// GENERATE_KERNEL_BEGIN.*GENERATE_KERNEL_END\s*$}{$kernelCode}gsm;
+            $baseCopy =~ s{^\s*float color;\n}{}gm;   # The grouped taps read into their own color variables
             $baseCopy =~ s{^.*\s+// GENERATE_REMOVE\n}{}gm;
             $baseCopy =~ s{/\* GENERATE_REMOVE:([^*]+)\*/}{}gm;
             $baseCopy =~ s{\s*/\* GENERATE_REMOVE_PREDEFINED:(?:.+?)\*/(?:\*/)?}{}gs;
@@ -449,5 +517,259 @@ sub generate_derivativeKernels
     
     $code =~ s/\n\n$/\n/;
     
+    # Only the kernels which use either only normal or only local memory are known to the registry
+    if (!$optimise) {
+        while ($code =~ m{^kernel void (filter_(?:single|double)(?:_local)?_(Gx|Gy|GxGy)_(\d+)x(\d+))\s*\(}gm) {
+            $registryPredefined{$useLocal ? "local" : "normal"}{$2}{"${3}x$4"} = [$1, $3, $4];
+        }
+    }
+    
     path($filenameOutput)->spew({binmode => ":encoding(UTF-8)"}, $code) or die "Can't write file " . $filenameOutput . ": $!\n";
 }
+
+# Stores all filter kernels of a generated file (storage and memory type are derived from the file name) for the kernel registry
+sub register_kernels
+{
+    my $filenameBase = $_[0];
+    my $code = $_[1];
+    
+    my ($storage, $memory) = $filenameBase =~ m{^filter_(images|cubes|buffer|image1D)_(normal|local)\.base\.cl$} or die "Unknown storage type of the file " . $filenameBase . "\n";
+    
+    while ($code =~ m{^kernel void (filter_(single|double)(?:_local)?(?:_(\d+)x(\d+))?)\s*\(}gm) {
+        my ($name, $multiplicity, $rows, $cols) = ($1, $2, $3, $4);
+        my $size = defined($rows) ? "${rows}x$cols" : "generic";
+        
+        $registry{$storage}{$multiplicity}{$memory}{$size} = [$name, $rows // 0, $cols // 0];
+    }
+}
+
+# C++ header which describes every generated filter kernel so that the host selects kernels via a table lookup instead of building the kernel names
+sub generate_registry
+{
+    my $codeFilename = $_[0];
+    my @storages = ("images", "cubes", "buffer", "image1D");
+    my @derivatives = ("Gx", "Gy", "GxGy");
+    my @sizes = ("generic");
+    push @sizes, map { "${_}x$_" } (3, 5, 7, 9);
+    if ($generateSeparationFilter) {
+        push @sizes, map { "1x$_" } (3, 5, 7, 9);
+        push @sizes, map { "${_}x1" } (3, 5, 7, 9);
+    }
+    
+    my $code = $generatedWarning;
+    $code .= "#pragma once\n\n";
+    $code .= "/**\n";
+    $code .= " * \@brief All filter kernels generated from the *_normal.base.cl, *_local.base.cl and *_dilated.base.cl templates, the predefined derivative filters and the\n";
+    $code .= " * Winograd filters (see kernels/generate_kernels.pl)\n";
+    $code .= " */\n";
+    $code .= "namespace KernelRegistry\n{\n";
+    $code .= "    enum Storage\n    {\n" . join("", map { "        " . uc($_) . ",\n" } @storages) . "        NUMBER_STORAGES\n    };\n\n";
+    $code .= "    enum Multiplicity\n    {\n        SINGLE,\n        DOUBLE,\n        NUMBER_MULTIPLICITIES\n    };\n\n";
+    $code .= "    enum Memory\n    {\n        NORMAL,\n        LOCAL,\n        NUMBER_MEMORIES\n    };\n\n";
+    $code .= "    enum Size\n    {\n" . join("", map { "        SIZE_" . ($_ eq "generic" ? "GENERIC" : $_) . ",\n" } @sizes) . "        NUMBER_SIZES\n    };\n\n";
+    $code .= "    enum Derivative\n    {\n" . join("", map { "        " . uc($_) . ",\n" } @derivatives) . "        NUMBER_DERIVATIVES\n    };\n\n";
+    
+    $code .= "    struct Kernel\n";
+    $code .= "    {\n";
+    $code .= "        const char* name;       //!< nullptr if the kernel does not exist (predefined and Winograd kernels are only generated for some sizes)\n";
+    $code .= "        int rows;               //!< Filter size of the unrolled kernels (0 for the generic kernels which additionally need the filter size as arguments)\n";
+    $code .= "        int cols;\n\n";
+    $code .= "        constexpr bool unrolled() const\n";
+    $code .= "        {\n";
+    $code .= "            return rows > 0;\n";
+    $code .= "        }\n";
+    $code .= "    };\n\n";
+    
+    $code .= "    /**\n";
+    $code .= "     * \@brief Index of the unrolled kernel for the given filter size or SIZE_GENERIC if no such kernel exists\n";
+    $code .= "     */\n";
+    $code .= "    constexpr Size size(const int rows, const int cols)\n";
+    $code .= "    {\n";
+    $code .= "        return\n";
+    foreach my $size (@sizes[1..$#sizes]) {
+        my ($rows, $cols) = split /x/, $size;
+        $code .= "            rows == $rows && cols == $cols ? SIZE_$size :\n";
+    }
+    $code .= "            SIZE_GENERIC;\n";
+    $code .= "    }\n\n";
+    
+    $code .= "    constexpr Kernel kernels[NUMBER_STORAGES][NUMBER_MULTIPLICITIES][NUMBER_MEMORIES][NUMBER_SIZES] = {\n";
+    my @codeStorages;
+    foreach my $storage (@storages) {
+        my @codeMultiplicities;
+        foreach my $multiplicity ("single", "double") {
+            my @codeMemories;
+            foreach my $memory ("normal", "local") {
+                my @codeSizes;
+                foreach my $size (@sizes) {
+                    my $kernel = $registry{$storage}{$multiplicity}{$memory}{$size} or die "Missing kernel for $storage, $multiplicity, $memory, $size\n";
+                    my ($name, $rows, $cols) = @$kernel;
+                    push @codeSizes, "                    { \"$name\", $rows, $cols }";
+                }
+                push @codeMemories, "                {   // " . uc($memory) . "\n" . join(",\n", @codeSizes) . "\n                }";
+            }
+            push @codeMultiplicities, "            {   // " . uc($multiplicity) . "\n" . join(",\n", @codeMemories) . "\n            }";
+        }
+        push @codeStorages, "        {   // " . uc($storage) . "\n" . join(",\n", @codeMultiplicities) . "\n        }";
+    }
+    $code .= join(",\n", @codeStorages) . "\n    };\n\n";
+    
+    $code .= "    /**\n";
+    $code .= "     * \@brief Dilated 3x3 filter kernels (for every filter size, the dilation is passed as argument)\n";
+    $code .= "     */\n";
+    $code .= "    constexpr Kernel dilated[NUMBER_STORAGES][NUMBER_MULTIPLICITIES] = {\n";
+    my @codeDilated;
+    foreach my $storage (@storages) {
+        my @codeMultiplicities;
+        foreach my $multiplicity ("single", "double") {
+            my $name = $registryDilated{$storage}{$multiplicity} or die "Missing dilated kernel for $storage, $multiplicity\n";
+            push @codeMultiplicities, "            { \"$name\", 0, 0 }";
+        }
+        push @codeDilated, "        {   // " . uc($storage) . "\n" . join(",\n", @codeMultiplicities) . "\n        }";
+    }
+    $code .= join(",\n", @codeDilated) . "\n    };\n\n";
+    
+    $code .= "    /**\n";
+    $code .= "     * \@brief Kernels with the derivative filters compiled in (only for the image storage). Gx and Gy are single kernels, GxGy are double kernels\n";
+    $code .= "     */\n";
+    $code .= "    constexpr Kernel predefined[NUMBER_MEMORIES][NUMBER_DERIVATIVES][NUMBER_SIZES] = {\n";
+    my @codeMemories;
+    foreach my $memory ("normal", "local") {
+        my @codeDerivatives;
+        foreach my $derivative (@derivatives) {
+            my @codeSizes;
+            foreach my $size (@sizes) {
+                my $kernel = $registryPredefined{$memory}{$derivative}{$size};
+                push @codeSizes, $kernel ? "                { \"$kernel->[0]\", $kernel->[1], $kernel->[2] }" : "                { nullptr, 0, 0 }";
+            }
+            push @codeDerivatives, "            {   // " . uc($derivative) . "\n" . join(",\n", @codeSizes) . "\n            }";
+        }
+        push @codeMemories, "        {   // " . uc($memory) . "\n" . join(",\n", @codeDerivatives) . "\n        }";
+    }
+    $code .= join(",\n", @codeMemories) . "\n    };\n\n";
+    
+    # The Winograd kernels are written by hand
+    my %registryWinograd;
+    my $codeWinograd = path("filter_images_winograd.cl")->slurp({binmode => ":encoding(UTF-8)"}) or die "Can't read file filter_images_winograd.cl: $!\n";
+    while ($codeWinograd =~ m{^kernel void (filter_double_winograd_(\d+)x(\d+))\s*\(}gm) {
+        $registryWinograd{"${2}x$3"} = [$1, $2, $3];
+    }
+    
+    $code .= "    /**\n";
+    $code .= "     * \@brief Winograd kernels for two filters (only for the image storage)\n";
+    $code .= "     */\n";
+    $code .= "    constexpr Kernel winograd[NUMBER_SIZES] = {\n";
+    $code .= join(",\n", map { my $kernel = $registryWinograd{$_}; $kernel ? "        { \"$kernel->[0]\", $kernel->[1], $kernel->[2] }" : "        { nullptr, 0, 0 }" } @sizes) . "\n    };\n\n";
+    
+    $code .= "    constexpr const Kernel& get(const Storage storage, const Multiplicity multiplicity, const Memory memory, const int rows, const int cols)\n";
+    $code .= "    {\n";
+    $code .= "        return kernels[storage][multiplicity][memory][size(rows, cols)];\n";
+    $code .= "    }\n\n";
+    $code .= "    constexpr const Kernel& getDilated(const Storage storage, const Multiplicity multiplicity)\n";
+    $code .= "    {\n";
+    $code .= "        return dilated[storage][multiplicity];\n";
+    $code .= "    }\n\n";
+    $code .= "    constexpr const Kernel& getPredefined(const Memory memory, const Derivative derivative, const int rows, const int cols)\n";
+    $code .= "    {\n";
+    $code .= "        return predefined[memory][derivative][size(rows, cols)];\n";
+    $code .= "    }\n\n";
+    $code .= "    constexpr const Kernel& getWinograd(const int rows, const int cols)\n";
+    $code .= "    {\n";
+    $code .= "        return winograd[size(rows, cols)];\n";
+    $code .= "    }\n";
+    $code .= "}\n";
+    
+    path($codeFilename)->spew({binmode => ":encoding(UTF-8)"}, $code) or die "Can't write file " . $codeFilename . ": $!\n";
+}
+
+# Replaces every #include "file" with the content of the file (recursively) so that the embedded sources don't need any include path
+sub expand_includes
+{
+    my $code = $_[0];
+    $code =~ s{^#include "([^"]+)"[^\n]*$}{expand_includes(path($1)->slurp({binmode => ":encoding(UTF-8)"}) // die "Can't read file " . $1 . ": $!\n")}gme;
+    
+    return $code;
+}
+
+# Splits the code into C++ raw string literals (MSVC does not support string literals longer than 16380 characters)
+sub raw_string_chunks
+{
+    my $code = $_[0];
+    my $indent = $_[1];
+    my @chunks = ("");
+    
+    foreach my $line (split /^/, $code) {
+        die "The code must not contain the raw string delimiter\n" if $line =~ m{\)CL"};
+        push @chunks, "" if length($chunks[-1]) + length($line) > 15000;
+        $chunks[-1] .= $line;
+    }
+    
+    return map { $indent . "R\"CL(" . $_ . ")CL\"" } @chunks;
+}
+
+# C++ source which embeds all kernels in the executable (see KernelSources.h). Every root file is split into a prelude (everything before the variant
+# includes), a base unit (the kernels after the variant includes) and one unit per included file. The generated normal and local filters are further
+# split so that every filter variant (e.g. filter_single_local_5x5) is its own unit and only compiled when it is used
+sub generate_sources
+{
+    my $codeFilename = $_[0];
+    my @roots = (["images", "filter_images.cl"], ["cubes", "filter_cubes.cl"], ["buffer", "filter_buffer.cl"], ["image1D", "filter_image1D.cl"]);
+    
+    my $code = $generatedWarning;
+    $code .= "#include \"KernelSources.h\"\n\n";
+    $code .= "namespace KernelSources\n{\n";
+    $code .= "    namespace\n    {\n";
+    
+    my @codeStorages;
+    foreach my $root (@roots) {
+        my ($storage, $filename) = @$root;
+        my $rootCode = path($filename)->slurp({binmode => ":encoding(UTF-8)"}) or die "Can't read file " . $filename . ": $!\n";
+        
+        my ($prelude, $includes, $base) = $rootCode =~ m{^(.*?)((?:^#include "filter_[^"]+\.cl"\n)+)(.*)$}ms or die "No variant includes found in " . $filename . "\n";
+        
+        my @units = ([$filename, $base]);
+        foreach my $include ($includes =~ m{"([^"]+)"}g) {
+            my $filenameBase = $include =~ s/\.cl$/.base.cl/r;
+            if (exists $variants{$filenameBase}) {
+                push @units, map { [$include . ":" . ($_ =~ m{^kernel void (\w+)}m)[0], $_] } @{$variants{$filenameBase}};
+            }
+            else {
+                push @units, [$include, path($include)->slurp({binmode => ":encoding(UTF-8)"})];
+            }
+        }
+        
+        my @preludeChunks = raw_string_chunks(expand_includes($prelude), "            ");
+        $code .= "        const char* const ${storage}Prelude[] = {\n" . join(",\n", @preludeChunks) . "\n        };\n\n";
+        
+        my %kernelUnits;
+        my @codeUnits;
+        for (my $i = 0; $i < scalar @units; ++$i) {
+            my ($name, $unitCode) = @{$units[$i]};
+            my @chunks = raw_string_chunks(expand_includes($unitCode), "            ");
+            
+            foreach my $kernel ($unitCode =~ m{^kernel void (\w+)}gm) {
+                die "The kernel $kernel is defined twice for the storage $storage\n" if exists $kernelUnits{$kernel};
+                $kernelUnits{$kernel} = $i;
+            }
+            
+            $code .= "        const char* const ${storage}Unit$i\[] = {\n" . join(",\n", @chunks) . "\n        };\n";
+            push @codeUnits, "            { \"$name\", { ${storage}Unit$i, " . scalar(@chunks) . " } }";
+        }
+        
+        $code .= "\n";
+        $code .= "        const Unit ${storage}Units[] = {\n" . join(",\n", @codeUnits) . "\n        };\n\n";
+        
+        # Sorted by name (byte-wise like strcmp) for the binary search in findUnit()
+        my @kernelNames = sort { $a cmp $b } keys %kernelUnits;
+        $code .= "        const KernelEntry ${storage}Kernels[] = {\n" . join(",\n", map { "            { \"$_\", $kernelUnits{$_} }" } @kernelNames) . "\n        };\n\n";
+        
+        push @codeStorages, "        { { ${storage}Prelude, " . scalar(@preludeChunks) . " }, ${storage}Units, " . scalar(@units) . ", ${storage}Kernels, " . scalar(@kernelNames) . " }";
+    }
+    
+    $code =~ s/\n\n$/\n/;
+    $code .= "    }\n\n";
+    $code .= "    const StorageSources storages[KernelRegistry::NUMBER_STORAGES] = {\n" . join(",\n", @codeStorages) . "\n    };\n";
+    $code .= "}\n";
+    
+    path($codeFilename)->spew({binmode => ":encoding(UTF-8)"}, $code) or die "Can't write file " . $codeFilename . ": $!\n";
+}
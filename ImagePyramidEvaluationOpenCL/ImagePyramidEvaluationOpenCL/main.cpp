@@ -2,6 +2,8 @@
 #include <opencv2/highgui.hpp>
 #include <opencv2/imgproc.hpp>
 #include <map>
+#include <chrono>
+#include <algorithm>
 #include "PyramidImages.h"
 #include "PyramidCubes.h"
 #include "PyramidBuffer.h"
@@ -9,6 +11,17 @@
 #include "utils.h"
 #include <iomanip>
 #include "PyramidImages1D.h"
+#include "PyramidCpu.h"
+#include "KernelReport.h"
+#include "Roofline.h"
+#include "Tracer.h"
+#include "HostOverhead.h"
+#include "ScalingStudy.h"
+#include "OpenCVBaseline.h"
+#include "BenchmarkStore.h"
+#include "AccuracyReport.h"
+#include "BandwidthProbe.h"
+#include "HostPyramid.h"
 
 struct TestResults
 {
@@ -16,21 +29,49 @@ struct TestResults
     std::vector<long long> times;
 };
 
-void testBatch(APyramid& pyramid)
+/**
+ * @brief Collects the measurements of all tested pyramids (which of them are used is defined in settings.h)
+ */
+struct Instruments
+{
+    explicit Instruments(const cv::Mat& img)
+        : baseline(img)
+    {}
+
+    KernelReport kernelReport;
+    Roofline roofline;
+    Tracer tracer;
+    HostOverhead hostOverhead;
+    OpenCVBaseline baseline;
+    BenchmarkRun benchmarkRun;
+    BandwidthProbe bandwidthProbe;
+};
+
+void testBatch(APyramid& pyramid, Instruments& instruments)
 {
     //std::vector<APyramid::Method> methods = {
     //    // Default cases
     //    APyramid::SINGLE,
     //    APyramid::SINGLE_LOCAL,
+    //    APyramid::SINGLE_SLIDING,
     //    APyramid::SINGLE_SEPARATION,
+    //    APyramid::SINGLE_SEPARATION_TRANSPOSED,
     //    APyramid::DOUBLE,
+    //    APyramid::DOUBLE_WINOGRAD,
+    //    APyramid::SINGLE_DECOMPOSED,
 
     //    // Selected combinations
     //    APyramid::SINGLE_PREDEFINED,
     //    APyramid::SINGLE_PREDEFINED_LOCAL,
     //    APyramid::DOUBLE_PREDEFINED,
     //    APyramid::DOUBLE_PREDEFINED_LOCAL,
-    //    APyramid::DOUBLE_LOCAL
+    //    APyramid::DOUBLE_LOCAL,
+
+    //    // All sigma sizes at once (image pyramid only)
+    //    APyramid::MULTI_SIGMA_LOCAL,
+
+    //    // Persistent work-groups (buffer and image1D pyramid only)
+    //    APyramid::SINGLE_LOCAL_PERSISTENT
     //};
 
     std::vector<APyramid::Method> methods = {
@@ -43,14 +84,50 @@ void testBatch(APyramid& pyramid)
     std::map<APyramid::Method, std::vector<TestResults>> results;
 
     APyramid::Settings settings;
+    if (reportRoofline)
+    {
+        pyramid.setRoofline(&instruments.roofline);
+    }
+    if (trace)
+    {
+        pyramid.setTracer(&instruments.tracer);
+    }
     pyramid.init();
+    pyramid.waitForKernels();
+
+    if (regressionGate && pyramid.usesOpenCL())
+    {
+        instruments.benchmarkRun.setConfiguration(pyramid.getDevice(), pyramid.getOpenCL().getBuildOptions());
+    }
+
+    if (reportKernels && pyramid.usesOpenCL())
+    {
+        instruments.kernelReport.add(pyramid.getDevice(), pyramid.getProgramCache(), pyramid.name());
+    }
+
+    if (measureHostOverhead && pyramid.usesOpenCL())
+    {
+        instruments.hostOverhead.add(pyramid.getOpenCL(), pyramid.getProgramCache(), pyramid.name());
+    }
+
+    if (probeBandwidth && pyramid.usesOpenCL())
+    {
+        instruments.bandwidthProbe.add(pyramid);
+    }
 
     for (auto method : methods)
     {
+        if (!pyramid.supports(method))
+        {
+            std::cout << APyramid::methodToString(method) << " is not supported by the " << pyramid.name() << " pyramid" << std::endl;
+            continue;
+        }
+
         for (int sigmaSize : sigmaSizes)
         {
             TestResults testResults;
             testResults.sigmaSize = sigmaSize;
+            std::vector<double> samples;    // Microseconds (the regression gate needs a finer resolution than startFilterTest())
 
             for (size_t i = 0; i < iterations; ++i)
             {
@@ -58,10 +135,46 @@ void testBatch(APyramid& pyramid)
                 settings.sigmaSize = sigmaSize;
                 pyramid.setSettings(settings);
 
+                const std::string label = APyramid::methodToString(method) + pyramid.name() + "Sigma" + std::to_string(sigmaSize);
+                if (reportRoofline)
+                {
+                    instruments.roofline.setLabel(label);
+                }
+                if (trace)
+                {
+                    instruments.tracer.setLabel(label);
+                }
+
+                const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
                 long long time = pyramid.startFilterTest();
+                samples.push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count());
+
+                if (reportRoofline)
+                {
+                    instruments.roofline.collect();
+                    instruments.roofline.setLabel("");
+                }
+                if (trace)
+                {
+                    instruments.tracer.collect();
+                    instruments.tracer.setLabel("");
+                }
 
                 testResults.times.push_back(time);
             }
+
+            if (regressionGate && pyramid.usesOpenCL())
+            {
+                instruments.benchmarkRun.add(pyramid.name(), method, sigmaSize, samples);
+            }
+
+            if (compareOpenCV)
+            {
+                // The microsecond samples since startFilterTest() only resolves whole milliseconds (fast methods would be 0 ms)
+                std::vector<double> sorted = samples;
+                std::sort(sorted.begin(), sorted.end());
+                instruments.baseline.compare(pyramid.name(), method, sigmaSize, sorted[sorted.size() / 2] / 1000.0, pyramid.readLevels());
+            }
             
             results[method].push_back(testResults);
         }
@@ -129,6 +242,173 @@ void testBatch(APyramid& pyramid)
     std::cout << "done" << std::endl;
 }
 
+void testAccuracy(APyramid& pyramid, AccuracyReport& report, const std::string& profile, const std::vector<int>& sigmaSizes)
+{
+    const int iterations = 5;
+
+    pyramid.init();
+    pyramid.waitForKernels();
+
+    for (auto method : APyramid::allMethods())
+    {
+        if (!pyramid.supports(method))
+        {
+            continue;
+        }
+
+        for (int sigmaSize : sigmaSizes)
+        {
+            APyramid::Settings settings;
+            settings.method = method;
+            settings.sigmaSize = sigmaSize;
+            pyramid.setSettings(settings);
+
+            pyramid.startFilterTest();  // Warm-up
+
+            std::vector<double> times;
+            for (int i = 0; i < iterations; ++i)
+            {
+                const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+                pyramid.startFilterTest();
+                times.push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count() / 1000.0);
+            }
+            std::sort(times.begin(), times.end());
+
+            report.add(profile, pyramid.name(), APyramid::methodToString(method), sigmaSize, times[times.size() / 2], pyramid.readLevels());
+        }
+    }
+}
+
+/**
+ * @brief Compares the CPU pyramid level by level with the image pyramid and prints the maximum difference in ULP of every method (see PyramidCpu.h for the
+ * methods which are expected to be bit-identical)
+ */
+void testCpuMatch(const cv::Mat& img, const std::vector<int>& sigmaSizes)
+{
+    PyramidImages pyramidDevice(img);
+    PyramidCpu pyramidCpu(img);
+    if (!pyramidDevice.init() || !pyramidCpu.init())
+    {
+        return;
+    }
+    pyramidDevice.waitForKernels();
+
+    std::cout << "--- ULP difference of the " << pyramidCpu.name() << " pyramid to the " << pyramidDevice.name() << " pyramid (interior of all levels) ---" << std::endl;
+    for (auto method : APyramid::allMethods())
+    {
+        if (!pyramidCpu.supports(method) || !pyramidDevice.supports(method))
+        {
+            continue;
+        }
+
+        for (int sigmaSize : sigmaSizes)
+        {
+            APyramid::Settings settings;
+            settings.method = method;
+            settings.sigmaSize = sigmaSize;
+            pyramidDevice.setSettings(settings);
+            pyramidCpu.setSettings(settings);
+
+            pyramidDevice.startFilterTest();
+            pyramidCpu.startFilterTest();
+            const APyramid::Levels levelsDevice = pyramidDevice.readLevels();
+            const APyramid::Levels levelsCpu = pyramidCpu.readLevels();
+            ASSERT(levelsDevice.Gx.size() == levelsCpu.Gx.size(), "The pyramids have a different number of levels");
+
+            int64_t maxUlp = 0;
+            size_t worstLevel = 0;
+            for (size_t i = 0; i < levelsDevice.Gx.size(); ++i)
+            {
+                const int64_t ulp = std::max(HostPyramid::maxUlpDifference(levelsDevice.Gx[i], levelsCpu.Gx[i], sigmaSize),
+                                             HostPyramid::maxUlpDifference(levelsDevice.Gy[i], levelsCpu.Gy[i], sigmaSize));
+                if (ulp > maxUlp)
+                {
+                    maxUlp = ulp;
+                    worstLevel = i;
+                }
+            }
+
+            std::cout << std::left << std::setw(30) << APyramid::methodToString(method) << std::right << "sigma " << sigmaSize << ": " << maxUlp << " ULP";
+            if (maxUlp > 0)
+            {
+                std::cout << " (worst level " << worstLevel << ")";
+            }
+            std::cout << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief Runs non-separable filters with every strategy which can be applied to them and compares the results with cv::filter2D
+ * @return number of failed comparisons
+ */
+int testDecomposition(PyramidImages& pyramid, const cv::Mat& img)
+{
+    const double maxRelativeError = 1e-4;
+    cv::RNG rng(42);
+    auto randomFilter = [&](const int rows, const int cols)
+    {
+        cv::Mat filter(rows, cols, CV_32FC1);
+        rng.fill(filter, cv::RNG::UNIFORM, -1.0, 1.0);
+        return filter;
+    };
+
+    // Rank 2 (sum of two separable filters), dilated 3x3 on a 9x9 grid, dense and dense beyond the size of the local kernels
+    const cv::Mat rank2 = randomFilter(7, 1) * randomFilter(1, 7) + randomFilter(7, 1) * randomFilter(1, 7);
+    cv::Mat sparse = cv::Mat::zeros(9, 9, CV_32FC1);
+    const cv::Mat taps = randomFilter(3, 3);
+    for (int y = 0; y < 3; ++y)
+    {
+        for (int x = 0; x < 3; ++x)
+        {
+            sparse.at<float>(4 * y, 4 * x) = taps.at<float>(y, x);
+        }
+    }
+    const std::vector<std::pair<std::string, cv::Mat>> filters = {
+        { "rank2 7x7", rank2 },
+        { "dilated 9x9", sparse },
+        { "dense 5x7", randomFilter(5, 7) },
+        { "dense 23x23", randomFilter(23, 23) }
+    };
+
+    pyramid.init();
+    pyramid.waitForKernels();
+
+    std::cout << "--- Decomposition strategies against cv::filter2D (without the filter border) ---" << std::endl;
+    int failures = 0;
+    for (const auto& f : filters)
+    {
+        cv::Mat reference;
+        cv::filter2D(img, reference, CV_32F, f.second, cv::Point(-1, -1), 0, cv::BORDER_DEFAULT);
+        double minRef = 0.0, maxRef = 0.0;
+        cv::minMaxLoc(reference, &minRef, &maxRef);
+        const double peak = std::max(std::abs(minRef), std::abs(maxRef));
+
+        FilterDecomposition decomposition(f.second);
+        for (FilterDecomposition::Strategy strategy : { FilterDecomposition::SEPARABLE, FilterDecomposition::SEPARABLE_SUM, FilterDecomposition::SPARSE,
+                                                       FilterDecomposition::DENSE_LOCAL, FilterDecomposition::DENSE })
+        {
+            if (decomposition.cost(strategy) == std::numeric_limits<double>::infinity())
+            {
+                continue;
+            }
+            decomposition.setStrategy(strategy);
+
+            const cv::Mat result = pyramid.filterDecomposed(decomposition);
+            const int border = std::max(f.second.rows, f.second.cols) / 2;
+            const double error = HostPyramid::maxAbsError(reference, result, border) / peak;
+            const bool failed = !(error <= maxRelativeError);
+            failures += failed ? 1 : 0;
+
+            std::cout << std::left << std::setw(14) << f.first << std::setw(14) << FilterDecomposition::strategyToString(strategy) << std::right
+                      << "rank " << decomposition.getRank() << ", relative error " << std::scientific << std::setprecision(2) << error << std::defaultfloat
+                      << (failed ? " FAILED" : "") << std::endl;
+        }
+    }
+
+    return failures;
+}
+
 void test(APyramid& pyramid)
 {
     APyramid::Settings settings;
@@ -144,6 +424,38 @@ void test(APyramid& pyramid)
     pyramid.readImages();
 }
 
+/**
+ * @brief Same device query as selectFirstGPU() but without output
+ */
+bool gpuAvailable()
+{
+    try
+    {
+        std::vector<cl::Platform> platforms;
+        cl::Platform::get(&platforms);
+
+        for (const cl::Platform& platform : platforms)
+        {
+            std::vector<cl::Device> devices;
+            try
+            {
+                platform.getDevices(CL_DEVICE_TYPE_GPU, &devices);
+            }
+            catch (const cl::Error&)
+            {}
+
+            if (!devices.empty())
+            {
+                return true;
+            }
+        }
+    }
+    catch (const cl::Error&)
+    {}
+
+    return false;
+}
+
 void generateScharrKernels()
 {
     std::fstream fileKernels("kernels/derivative_kernels.pl", std::ios::out);
@@ -200,6 +512,24 @@ int main()
 {
     //generateScharrKernels();
 
+    const std::vector<ScalingStudy::PyramidFactory> pyramidFactories = {
+        [](const cv::Mat& img) { return std::unique_ptr<APyramid>(new PyramidImages(img)); },
+        [](const cv::Mat& img) { return std::unique_ptr<APyramid>(new PyramidCubes(img)); },
+        [](const cv::Mat& img) { return std::unique_ptr<APyramid>(new PyramidBuffer(img)); },
+        [](const cv::Mat& img) { return std::unique_ptr<APyramid>(new PyramidImages1D(img)); }
+    };
+
+    if (scalingStudy)
+    {
+        ScalingStudy study;
+        study.run(pyramidFactories, APyramid::allMethods());
+
+        study.print(std::cout);
+        study.writeJson("scaling.json");
+
+        return 0;
+    }
+
 #ifdef DEBUG_INTEL
     cv::Mat img = cv::imread("../../test_images/tomo.jpg");
 #else
@@ -210,21 +540,141 @@ int main()
     cv::cvtColor(img, imgGray, cv::COLOR_BGR2GRAY);
     imgGray.convertTo(imgGray, CV_32FC1, 1.0 / 255.0);
 
+    if (validateAccuracy)
+    {
+        const std::vector<int> sigmaSizes = { 1, 2, 3, 4 };
+
+        AccuracyReport report(imgGray);
+        for (int sigmaSize : sigmaSizes)
+        {
+            report.addHostFloat(sigmaSize);
+        }
+
+        const bool gpu = gpuAvailable();
+        if (gpu)
+        {
+            for (const AccuracyReport::Profile& profile : AccuracyReport::defaultProfiles())
+            {
+                for (const ScalingStudy::PyramidFactory& factory : pyramidFactories)
+                {
+                    std::unique_ptr<APyramid> pyramid = factory(imgGray);
+                    pyramid->getOpenCL().addBuildOptions(profile.buildOptions);
+                    testAccuracy(*pyramid, report, profile.name, sigmaSizes);
+                }
+            }
+        }
+
+        // The CPU pyramid has no build options
+        for (const PyramidCpu::Traversal traversal : { PyramidCpu::STREAMED, PyramidCpu::CACHE_BLOCKED })
+        {
+            PyramidCpu pyramid(imgGray, traversal);
+            testAccuracy(pyramid, report, "native", sigmaSizes);
+        }
+
+        report.print(std::cout);
+        report.writeJson("accuracy.json");
+
+        if (gpu)
+        {
+            testCpuMatch(imgGray, sigmaSizes);
+        }
+
+        return 0;
+    }
+
+    if (validateDecomposition)
     {
         PyramidImages pyramid(imgGray);
-        testBatch(pyramid);
+        return testDecomposition(pyramid, imgGray) == 0 ? 0 : 1;
     }
+
+    Instruments instruments(imgGray);
+
+    const bool gpu = gpuAvailable();
+    if (gpu)
     {
-        PyramidCubes pyramid(imgGray);
-        testBatch(pyramid);
+        for (const ScalingStudy::PyramidFactory& factory : pyramidFactories)
+        {
+            std::unique_ptr<APyramid> pyramid = factory(imgGray);
+            testBatch(*pyramid, instruments);
+        }
     }
+    else
     {
-        PyramidBuffer pyramid(imgGray);
-        testBatch(pyramid);
+        std::cout << "No GPU device found, only the CPU pyramid is tested" << std::endl;
     }
+
+    if (cpuBaseline || !gpu)
+    {
+        PyramidCpu pyramid(imgGray);
+        testBatch(pyramid, instruments);
+    }
+
+    if (cpuCacheBlocked)
     {
-        PyramidImages1D pyramid(imgGray);
-        testBatch(pyramid);
+        PyramidCpu pyramid(imgGray, PyramidCpu::CACHE_BLOCKED);
+        testBatch(pyramid, instruments);
+    }
+
+    if (reportKernels)
+    {
+        instruments.kernelReport.print(std::cout);
+        instruments.kernelReport.writeJson("kernel_report.json");
+    }
+
+    if (reportRoofline)
+    {
+        instruments.roofline.print(std::cout);
+        instruments.roofline.writeJson("roofline.json");
+    }
+
+    if (trace)
+    {
+        instruments.tracer.writeJson("trace.json");
+    }
+
+    if (measureHostOverhead)
+    {
+        instruments.hostOverhead.print(std::cout);
+        instruments.hostOverhead.writeJson("host_overhead.json");
+    }
+
+    if (probeBandwidth)
+    {
+        instruments.bandwidthProbe.print(std::cout);
+        instruments.bandwidthProbe.writeJson("bandwidth.json");
+    }
+
+    if (compareOpenCV)
+    {
+        instruments.baseline.print(std::cout);
+        instruments.baseline.writeJson("opencv_baseline.json");
+    }
+
+    if (regressionGate)
+    {
+        // The first run of a configuration becomes its baseline, later runs are compared with it
+        const std::string filename = instruments.benchmarkRun.filename();
+        BenchmarkRun baselineRun;
+        if (!saveBaseline && baselineRun.load(filename))
+        {
+            std::cout << "Baseline " << filename << " (" << baselineRun.getConfiguration() << ")" << std::endl;
+
+            RegressionCheck check;
+            const size_t regressions = check.compare(baselineRun, instruments.benchmarkRun);
+            check.print(std::cout);
+
+            if (regressions > 0)
+            {
+                std::cout << regressions << " significant slowdown(s)" << std::endl;
+                return 1;
+            }
+        }
+        else
+        {
+            instruments.benchmarkRun.save(filename);
+            std::cout << "Saved the baseline " << filename << " (" << instruments.benchmarkRun.getConfiguration() << ")" << std::endl;
+        }
     }
     
     //PyramidBuffer pyramid(imgGray);
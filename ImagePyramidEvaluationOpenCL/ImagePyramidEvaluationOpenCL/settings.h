@@ -3,3 +3,17 @@
 //#define DEBUG_INTEL
 
 static bool unroll = true;
+static bool dilated = true;     // Use the dilated 3x3 filter for sparse filters (e.g. derivative filters with sigmaSize > 1)
+static bool reportKernels = false;    // Print the resources and the estimated occupancy of all kernels and export them to kernel_report.json (builds every kernel)
+static bool reportRoofline = false;   // Profile every launch and compare the modelled bytes and FLOPs with the measured device peaks, exported to roofline.json
+static bool trace = false;            // Record the timeline of every launch (queue lanes and host enqueue time), exported to trace.json for chrome://tracing or Perfetto
+static bool measureHostOverhead = false; // Microbenchmarks of the host API calls per storage type, exported to host_overhead.json
+static bool scalingStudy = false;   // Run every pyramid type and method on synthetic images from 256x256 up to 16384x16384 instead of the test image, exported to scaling.json
+static bool compareOpenCV = false;  // Time the same pyramid with OpenCV on cv::Mat and cv::UMat (T-API) and report speedups and errors of every method, exported to opencv_baseline.json
+static bool regressionGate = false; // Compare the run with the stored baseline of the device/driver/build options (the first run is stored) and exit with 1 on significant slowdowns
+static bool saveBaseline = false;   // Overwrite the stored baseline with the current run instead of comparing
+static bool validateAccuracy = false; // Compare every method (device pyramids for several build option profiles, e.g. -cl-fast-relaxed-math, and the CPU pyramid) with a double precision reference, exported to accuracy.json, and print the ULP difference of the CPU to the image pyramid
+static bool validateDecomposition = false; // Filter the image with non-separable filters (rank 2, dilated, dense) in every applicable FilterDecomposition strategy and compare with cv::filter2D
+static bool probeBandwidth = false; // Measure the bandwidth of copy, strided, neighbourhood and write-only kernels on the memory of every storage type, exported to bandwidth.json
+static bool cpuBaseline = false;  // Test the native CPU pyramid (SIMD and thread pool) after the device pyramids (it is always tested if there is no GPU)
+static bool cpuCacheBlocked = false; // Additionally test the CPU pyramid with the cache-blocked traversal (bands of rows sized to the L2 cache flow through all octaves and passes)